@@ -17,6 +17,12 @@ enum sync_id {
   sync_id_last,
 };
 
+enum reduce_id {
+  reduce_id_method_flux_correct,
+  reduce_id_stopping,
+  reduce_id_last,
+};
+
 //----------------------------------------------------------------------
 // System includes
 //----------------------------------------------------------------------
@@ -106,6 +106,7 @@ class Tree;
 
 #include "mesh_Index.hpp"
 
+#include "mesh_RefreshPlan.hpp"
 #include "mesh_Block.hpp"
 #include "mesh_Hierarchy.hpp"
 #include "mesh_Factory.hpp"
@@ -439,6 +439,15 @@ public: // interface
   template<typename... Args, REQUIRE_TYPE(Args,CSlice)>
   TempArray_<T,D> subarray(Args... args) const noexcept;
 
+  /// Return a view of the (D-1)-dimensional array located at a single index
+  /// along the first (slowest varying) axis.
+  ///
+  /// This is analogous to indexing a numpy array with a single integer, (e.g.
+  /// `arr[i]`). The returned array shares its data with this array.
+  ///
+  /// @param i The index along axis 0. Negative indexing is not supported.
+  CelloArray<T,D-1> reduced_dim_slice(intp i) const noexcept;
+
   /// Returns the length of a given dimension
   ///
   /// @param dim Indicates the dimension for which we want the shape
@@ -696,6 +705,26 @@ TempArray_<T,D> FixedDimArray_<T,D>::subarray(Args... args) const noexcept{
 
 //----------------------------------------------------------------------
 
+template<typename T, std::size_t D>
+CelloArray<T,D-1> FixedDimArray_<T,D>::reduced_dim_slice(intp i)
+  const noexcept
+{
+  static_assert(D > 1, "reduced_dim_slice requires at least 2 dimensions");
+  ASSERT2("FixedDimArray_::reduced_dim_slice",
+          "index %ld is out of bounds for axis 0 with length %ld",
+          (long)i, (long)shape_[0], (i >= 0) && (i < shape_[0]));
+  CelloArray<T,D-1> out;
+  out.shared_data_ = shared_data_;
+  out.offset_ = offset_ + i * stride_[0];
+  for (std::size_t dim = 0; dim + 1 < D; dim++){
+    out.shape_[dim] = shape_[dim+1];
+    out.stride_[dim] = stride_[dim+1];
+  }
+  return out;
+}
+
+//----------------------------------------------------------------------
+
 template<typename T, std::size_t D>
 TempArray_<T,D> FixedDimArray_<T,D>::deepcopy() const noexcept
 {
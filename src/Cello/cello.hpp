@@ -21,6 +21,8 @@
 #include <stdio.h>
 #include <math.h>
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -38,6 +40,7 @@
 #include "pup_stl.h"
 
 #include "cello_Sync.hpp"
+#include "cello_ReduceTree.hpp"
 
 // #define DEBUG_CHECK
 
@@ -423,4 +426,6 @@ namespace cello {
   double          relative_cell_volume (int level);
 }
 
+#include "cello_ParallelFor.hpp"
+
 #endif /* CELLO_HPP */
@@ -0,0 +1,123 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     cello_ParallelFor.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Parallel] Implementation of node-level parallel loops
+///
+/// In SMP builds, CkLoop must be initialized (CkLoop_Init()) by the main
+/// chare before any loop is divided among PEs.
+
+#include "cello.hpp"
+#include "simulation.hpp"
+
+#ifdef CONFIG_SMP_MODE
+#  include "CkLoopAPI.h"
+#endif
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Whether each PE is currently executing a chunk of a parallel loop
+  bool in_parallel_loop_[CONFIG_NODE_SIZE] = {false};
+
+  /// Arguments passed through CkLoop to chunk_helper_()
+  struct ChunkParams_ {
+    int begin;
+    int end;
+    int num_chunks;
+    cello::chunk_function_type function;
+    void * data;
+  };
+
+  /// Return the first iteration of chunk ic
+  inline int chunk_start_ (const ChunkParams_ & params, int ic)
+  {
+    const long long n = params.end - params.begin;
+    return params.begin + (int)((n*ic) / params.num_chunks);
+  }
+
+  /// Execute chunks [first,last] (inclusive) of the loop
+  void execute_chunks_ (const ChunkParams_ & params, int first, int last)
+  {
+    const int in = cello::index_static();
+    const bool nested = in_parallel_loop_[in];
+    in_parallel_loop_[in] = true;
+    for (int ic=first; ic<=last; ic++) {
+      const int i1 = chunk_start_(params,ic);
+      const int i2 = chunk_start_(params,ic+1);
+      if (i1 < i2) (*params.function)(i1,i2,params.data);
+    }
+    in_parallel_loop_[in] = nested;
+  }
+
+#ifdef CONFIG_SMP_MODE
+  /// Helper function with the signature expected by CkLoop_Parallelize.
+  /// param points to a ChunkParams_ instance.
+  void chunk_helper_ (int first, int last, void * result,
+                      int param_num, void * param)
+  {
+    execute_chunks_ (*(ChunkParams_ *)(param), first, last);
+  }
+#endif
+
+}
+
+//----------------------------------------------------------------------
+
+namespace cello {
+
+  int num_threads()
+  {
+    const Config * config = cello::config();
+    return config ? config->performance_num_threads : 1;
+  }
+
+  //----------------------------------------------------------------------
+
+  bool in_parallel_loop()
+  {
+    return in_parallel_loop_[cello::index_static()];
+  }
+
+  //----------------------------------------------------------------------
+
+  int count_tiles (const int start[3], const int stop[3],
+                   const int tile[3], int nt[3])
+  {
+    ASSERT3 ("cello::count_tiles",
+             "tile size %d %d %d must be positive along each axis",
+             tile[0],tile[1],tile[2],
+             (tile[0] > 0 && tile[1] > 0 && tile[2] > 0));
+    for (int axis=0; axis<3; axis++) {
+      const int n = std::max(stop[axis] - start[axis], 0);
+      nt[axis] = (n + tile[axis] - 1) / tile[axis];
+    }
+    return nt[0]*nt[1]*nt[2];
+  }
+
+  //----------------------------------------------------------------------
+
+  void parallel_chunks (int begin, int end, int num_chunks,
+                        chunk_function_type function, void * data)
+  {
+    if (end <= begin) return;
+
+    num_chunks = std::max(1,std::min(num_chunks, end - begin));
+
+    ChunkParams_ params = {begin, end, num_chunks, function, data};
+
+#ifdef CONFIG_SMP_MODE
+    if (num_chunks > 1 && CkMyNodeSize() > 1 && ! in_parallel_loop()) {
+      // Blocks until all chunks have been executed
+      CkLoop_Parallelize (chunk_helper_, 1, &params, num_chunks,
+                          0, num_chunks - 1);
+      return;
+    }
+#endif
+
+    // serial fallback: the calling PE executes the chunks in order
+    execute_chunks_ (params, 0, num_chunks - 1);
+  }
+
+}
@@ -0,0 +1,141 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     cello_ParallelFor.hpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Parallel] Declaration of node-level parallel loops
+///
+/// These functions divide the iterations of a loop over the cells of a
+/// single Block into chunks that may be executed concurrently by the
+/// PEs (threads) of a process. In SMP builds the chunks are executed
+/// with Charm++'s CkLoop library; otherwise (or when only one chunk is
+/// requested) the chunks are executed serially by the calling PE. Calls
+/// made from inside a chunk of another parallel loop are also executed
+/// serially.
+///
+/// The body of a loop must only write to locations that no other chunk
+/// touches. Temporary arrays needed by the body may be taken from a
+/// ThreadScratch object, which holds separate storage for each PE.
+
+#ifndef CELLO_PARALLEL_FOR_HPP
+#define CELLO_PARALLEL_FOR_HPP
+
+namespace cello {
+
+  /// Function called to execute iterations [first,last) of a loop
+  typedef void (*chunk_function_type) (int first, int last, void * data);
+
+  /// Return the default number of chunks that parallel loops are
+  /// divided into (the Performance:num_threads parameter)
+  int num_threads();
+
+  /// Return whether the calling PE is executing a chunk of a parallel loop
+  bool in_parallel_loop();
+
+  /// Divide iterations [begin,end) into at most num_chunks chunks of
+  /// contiguous iterations and call function(first,last,data) for each
+  /// chunk. Returns after all chunks have been executed.
+  void parallel_chunks (int begin, int end, int num_chunks,
+                        chunk_function_type function, void * data);
+
+  /// Compute the number of tiles nt[axis] along each axis that are
+  /// needed to cover the 3D index range [start,stop) and return the
+  /// total number of tiles. Each tile size must be positive.
+  int count_tiles (const int start[3], const int stop[3],
+                   const int tile[3], int nt[3]);
+
+  /// Helper function used to call a function object from parallel_chunks()
+  template <class F>
+  void call_range_ (int first, int last, void * data)
+  { (*(const F *)(data)) (first,last); }
+
+  /// Call body(first,last) for contiguous chunks of iterations
+  /// [begin,end), with the chunks executed concurrently where supported
+  template <class F>
+  void parallel_for_range (int begin, int end, const F & body,
+                           int num_chunks = num_threads())
+  {
+    parallel_chunks (begin,end,num_chunks,call_range_<F>,(void *)(&body));
+  }
+
+  /// Call body(i) for each iteration i in [begin,end), with chunks of
+  /// iterations executed concurrently where supported
+  template <class F>
+  void parallel_for (int begin, int end, const F & body,
+                     int num_chunks = num_threads())
+  {
+    parallel_for_range
+      (begin,end,
+       [&body] (int first, int last)
+       { for (int i=first; i<last; i++) body(i); },
+       num_chunks);
+  }
+
+  /// Divide the 3D index range [start,stop) into tiles of at most
+  /// tile[0]*tile[1]*tile[2] cells and call body(lo,hi) for each tile,
+  /// where lo and hi are the (exclusive) int[3] bounds of the tile.
+  /// Tiles are executed concurrently where supported. Each tile size
+  /// must be positive.
+  template <class F>
+  void parallel_for_tiles (const int start[3], const int stop[3],
+                           const int tile[3], const F & body,
+                           int num_chunks = num_threads())
+  {
+    int nt[3];
+    const int num_tiles = count_tiles (start,stop,tile,nt);
+    parallel_for
+      (0, num_tiles,
+       [&] (int it)
+       {
+         const int itile[3] = { it % nt[0], (it / nt[0]) % nt[1],
+                                it / (nt[0]*nt[1]) };
+         int lo[3], hi[3];
+         for (int axis=0; axis<3; axis++) {
+           lo[axis] = start[axis] + itile[axis]*tile[axis];
+           hi[axis] = std::min(lo[axis] + tile[axis], stop[axis]);
+         }
+         body(lo,hi);
+       },
+       num_chunks);
+  }
+
+  //----------------------------------------------------------------------
+
+  template <class T>
+  class ThreadScratch {
+
+    /// @class    ThreadScratch
+    /// @ingroup  Parallel
+    /// @brief    [\ref Parallel] Temporary storage with a separate array
+    ///           for each PE of a process
+    ///
+    /// Each PE's array is reused (and only grows) across calls, so that
+    /// the body of a parallel loop does not need to allocate memory.
+
+  public: // interface
+
+    /// Return the calling PE's array, resized to hold at least size
+    /// elements. The contents are unspecified.
+    T * get (std::size_t size)
+    {
+      std::vector<T> & array = arrays_[cello::index_static()];
+      if (array.size() < size) array.resize(size);
+      return array.data();
+    }
+
+    /// Release the memory held for all PEs
+    void clear ()
+    {
+      for (int i=0; i<CONFIG_NODE_SIZE; i++) {
+        std::vector<T>().swap(arrays_[i]);
+      }
+    }
+
+  private: // attributes
+
+    /// Array for each PE of the process
+    std::vector<T> arrays_[CONFIG_NODE_SIZE];
+  };
+
+}
+
+#endif /* CELLO_PARALLEL_FOR_HPP */
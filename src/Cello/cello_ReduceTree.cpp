@@ -0,0 +1,117 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     cello_ReduceTree.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Parallel] Implementation of the ReduceTree class
+
+#include "cello.hpp"
+#include "charm.hpp"
+
+ReduceTree::ReduceTree ()
+  : values_(),
+    op_(),
+    result_(),
+    count_(0),
+    stop_(0),
+    entry_point_(-1),
+    root_level_(0),
+    global_(false)
+{}
+
+//----------------------------------------------------------------------
+
+void ReduceTree::pup(PUP::er &p)
+{
+  TRACEPUP;
+  p | values_;
+  p | op_;
+  p | result_;
+  p | count_;
+  p | stop_;
+  p | entry_point_;
+  p | root_level_;
+  p | global_;
+}
+
+//----------------------------------------------------------------------
+
+void ReduceTree::start
+(int entry_point, int root_level, bool global, int stop) throw()
+{
+  entry_point_ = entry_point;
+  root_level_  = root_level;
+  global_      = global;
+  stop_        = stop;
+}
+
+//----------------------------------------------------------------------
+
+bool ReduceTree::accumulate
+(int n, const long double * values, const int * op) throw()
+{
+  if (count_ == 0) {
+    values_.assign(values,values+n);
+    op_.assign(op,op+n);
+  } else {
+    ASSERT2 ("ReduceTree::accumulate()",
+	     "Number of values %d differs from previous %d",
+	     n, int(values_.size()), (n == int(values_.size())));
+    for (int i=0; i<n; i++) {
+      values_[i] = combine(op_[i],values_[i],values[i]);
+    }
+  }
+  ++count_;
+  return (stop_ > 0 && count_ >= stop_);
+}
+
+//----------------------------------------------------------------------
+
+void ReduceTree::clear() throw()
+{
+  values_.clear();
+  op_.clear();
+  count_ = 0;
+  stop_  = 0;
+}
+
+//----------------------------------------------------------------------
+
+void ReduceTree::set_result (int n, const long double * values) throw()
+{
+  result_.assign(values,values+n);
+}
+
+//----------------------------------------------------------------------
+
+void ReduceTree::root_count
+(int root_level, const int nb3[3], int na3[3])
+{
+  // Blocks in level root_level <= 0 have array indices that are
+  // multiples of 2^(-root_level)
+
+  const int shift = - root_level;
+  for (int axis=0; axis<3; axis++) {
+    na3[axis] = (nb3[axis] + (1 << shift) - 1) >> shift;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int ReduceTree::root_position
+(int root_level, const int a3[3], const int na3[3])
+{
+  const int shift = - root_level;
+  return (a3[0] >> shift) +
+    na3[0]*((a3[1] >> shift) + na3[1]*(a3[2] >> shift));
+}
+
+//----------------------------------------------------------------------
+
+void ReduceTree::root_array
+(int root_level, int i_root, const int na3[3], int a3[3])
+{
+  const int shift = - root_level;
+  a3[0] = (i_root % na3[0]) << shift;
+  a3[1] = ((i_root / na3[0]) % na3[1]) << shift;
+  a3[2] = (i_root / (na3[0]*na3[1])) << shift;
+}
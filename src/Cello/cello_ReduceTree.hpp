@@ -0,0 +1,146 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     cello_ReduceTree.hpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Parallel] Declaration of the ReduceTree class
+///
+/// This class holds the state of one asynchronous reduction over the
+/// Blocks of the mesh tree (see Block::reduce_tree_start()): the
+/// values combined so far on the way up the tree, the final values
+/// received on the way back down, and a count of contributions.
+/// Like Sync, contributions may arrive before the expected count is
+/// known.
+
+#ifndef CELLO_REDUCE_TREE_HPP
+#define CELLO_REDUCE_TREE_HPP
+
+enum reduce_tree_op {
+  reduce_tree_sum,
+  reduce_tree_min,
+  reduce_tree_max
+};
+
+class ReduceTree {
+
+  /// @class    ReduceTree
+  /// @ingroup  Cello
+  /// @brief    [\ref Parallel] State of a tree reduction on a Block
+
+public: // interface
+
+  /// Create an inactive ReduceTree object
+  ReduceTree ();
+
+  /// CHARM++ pack / unpack
+  void pup(PUP::er &p);
+
+  /// Begin a new reduction, expecting stop contributions in total
+  /// (including the Block's own)
+  void start (int entry_point, int root_level, bool global, int stop)
+    throw();
+
+  /// Combine n values with those received so far using the given
+  /// per-value operations, and return whether all contributions have
+  /// been received. If so, the combined values are available until
+  /// the next call to clear().
+  bool accumulate (int n, const long double * values, const int * op)
+    throw();
+
+  /// Number of combined values
+  int size () const
+  { return values_.size(); }
+
+  /// Combined values (after accumulate() returns true)
+  long double * values ()
+  { return values_.data(); }
+
+  /// Reduction operations of the combined values
+  int * op ()
+  { return op_.data(); }
+
+  /// Clear the combined values and count for the next reduction
+  void clear () throw();
+
+  /// Store the final reduced values
+  void set_result (int n, const long double * values) throw();
+
+  /// Return the final reduced values
+  const std::vector<long double> & result () const
+  { return result_; }
+
+  /// Entry point called when the reduction completes
+  int entry_point () const
+  { return entry_point_; }
+
+  /// Lowest mesh level included in the reduction
+  int root_level () const
+  { return root_level_; }
+
+  /// Whether the Blocks in root_level are also reduced together
+  bool global () const
+  { return global_; }
+
+  /// Combine two values using the given reduction operation
+  static long double combine (int op, long double a, long double b)
+  {
+    return
+      (op == reduce_tree_min) ? std::min(a,b) :
+      (op == reduce_tree_max) ? std::max(a,b) : a + b;
+  }
+
+  /// Number na3[] of root-level Blocks along each axis given the
+  /// number nb3[] of Blocks in the root array and root_level <= 0
+  static void root_count (int root_level, const int nb3[3], int na3[3]);
+
+  /// Position of the root-level Block with array index a3[] in the
+  /// binary tree over root-level Blocks
+  static int root_position (int root_level, const int a3[3],
+			    const int na3[3]);
+
+  /// Array index a3[] of the root-level Block at position i_root
+  static void root_array (int root_level, int i_root,
+			  const int na3[3], int a3[3]);
+
+  /// Position of the parent of position i_root in the binary tree,
+  /// or -1 for the root
+  static int root_parent (int i_root)
+  { return (i_root > 0) ? (i_root - 1)/2 : -1; }
+
+  /// Position of child k (0 or 1) of position i_root in the binary
+  /// tree, or -1 if there is no such child
+  static int root_child (int i_root, int k, int num_root)
+  {
+    const int j_root = 2*i_root + 1 + k;
+    return (j_root < num_root) ? j_root : -1;
+  }
+
+private: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Values combined so far
+  std::vector<long double> values_;
+
+  /// Reduction operation for each value
+  std::vector<int> op_;
+
+  /// Final values of the last completed reduction
+  std::vector<long double> result_;
+
+  /// Number of contributions received so far
+  int count_;
+
+  /// Expected number of contributions, or 0 if not yet known
+  int stop_;
+
+  /// Entry point called when the reduction completes
+  int entry_point_;
+
+  /// Lowest mesh level included in the reduction
+  int root_level_;
+
+  /// Whether the Blocks in root_level are also reduced together
+  bool global_;
+};
+
+#endif /* CELLO_REDUCE_TREE_HPP */
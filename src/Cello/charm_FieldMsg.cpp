@@ -0,0 +1,107 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_FieldMsg.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Charm] Implementation of the FieldMsg Charm++ Message
+
+#include "data.hpp"
+#include "charm.hpp"
+#include "charm_simulation.hpp"
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Return the actual precision used for precision_default
+  precision_type resolve_ (precision_type precision)
+  {
+    return (precision == precision_default) ? default_precision : precision;
+  }
+
+  /// Copy n values from src to dst with conversion
+  template <class T_DST, class T_SRC>
+  void convert_ (T_DST * dst, const T_SRC * src, int n)
+  {
+    for (int i=0; i<n; i++) dst[i] = (T_DST) src[i];
+  }
+
+  /// Copy n values of precision precision_src to precision_dst
+  void convert_ (char * dst, precision_type precision_dst,
+		 const char * src, precision_type precision_src, int n)
+  {
+    if (precision_dst == precision_single &&
+	precision_src == precision_double) {
+      convert_ ((float *)dst, (const double *)src, n);
+    } else if (precision_dst == precision_double &&
+	       precision_src == precision_single) {
+      convert_ ((double *)dst, (const float *)src, n);
+    } else if (precision_dst == precision_single &&
+	       precision_src == precision_quadruple) {
+      convert_ ((float *)dst, (const long double *)src, n);
+    } else if (precision_dst == precision_quadruple &&
+	       precision_src == precision_single) {
+      convert_ ((long double *)dst, (const float *)src, n);
+    } else if (precision_dst == precision_double &&
+	       precision_src == precision_quadruple) {
+      convert_ ((double *)dst, (const long double *)src, n);
+    } else if (precision_dst == precision_quadruple &&
+	       precision_src == precision_double) {
+      convert_ ((long double *)dst, (const double *)src, n);
+    } else {
+      ERROR2 ("FieldMsg::convert_()",
+	      "Unsupported conversion from precision %d to %d",
+	      precision_src,precision_dst);
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+FieldMsg * FieldMsg::create (int n, const char * array,
+			     precision_type precision_array,
+			     precision_type precision_msg)
+{
+  precision_array = resolve_(precision_array);
+  precision_msg   = resolve_(precision_msg);
+
+  const int size_array = cello::sizeof_precision(precision_array);
+  const int size_msg   = cello::sizeof_precision(precision_msg);
+  const int num_values = n / size_array;
+  const int n_msg      = num_values * size_msg;
+
+  // (note: charm messages not deleted on send; are deleted on receive)
+
+  FieldMsg * msg  = new (n_msg) FieldMsg;
+
+  msg->n = n_msg;
+  msg->precision = precision_msg;
+
+  if (precision_msg == precision_array) {
+    memcpy (msg->a, array, n);
+  } else {
+    convert_ (msg->a, precision_msg, array, precision_array, num_values);
+  }
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+char * FieldMsg::values (precision_type precision_array,
+			 std::vector<char> & buffer)
+{
+  precision_array = resolve_(precision_array);
+
+  if (precision_array == precision) return a;
+
+  const int num_values = n / cello::sizeof_precision(precision);
+
+  buffer.resize(num_values * cello::sizeof_precision(precision_array));
+
+  convert_ (buffer.data(), precision_array, a, precision, num_values);
+
+  return buffer.data();
+}
+
+//----------------------------------------------------------------------
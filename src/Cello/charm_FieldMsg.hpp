@@ -10,6 +10,21 @@
 
 class FieldMsg : public CMessage_FieldMsg {
 
+public: // interface
+
+  /// Create a FieldMsg holding the n bytes of field values in array,
+  /// stored with precision precision_msg.  If precision_msg differs
+  /// from precision_array (e.g. precision_single for double
+  /// fields), the values are converted, reducing the message size
+  static FieldMsg * create (int n, const char * array,
+			    precision_type precision_array,
+			    precision_type precision_msg);
+
+  /// Return the field values with the given precision.  This is the
+  /// message array itself if no conversion is needed; otherwise the
+  /// values are converted into buffer
+  char * values (precision_type precision, std::vector<char> & buffer);
+
 public: // attributes
   
   /// Array length
@@ -18,9 +33,11 @@ public: // attributes
   /// Array data
   char * a;
 
+  /// Precision of values in the array
+  precision_type precision;
+
   /// Child indices
   int ic3[3];
 };
 
 #endif /* CHARM_FIELD_MSG_HPP */
-
@@ -52,6 +52,23 @@ void MsgRefresh::set_data_msg  (DataMsg * data_msg)
 
 //----------------------------------------------------------------------
 
+void MsgRefresh::set_data_copy (const char * data, int size)
+{
+  // Copy into a buffer that is freed like an unpacked message's
+
+  void * buffer = CkAllocBuffer (this,size);
+  memcpy (buffer,data,size);
+
+  DataMsg * data_msg = new DataMsg;
+  data_msg->load_data((char *)buffer);
+  set_data_msg (data_msg);
+
+  buffer_   = buffer;
+  is_local_ = false;
+}
+
+//----------------------------------------------------------------------
+
 void * MsgRefresh::pack (MsgRefresh * msg)
 {
 #ifdef DEBUG_MSG_REFRESH
@@ -43,6 +43,10 @@ public: // interface
   // Set the DataMsg object
   void set_data_msg (DataMsg * data_msg);
 
+  /// Set the DataMsg object from a copy of serialized DataMsg data,
+  /// e.g. from an aggregated refresh buffer
+  void set_data_copy (const char * data, int size);
+
   /// Update the Data with data stored in this message
   void update (Data * data);
 
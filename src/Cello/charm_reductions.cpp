@@ -1,3 +1,4 @@
+#include "cello.hpp"
 #include "charm.hpp"
 
 //======================================================================
@@ -371,3 +372,37 @@ CkReductionMsg * sum_long_double_n(int n, CkReductionMsg ** msgs)
 
 //======================================================================
 
+CkReduction::reducerType r_reduce_tree_type;
+
+void register_reduce_tree(void)
+{ r_reduce_tree_type = CkReduction::addReducer(r_reduce_tree); }
+
+/// Reduce values packed by Block::reduce_tree_start() as
+/// [id_reduce, N, op[0..N), values[0..N)], combining each value
+/// with its own operation (sum, min, or max)
+CkReductionMsg * r_reduce_tree(int n, CkReductionMsg ** msgs)
+{
+  const long double * first = (long double *) msgs[0]->getData();
+  const int N = int(first[1]);
+  const int size = 2 + 2*N;
+
+  std::vector<long double> accum (first, first + size);
+
+  for (int i=1; i<n; i++) {
+
+    ASSERT2("r_reduce_tree()",
+	    "CkReductionMsg actual size %d is different from expected %lu",
+	    msgs[i]->getSize(),size*sizeof(long double),
+	    (msgs[i]->getSize() == size*sizeof(long double)));
+
+    const long double * values = (long double *) msgs[i]->getData();
+
+    for (int k=0; k<N; k++) {
+      const int op = int(accum[2+k]);
+      accum[2+N+k] = ReduceTree::combine(op,accum[2+N+k],values[2+N+k]);
+    }
+  }
+  return CkReductionMsg::buildNew(size*sizeof(long double),accum.data());
+}
+
+//======================================================================
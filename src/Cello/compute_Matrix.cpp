@@ -12,7 +12,8 @@
 
 //----------------------------------------------------------------------
 
-void Matrix::residual (int ir, int ib, int ix, Block * block, int g0) throw()
+void Matrix::residual (int ir, int ib, int ix, Block * block, int g0,
+		       double * rr) throw()
 {
 
   matvec(ir,ix,block);
@@ -24,24 +25,62 @@ void Matrix::residual (int ir, int ib, int ix, Block * block, int g0) throw()
 
   int mx,my,mz;
   field.dimensions(0,&mx,&my,&mz);
+  int gx,gy,gz;
+  field.ghost_depth(0,&gx,&gy,&gz);
 
   int precision = field.precision(0);
 
-  if      (precision == precision_single)    
+  if      (precision == precision_single) {
     residual_((float *)(R), (float *)(B),
 	      mx,my,mz,g0);
-  else if (precision == precision_double)    
+    if (rr) (*rr) += norm2_((float *)(R),mx,my,mz,gx,gy,gz);
+  } else if (precision == precision_double) {
     residual_((double *)(R), (double *)(B),
 	      mx,my,mz,g0);
-  else if (precision == precision_quadruple) 
+    if (rr) (*rr) += norm2_((double *)(R),mx,my,mz,gx,gy,gz);
+  } else if (precision == precision_quadruple) {
     residual_((long double *)(R), (long double *)(B),
 	      mx,my,mz,g0);
-  else 
+    if (rr) (*rr) += norm2_((long double *)(R),mx,my,mz,gx,gy,gz);
+  } else 
     ERROR1("Matrix::residual()", "precision %d not recognized", precision);
 }
 
 //----------------------------------------------------------------------
 
+void Matrix::jacobi (int ix, int ib, int ir, int id, double w,
+		     Block * block, int g0, double * rr) throw()
+{
+  diagonal (id,block,g0);
+  residual (ir,ib,ix,block,g0,rr);
+
+  Field field = block->data()->field();
+
+  void * X = field.values(ix);
+  void * R = field.values(ir);
+  void * D = field.values(id);
+
+  int mx,my,mz;
+  field.dimensions(0,&mx,&my,&mz);
+
+  int precision = field.precision(0);
+
+  if      (precision == precision_single)    
+    jacobi_update_((float *)(X), (float *)(R), (float *)(D), w,
+		   mx,my,mz,g0);
+  else if (precision == precision_double)    
+    jacobi_update_((double *)(X), (double *)(R), (double *)(D), w,
+		   mx,my,mz,g0);
+  else if (precision == precision_quadruple) 
+    jacobi_update_((long double *)(X), (long double *)(R),
+		   (long double *)(D), w,
+		   mx,my,mz,g0);
+  else 
+    ERROR1("Matrix::jacobi()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void Matrix::residual_ (T * r, T * b,
 			int mx, int my, int mz,
@@ -68,5 +107,49 @@ void Matrix::residual_ (T * r, T * b,
     }
   }
 }
+
+//----------------------------------------------------------------------
+
+template <class T>
+void Matrix::jacobi_update_ (T * x, T * r, T * d, double w,
+			     int mx, int my, int mz,
+			     int g0) throw()
+{
+  const int ix0 = (mx > 1) ? g0 : 0;
+  const int iy0 = (my > 1) ? g0 : 0;
+  const int iz0 = (mz > 1) ? g0 : 0;
+
+  for (int iz=iz0; iz<mz-iz0; iz++) {
+    for (int iy=iy0; iy<my-iy0; iy++) {
+      for (int ix=ix0; ix<mx-ix0; ix++) {
+
+	const int i=ix + mx*(iy + my*iz);
+
+	x[i] += w*(r[i] / d[i]);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+double Matrix::norm2_ (T * r,
+		       int mx, int my, int mz,
+		       int gx, int gy, int gz) throw()
+{
+  double sum = 0.0;
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+
+	const int i=ix + mx*(iy + my*iz);
+
+	sum += r[i]*r[i];
+      }
+    }
+  }
+  return sum;
+}
 //======================================================================
 
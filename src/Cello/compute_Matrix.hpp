@@ -35,12 +35,20 @@ public: // interface
     PUP::able::pup(p);
   }
 
-  /// Compute residual R <-- B - A*X
-  void residual (int ir, int ib, int ix, Block * block, int g0=1) throw();
-  
-
 public: // virtual functions
 
+  /// Compute residual R <-- B - A*X.  If rr is not NULL, add the sum
+  /// of R*R over the Block interior to *rr
+  virtual void residual (int ir, int ib, int ix, Block * block, int g0=1,
+			 double * rr = NULL) throw();
+
+  /// Perform one weighted Jacobi sweep X <-- X + w*D^-1*(B - A*X) on
+  /// cells at least g0 from the Block edge, using ir and id as
+  /// temporary fields for R and D.  If rr is not NULL, add the sum of
+  /// R*R over the Block interior (before the update) to *rr
+  virtual void jacobi (int ix, int ib, int ir, int id, double w,
+		       Block * block, int g0=1, double * rr = NULL) throw();
+
   /// Apply the matrix to a vector Y <-- A*X
   virtual void matvec (int iy, int ix, Block * block, int g0=1) throw() = 0;
 
@@ -63,6 +71,16 @@ protected: // functions
 		 int mx, int my, int mz,
 		 int ig0) throw();
 
+  template<class T>
+  void jacobi_update_ (T * x, T * r, T * d, double w,
+		       int mx, int my, int mz,
+		       int g0) throw();
+
+  template<class T>
+  double norm2_ (T * r,
+		 int mx, int my, int mz,
+		 int gx, int gy, int gz) throw();
+
 };
 
 #endif /* COMPUTE_MATRIX_HPP */
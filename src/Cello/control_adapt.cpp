@@ -119,6 +119,16 @@ void Block::adapt_end_()
   for (size_t i=0; i<face_level_last_.size(); i++)
     face_level_last_[i] = -1;
 
+  // neighbors may have changed, so recompute refresh plans
+  for (size_t i=0; i<new_refresh_plan_list_.size(); i++)
+    new_refresh_plan_list_[i].clear();
+
+  // ghost zones may no longer be valid, so refresh before next
+  // Method (the mesh cannot change without refinement)
+  if (cello::config()->mesh_max_level > 0) {
+    std::fill (method_stage_.begin(),method_stage_.end(),0);
+  }
+
   sync_coarsen_.reset();
   sync_coarsen_.set_stop(cello::num_children());
 
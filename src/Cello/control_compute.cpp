@@ -58,11 +58,34 @@ void Block::compute_next_ ()
     CkPrintf ("DEBUG_REFRESH %s:%d calling refresh_[enter|start]\n",__FILE__,__LINE__);
 #endif
 
+    if (method_stage() > 0) {
+
+      // ghost zones are deep enough for this stage, so skip the
+      // refresh but still apply boundary conditions
+
+      is_compute_overlap_ = false;
+
+      update_boundary_();
+
+      CkCallback (CkIndex_Block::p_compute_continue(),
+		  CkArrayIndexIndex(index_),thisProxy).send(NULL);
+
+      return;
+    }
+
     int ir_post = method->refresh_id_post();
     
     cello::refresh(ir_post)->set_active (is_leaf());
     
     new_refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+
+    // compute the interior while ghost zones are in transit: the
+    // refresh callback is always sent as a message, so this
+    // completes before compute_continue_() is called
+
+    is_compute_overlap_ = method->overlap_refresh() && is_scheduled_(method);
+
+    if (is_compute_overlap_) method->compute_interior (this);
     
   } else {
 
@@ -87,12 +110,18 @@ void Block::compute_continue_ ()
 #endif
 
   Method * method = this->method();
-  Schedule * schedule = method->schedule();
-  bool is_scheduled = 
-    (schedule==NULL) ||
-    (schedule->write_this_cycle(cycle_,time_));
 
-  if (is_scheduled) {
+  if (is_compute_overlap_) {
+
+    // interior already computed, so schedule must not be re-checked
+
+    is_compute_overlap_ = false;
+
+    method->compute_boundary (this);
+
+    performance_stop_(perf_compute,__FILE__,__LINE__);
+
+  } else if (is_scheduled_(method)) {
 
     TRACE2 ("Block::compute_continue() method = %d %p\n",
 	    index_method_,method); fflush(stdout);
@@ -111,20 +140,43 @@ void Block::compute_continue_ ()
 
   } else {
 
+    // Method not applied, so its stage does not advance
+
     performance_stop_(perf_compute,__FILE__,__LINE__);
-    compute_done();
+    index_method_++;
+    compute_next_();
 
   }
 }
 
 //----------------------------------------------------------------------
 
+bool Block::is_scheduled_ (Method * method)
+{
+  Schedule * schedule = method->schedule();
+  return (schedule==NULL) || (schedule->write_this_cycle(cycle_,time_));
+}
+
+//----------------------------------------------------------------------
+
 void Block::compute_done ()
 {
 #ifdef DEBUG_COMPUTE
   if (cycle() >= CYCLE)
     CkPrintf ("%d %s DEBUG_COMPUTE Block::compute_done_()\n", CkMyPe(),name().c_str());
 #endif
+
+  // count stages since the Method's last refresh (only reached when
+  // the Method was applied)
+
+  const int stages = method()->stages_per_refresh();
+  if (stages > 1) {
+    if (index_method_ >= int(method_stage_.size())) {
+      method_stage_.resize(index_method_+1,0);
+    }
+    method_stage_[index_method_] = (method_stage_[index_method_] + 1) % stages;
+  }
+
   index_method_++;
   compute_next_();
 }
@@ -156,6 +156,18 @@ void Block::new_refresh_wait (int id_refresh, int callback)
 
   new_refresh_msg_list_[id_refresh].resize(0);
 
+  // copy any faces from Blocks on this PE that started first
+
+  Field field = data()->field();
+  for (auto & face : new_refresh_face_list_[id_refresh]) {
+    Field field_src (cello::field_descr(),face.second);
+    face.first->face_to_face(field_src,field);
+    delete face.first;
+    sync->advance();
+  }
+
+  new_refresh_face_list_[id_refresh].clear();
+
   // and check if we're finished
 
   new_refresh_check_done(id_refresh);
@@ -187,6 +199,11 @@ void Block::new_refresh_check_done (int id_refresh)
 	    id_refresh,new_refresh_msg_list_[id_refresh].size(),
 	    (new_refresh_msg_list_[id_refresh].size() == 0));
 
+    ASSERT2("Block::new_refresh_wait()",
+	   "Refresh %d local face list has size %lu instead of 0",
+	    id_refresh,new_refresh_face_list_[id_refresh].size(),
+	    (new_refresh_face_list_[id_refresh].size() == 0));
+
     // reset sync counter
     sync->reset();
     sync->set_stop(0);
@@ -237,6 +254,64 @@ void Block::p_new_refresh_recv (MsgRefresh * msg)
 
 //----------------------------------------------------------------------
 
+void Block::p_new_refresh_recv_data (int id_refresh, int n, char * data)
+{
+  CHECK_ID(id_refresh);
+  TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"recv data");
+
+  Sync * sync = sync_(id_refresh);
+
+  if (sync->state() == RefreshState::READY) {
+
+    // unpack data directly from the caller's buffer if ready
+    if (n > 0) {
+      DataMsg data_msg;
+      data_msg.load_data(data);
+      data_msg.update(this->data(),false);
+    }
+
+    sync->advance();
+
+    new_refresh_check_done(id_refresh);
+
+  } else {
+
+    // otherwise save a copy as a message, since the buffer is not ours
+    MsgRefresh * msg = new MsgRefresh;
+    msg->set_new_refresh_id (id_refresh);
+    if (n > 0) msg->set_data_copy (data,n);
+
+    new_refresh_msg_list_[id_refresh].push_back(msg);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::new_refresh_send_
+(Index index, int id_refresh, DataMsg * data_msg)
+{
+  // Aggregate data for Blocks on other PEs if requested
+
+  if (cello::config()->performance_aggregate_refresh) {
+    const int ip = thisProxy.ckLocalBranch()->lastKnown
+      (CkArrayIndexIndex(index));
+    if (ip != CkMyPe()) {
+      cello::simulation()->refresh_aggregate_send
+	(ip,index,id_refresh,data_msg);
+      return;
+    }
+  }
+
+  MsgRefresh * msg_refresh = new MsgRefresh;
+
+  msg_refresh->set_data_msg (data_msg);
+  msg_refresh->set_new_refresh_id (id_refresh);
+
+  thisProxy[index].p_new_refresh_recv (msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
 void Block::new_refresh_exit (Refresh & refresh)
 {
   CHECK_ID(refresh.id());
@@ -256,8 +331,30 @@ void Block::new_refresh_exit (Refresh & refresh)
 
 int Block::new_refresh_load_field_faces_ (Refresh & refresh)
 {
-  int count = 0;
+  RefreshPlan & plan = new_refresh_plan_list_[refresh.id()];
+
+  if (! plan.is_field_valid()) {
+    new_refresh_plan_field_faces_ (refresh,plan);
+  }
+
+  for (const auto & face : plan.field_face_list()) {
 
+    // copy since new_refresh_load_field_face_() may modify ic3
+    int if3[3] = { face.if3[0], face.if3[1], face.if3[2] };
+    int ic3[3] = { face.ic3[0], face.ic3[1], face.ic3[2] };
+
+    new_refresh_load_field_face_
+      (refresh,face.refresh_type,face.index,if3,ic3);
+  }
+
+  return plan.field_face_list().size();
+}
+
+//----------------------------------------------------------------------
+
+void Block::new_refresh_plan_field_faces_
+(Refresh & refresh, RefreshPlan & plan)
+{
   const int min_face_rank = refresh.min_face_rank();
   const int neighbor_type = refresh.neighbor_type();
 
@@ -288,8 +385,7 @@ int Block::new_refresh_load_field_faces_ (Refresh & refresh)
 	(level_face == level)     ? refresh_same :
 	(level_face == level + 1) ? refresh_fine : refresh_unknown;
 
-      new_refresh_load_field_face_ (refresh,refresh_type,index_neighbor,if3,ic3);
-      ++count;
+      plan.add_field_face (index_neighbor,if3,ic3,refresh_type);
     }
 
   } else if (neighbor_type == neighbor_level) {
@@ -308,14 +404,13 @@ int Block::new_refresh_load_field_faces_ (Refresh & refresh)
 
 	Index index_face = it_face.index();
 	int ic3[3] = {0,0,0};
-	new_refresh_load_field_face_ (refresh,refresh_same,index_face,if3,ic3);
-	++count;
+	plan.add_field_face (index_face,if3,ic3,refresh_same);
       }
 
     }
   }
 
-  return count;
+  plan.set_field_valid();
 }
 
 //----------------------------------------------------------------------
@@ -334,15 +429,43 @@ void Block::new_refresh_load_field_face_
     index_.child(index_.level(),ic3,ic3+1,ic3+2);
   }
 
-  // ... copy field ghosts to array using FieldFace object
-
-  MsgRefresh * msg_refresh = new MsgRefresh;
-
   bool lg3[3] = {false,false,false};
 
   FieldFace * field_face = create_face
     (if3, ic3, lg3, refresh_type, &refresh,false);
 
+  const int id_refresh = refresh.id();
+  CHECK_ID(id_refresh);
+
+  // ... if the neighbor is on this PE, copy field faces directly to
+  // its ghost zones if it is ready, or else leave the FieldFace for
+  // it to copy when it starts this refresh.  In either case our
+  // field values are unchanged until the neighbor's copy is counted,
+  // since we cannot complete this refresh before the neighbor starts
+
+  Block * block_neighbor = thisProxy[index_neighbor].ckLocal();
+
+  if (block_neighbor != nullptr) {
+
+    TRACE_NEW_REFRESH(this,(&refresh),"copy local");
+
+    Sync * sync_neighbor = block_neighbor->sync_(id_refresh);
+
+    if (sync_neighbor->state() == RefreshState::READY) {
+      field_face->face_to_face(data()->field(),
+			       block_neighbor->data()->field());
+      delete field_face;
+      sync_neighbor->advance();
+      block_neighbor->new_refresh_check_done(id_refresh);
+    } else {
+      block_neighbor->new_refresh_face_list_[id_refresh].push_back
+	(std::make_pair(field_face,data()->field_data()));
+    }
+    return;
+  }
+
+  // ... copy field ghosts to array using FieldFace object
+
   DataMsg * data_msg = new DataMsg;
 #ifdef DEBUG_NEW_REFRESH
   CkPrintf ("%d %s:%d DEBUG_REFRESH %p new DataMsg\n",
@@ -351,18 +474,13 @@ void Block::new_refresh_load_field_face_
   data_msg -> set_field_face (field_face,true);
   data_msg -> set_field_data (data()->field_data(),false);
 
-  const int id_refresh = refresh.id();
-  CHECK_ID(id_refresh);
-
   ASSERT1 ("Block::new_refresh_load_field_face_()",
 	  "id_refresh %d of refresh object is out of range",
 	   id_refresh,
 	   (0 <= id_refresh));
-  msg_refresh->set_new_refresh_id (id_refresh);
-  msg_refresh->set_data_msg (data_msg);
 
   TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"send");
-  thisProxy[index_neighbor].p_new_refresh_recv (msg_refresh);
+  new_refresh_send_ (index_neighbor,id_refresh,data_msg);
 
 }
 
@@ -498,24 +616,15 @@ void Block::new_particle_send_
 #endif
       data_msg ->set_particle_data(p_data,true);
 
-      MsgRefresh * msg_refresh = new MsgRefresh;
-      msg_refresh->set_data_msg (data_msg);
-      msg_refresh->set_new_refresh_id (id_refresh);
-
-      thisProxy[index].p_new_refresh_recv (msg_refresh);
+      new_refresh_send_ (index,id_refresh,data_msg);
 
     } else if (p_data) {
 
-      MsgRefresh * msg_refresh = new MsgRefresh;
-
-      msg_refresh->set_data_msg (nullptr);
 #ifdef DEBUG_NEW_REFRESH
       CkPrintf ("%d %s:%d DEBUG_REFRESH set data_msg=NULL\n",
                 CkMyPe(),__FILE__,__LINE__);
 #endif
-      msg_refresh->set_new_refresh_id (id_refresh);
-
-      thisProxy[index].p_new_refresh_recv (msg_refresh);
+      new_refresh_send_ (index,id_refresh,nullptr);
 
       // assert ParticleData object exits but has no particles
       delete p_data;
@@ -932,8 +1041,30 @@ void Block::particle_scatter_neighbors_
 
 int Block::new_refresh_load_flux_faces_ (Refresh & refresh)
 {
-  int count = 0;
+  RefreshPlan & plan = new_refresh_plan_list_[refresh.id()];
+
+  if (! plan.is_flux_valid()) {
+    new_refresh_plan_flux_faces_ (refresh,plan);
+  }
+
+  for (const auto & face : plan.flux_face_list()) {
+
+    // copy since new_refresh_load_flux_face_() may modify ic3
+    int if3[3] = { face.if3[0], face.if3[1], face.if3[2] };
+    int ic3[3] = { face.ic3[0], face.ic3[1], face.ic3[2] };
+
+    new_refresh_load_flux_face_
+      (refresh,face.refresh_type,face.index,if3,ic3);
+  }
+
+  return plan.flux_face_list().size();
+}
 
+//----------------------------------------------------------------------
+
+void Block::new_refresh_plan_flux_faces_
+(Refresh & refresh, RefreshPlan & plan)
+{
   const int min_face_rank = cello::rank() - 1;
   const int neighbor_type = neighbor_leaf;
 
@@ -960,14 +1091,10 @@ int Block::new_refresh_load_flux_faces_ (Refresh & refresh)
       (level_face < level) ? refresh_coarse :
       (level_face > level) ? refresh_fine : refresh_same;
 
-    new_refresh_load_flux_face_
-      (refresh,refresh_type,index_neighbor,if3,ic3);
-
-    ++count;
-
+    plan.add_flux_face (index_neighbor,if3,ic3,refresh_type);
   }
 
-  return count;
+  plan.set_flux_valid();
 }
 
 //----------------------------------------------------------------------
@@ -1019,12 +1146,7 @@ void Block::new_refresh_load_flux_face_
            id_refresh,
            (0 <= id_refresh));
 
-  MsgRefresh * msg_refresh = new MsgRefresh;
-
-  msg_refresh->set_data_msg (data_msg);
-  msg_refresh->set_new_refresh_id (id_refresh);
-
   TRACE_NEW_REFRESH(this,cello::refresh(id_refresh),"send");
-  thisProxy[index_neighbor].p_new_refresh_recv (msg_refresh);
+  new_refresh_send_ (index_neighbor,id_refresh,data_msg);
 
 }
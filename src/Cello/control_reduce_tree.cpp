@@ -0,0 +1,259 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     control_reduce_tree.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Asynchronous reductions over the mesh tree
+/// @ingroup  Control
+///
+///    Block::reduce_tree_start()
+///       leaf (or root-level) Blocks contribute their own values
+///       Blocks combine values from self and children
+///       >>>>> p_reduce_tree_up() >>>>> parent
+///       root-level Blocks combine values along a binary tree (global)
+///       <<<<< p_reduce_tree_down() <<<<< parent
+///       call entry_point
+///
+/// Unlike CkReduction, this only involves Blocks at or above the
+/// given root level, values are accumulated in long double
+/// precision, and Blocks may continue with local work while the
+/// reduction is in progress.
+///
+/// Global reductions that include every Block use a CkReduction
+/// with the r_reduce_tree reducer instead, unless the
+/// Performance:reduce_tree parameter is true, since the tree has
+/// not yet been shown to be faster at scale.
+///
+///    Block::reduce_tree_start()
+///       >>>>> contribute() >>>>>
+///    Block::r_reduce_tree()
+///       call entry_point
+
+#include "simulation.hpp"
+#include "mesh.hpp"
+#include "control.hpp"
+
+#include "charm_simulation.hpp"
+#include "charm_mesh.hpp"
+
+// #define DEBUG_REDUCE_TREE
+
+#ifdef DEBUG_REDUCE_TREE
+# define TRACE_REDUCE_TREE(A)						\
+  CkPrintf ("%d %s %s TRACE_REDUCE_TREE %s id %d\n",			\
+	    CkMyPe(),__FILE__,name_.c_str(), A,id_reduce);		\
+  fflush(stdout);
+#else
+# define TRACE_REDUCE_TREE(A) ;
+#endif
+
+//----------------------------------------------------------------------
+
+void Block::reduce_tree_start
+(int id_reduce, int entry_point,
+ int n, const long double * values, const int * op,
+ int root_level, bool global)
+{
+  TRACE_REDUCE_TREE("reduce_tree_start");
+
+  ReduceTree & reduce = reduce_tree_(id_reduce);
+
+  if (level() < root_level) {
+    // not included in the reduction
+    std::vector<long double> zero(n,0.0);
+    reduce.set_result(n,zero.data());
+    CkCallback(entry_point,CkArrayIndexIndex(index_),thisProxy).send(NULL);
+    return;
+  }
+
+  ASSERT1 ("Block::reduce_tree_start()",
+	   "root_level %d must be <= 0 for global reductions",
+	   root_level, (! global || root_level <= 0));
+
+  if (global && ! cello::config()->performance_reduce_tree &&
+      root_level <= cello::config()->mesh_min_level) {
+
+    // All Blocks contribute: use a CkReduction over the Block array,
+    // packing values as [id_reduce, n, op[0..n), values[0..n)]
+
+    reduce.start(entry_point,root_level,global,0);
+
+    std::vector<long double> data(2 + 2*n);
+    data[0] = id_reduce;
+    data[1] = n;
+    for (int i=0; i<n; i++) {
+      data[2+i]   = op[i];
+      data[2+n+i] = values[i];
+    }
+    CkCallback callback (CkIndex_Block::r_reduce_tree(NULL), thisProxy);
+    contribute (data.size()*sizeof(long double), data.data(),
+		r_reduce_tree_type, callback);
+    return;
+  }
+
+  // Count contributions from self, children, and root-level children
+
+  int stop = 1;
+
+  if (! is_leaf()) stop += cello::num_children();
+
+  if (global && level() == root_level) {
+    int num_root, i_root, na3[3];
+    reduce_tree_root_(root_level,&num_root,&i_root,na3);
+    for (int k=0; k<2; k++) {
+      if (ReduceTree::root_child(i_root,k,num_root) >= 0) ++stop;
+    }
+  }
+
+  reduce.start(entry_point,root_level,global,stop);
+
+  // copy values since reduce_tree_up_() accepts message data
+
+  std::vector<long double> value_array(values,values+n);
+  std::vector<int>         op_array   (op,op+n);
+
+  reduce_tree_up_(id_reduce,n,value_array.data(),op_array.data());
+}
+
+//----------------------------------------------------------------------
+
+void Block::reduce_tree_up_
+(int id_reduce, int n, long double * values, int * op)
+{
+  TRACE_REDUCE_TREE("reduce_tree_up");
+
+  ReduceTree & reduce = reduce_tree_(id_reduce);
+
+  if (! reduce.accumulate(n,values,op)) return;
+
+  // All contributions received: send to parent, or to the
+  // root-level parent if global, or else begin sending values down
+
+  const int root_level = reduce.root_level();
+  const int n_reduce   = reduce.size();
+
+  std::vector<long double> value_array(reduce.values(),
+				       reduce.values()+n_reduce);
+  std::vector<int>         op_array   (reduce.op(),
+				       reduce.op()+n_reduce);
+  reduce.clear();
+
+  if (level() > root_level) {
+
+    const int min_level = cello::config()->mesh_min_level;
+    Index index_parent = index_.index_parent(min_level);
+    thisProxy[index_parent].p_reduce_tree_up
+      (id_reduce,n_reduce,value_array.data(),op_array.data());
+
+  } else {
+
+    int num_root=1, i_root=0, na3[3];
+    if (reduce.global()) reduce_tree_root_(root_level,&num_root,&i_root,na3);
+
+    const int j_root = ReduceTree::root_parent(i_root);
+    if (j_root >= 0) {
+      Index index_root = reduce_tree_root_index_(root_level,j_root,na3);
+      thisProxy[index_root].p_reduce_tree_up
+	(id_reduce,n_reduce,value_array.data(),op_array.data());
+    } else {
+      reduce_tree_down_(id_reduce,n_reduce,value_array.data());
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::reduce_tree_down_
+(int id_reduce, int n, const long double * values)
+{
+  TRACE_REDUCE_TREE("reduce_tree_down");
+
+  ReduceTree & reduce = reduce_tree_(id_reduce);
+
+  reduce.set_result(n,values);
+
+  std::vector<long double> value_array(values,values+n);
+
+  // send to root-level children if global
+
+  const int root_level = reduce.root_level();
+
+  if (reduce.global() && level() == root_level) {
+    int num_root, i_root, na3[3];
+    reduce_tree_root_(root_level,&num_root,&i_root,na3);
+    for (int k=0; k<2; k++) {
+      const int j_root = ReduceTree::root_child(i_root,k,num_root);
+      if (j_root >= 0) {
+	Index index_root = reduce_tree_root_index_(root_level,j_root,na3);
+	thisProxy[index_root].p_reduce_tree_down
+	  (id_reduce,n,value_array.data());
+      }
+    }
+  }
+
+  // send to children
+
+  if (! is_leaf()) {
+    const int min_level = cello::config()->mesh_min_level;
+    ItChild it_child(cello::rank());
+    int ic3[3];
+    while (it_child.next(ic3)) {
+      Index index_child = index_.index_child(ic3,min_level);
+      thisProxy[index_child].p_reduce_tree_down
+	(id_reduce,n,value_array.data());
+    }
+  }
+
+  CkCallback(reduce.entry_point(),
+	     CkArrayIndexIndex(index_),thisProxy).send(NULL);
+}
+
+//----------------------------------------------------------------------
+
+void Block::r_reduce_tree (CkReductionMsg * msg)
+{
+  performance_start_(perf_control);
+
+  const long double * data = (long double *) msg->getData();
+  const int id_reduce = int(data[0]);
+  const int n         = int(data[1]);
+
+  TRACE_REDUCE_TREE("r_reduce_tree");
+
+  ReduceTree & reduce = reduce_tree_(id_reduce);
+  reduce.set_result(n,data+2+n);
+  delete msg;
+
+  CkCallback(reduce.entry_point(),
+	     CkArrayIndexIndex(index_),thisProxy).send(NULL);
+
+  performance_stop_(perf_control);
+}
+
+//----------------------------------------------------------------------
+
+void Block::reduce_tree_root_
+(int root_level, int * num_root, int * i_root, int na3[3]) const
+{
+  int nb3[3];
+  cello::hierarchy()->root_blocks(nb3,nb3+1,nb3+2);
+  ReduceTree::root_count(root_level,nb3,na3);
+
+  int a3[3];
+  index_.array(a3,a3+1,a3+2);
+
+  (*num_root) = na3[0]*na3[1]*na3[2];
+  (*i_root)   = ReduceTree::root_position(root_level,a3,na3);
+}
+
+//----------------------------------------------------------------------
+
+Index Block::reduce_tree_root_index_
+(int root_level, int i_root, const int na3[3]) const
+{
+  int a3[3];
+  ReduceTree::root_array(root_level,i_root,na3,a3);
+
+  Index index (a3[0],a3[1],a3[2]);
+  index.set_level(root_level);
+  return index;
+}
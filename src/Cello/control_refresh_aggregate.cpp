@@ -0,0 +1,163 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     control_refresh_aggregate.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Aggregation of refresh data sent to Blocks on other PEs
+/// @ingroup  Control
+///
+///    Block::new_refresh_send_()
+///       Simulation::refresh_aggregate_send()
+///          append [index,id_refresh,size] header and DataMsg data
+///          to the buffer for the destination PE
+///       Simulation::refresh_aggregate_flush()
+///          when the buffer exceeds Performance:aggregate_refresh_bytes,
+///          or when this PE becomes idle
+///       >>>>> p_refresh_aggregate_recv() >>>>> destination PE
+///       Block::p_new_refresh_recv_data() for each entry
+///
+/// Each DataMsg is serialized directly into the destination buffer,
+/// and entries for Blocks on the receiving PE are unpacked directly
+/// from the received buffer.  Entries for Blocks that have since
+/// migrated are forwarded individually.
+
+#include "simulation.hpp"
+#include "mesh.hpp"
+#include "control.hpp"
+
+#include "charm_simulation.hpp"
+#include "charm_mesh.hpp"
+
+// #define DEBUG_REFRESH_AGGREGATE
+
+/// Length in ints of the header preceding each entry
+#define REFRESH_AGGREGATE_HEADER 6
+
+/// Alignment in bytes of each entry in the buffer
+#define REFRESH_AGGREGATE_ALIGN 8
+
+//----------------------------------------------------------------------
+
+static void refresh_aggregate_idle (void * simulation, double)
+{
+  ((Simulation *) simulation)->refresh_aggregate_flush();
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::refresh_aggregate_send
+(int ip, Index index, int id_refresh, DataMsg * data_msg)
+{
+  const int size = (data_msg) ? data_msg->data_size() : 0;
+
+  char * buffer = refresh_aggregate_reserve_ (ip,index,id_refresh,size);
+
+  if (data_msg) {
+    data_msg->save_data(buffer);
+    delete data_msg;
+  }
+
+  // send immediately if the buffer is full, else when idle
+
+  if (int(refresh_aggregate_buffer_[ip].size()) >=
+      config_->performance_aggregate_refresh_bytes) {
+
+    refresh_aggregate_flush();
+
+  } else if (! refresh_aggregate_flush_pending_) {
+
+    refresh_aggregate_flush_pending_ = true;
+    CcdCallOnCondition
+      (CcdPROCESSOR_BEGIN_IDLE,refresh_aggregate_idle,this);
+  }
+}
+
+//----------------------------------------------------------------------
+
+char * Simulation::refresh_aggregate_reserve_
+(int ip, Index index, int id_refresh, int size)
+{
+  if (refresh_aggregate_buffer_.size() == 0) {
+    refresh_aggregate_buffer_.resize(CkNumPes());
+  }
+
+  std::vector<char> & buffer = refresh_aggregate_buffer_[ip];
+
+  if (buffer.size() == 0) refresh_aggregate_pe_list_.push_back(ip);
+
+  // pad data so the next header is aligned
+
+  const int size_pad = REFRESH_AGGREGATE_ALIGN *
+    ((size + REFRESH_AGGREGATE_ALIGN - 1) / REFRESH_AGGREGATE_ALIGN);
+
+  const size_t offset = buffer.size();
+
+  buffer.resize(offset + sizeof(int)*REFRESH_AGGREGATE_HEADER + size_pad);
+
+  int * header = (int *) (buffer.data() + offset);
+
+  int v3[3];
+  index.values(v3);
+  header[0] = v3[0];
+  header[1] = v3[1];
+  header[2] = v3[2];
+  header[3] = id_refresh;
+  header[4] = size;
+  header[5] = size_pad;
+
+  return (char *) (header + REFRESH_AGGREGATE_HEADER);
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::refresh_aggregate_flush()
+{
+  for (size_t i=0; i<refresh_aggregate_pe_list_.size(); i++) {
+    const int ip = refresh_aggregate_pe_list_[i];
+    std::vector<char> & buffer = refresh_aggregate_buffer_[ip];
+#ifdef DEBUG_REFRESH_AGGREGATE
+    CkPrintf ("%d DEBUG_REFRESH_AGGREGATE flush %lu bytes to %d\n",
+	      CkMyPe(),buffer.size(),ip);
+#endif
+    if (buffer.size() > 0) {
+      thisProxy[ip].p_refresh_aggregate_recv (buffer.size(),buffer.data());
+      buffer.clear();
+    }
+  }
+  refresh_aggregate_pe_list_.clear();
+
+  // A pending idle callback still fires, but finds nothing to send
+  refresh_aggregate_flush_pending_ = false;
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_refresh_aggregate_recv (int n, char * buffer)
+{
+  CProxy_Block block_array = hierarchy_->block_array();
+
+  char * pc = buffer;
+
+  while (pc < buffer + n) {
+
+    const int * header = (const int *) pc;
+
+    Index index;
+    index.set_values(header);
+    const int id_refresh = header[3];
+    const int size       = header[4];
+    const int size_pad   = header[5];
+
+    char * data = pc + sizeof(int)*REFRESH_AGGREGATE_HEADER;
+
+    Block * block = block_array[index].ckLocal();
+
+    if (block != nullptr) {
+      block->p_new_refresh_recv_data (id_refresh,size,data);
+    } else {
+      // Block has moved or is not yet created: let Charm++ route it
+      block_array[index].p_new_refresh_recv_data (id_refresh,size,data);
+    }
+
+    pc = data + size_pad;
+  }
+}
@@ -12,7 +12,7 @@
 ///       update_boundary_()
 ///       compute dt
 ///       compute stopping
-///       contribute( >>>>> Block::r_output() >>>>> )
+///       reduce_tree_start( >>>>> Block::p_stopping_compute_timestep() >>>>> )
 
 #include "simulation.hpp"
 #include "mesh.hpp"
@@ -91,20 +91,19 @@ void Block::stopping_begin_()
     int stop_block = stopping->complete(cycle_,time_);
 
     // Reduce to find Block array minimum dt and stopping criteria
+    // over the mesh tree, rooted at the coarsest level
 
-    double min_reduce[2];
+    long double min_reduce[2];
 
     min_reduce[0] = dt_block;
     min_reduce[1] = stop_block ? 1.0 : 0.0;
 
-    CkCallback callback (CkIndex_Block::r_stopping_compute_timestep(NULL),
-			 thisProxy);
+    const int min_level = cello::config()->mesh_min_level;
 
-#ifdef TRACE_CONTRIBUTE    
-    CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
-	      name().c_str(),__FILE__,__LINE__); fflush(stdout);
-#endif    
-    contribute(2*sizeof(double), min_reduce, CkReduction::min_double, callback);
+    reduce_tree_start
+      (reduce_id_stopping,
+       CkIndex_Block::p_stopping_compute_timestep(),
+       2, min_reduce, reduce_tree_min, min_level, true);
 
   } else {
 
@@ -116,21 +115,20 @@ void Block::stopping_begin_()
 
 //----------------------------------------------------------------------
 
-void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
+void Block::p_stopping_compute_timestep()
 {
   performance_start_(perf_stopping);
   
-  TRACE_STOPPING("Block::r_stopping_compute_timestep");
+  TRACE_STOPPING("Block::p_stopping_compute_timestep");
   
   ++age_;
 
-  double * min_reduce = (double * )msg->getData();
+  const std::vector<long double> & min_reduce =
+    reduce_tree_result(reduce_id_stopping);
 
   dt_   = min_reduce[0];
   stop_ = min_reduce[1] == 1.0 ? true : false;
 
-  delete msg;
-
   Simulation * simulation = cello::simulation();
 
   dt_ *= Method::courant_global;
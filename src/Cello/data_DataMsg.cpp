@@ -23,10 +23,8 @@ int DataMsg::data_size () const
   //  1. determine buffer size (must be consistent with #3)
   //--------------------------------------------------
 
-  Field field (cello::field_descr(), field_data_);
-
   const int n_ff = (ff) ? ff->data_size() : 0;
-  const int n_fa = (ff) ? ff->num_bytes_array(field) : 0;
+  const int n_fa = (ff) ? field_array_size_get_() : 0;
   const int n_pd = (pd) ? pd->data_size(cello::particle_descr()) : 0;
   const int n_fd = fd.size();
 
@@ -50,6 +48,21 @@ int DataMsg::data_size () const
 
 //----------------------------------------------------------------------
 
+int DataMsg::field_array_size_get_ () const
+{
+  // The field array size depends only on the FieldFace and field
+  // descriptions, but is needed both to size the message buffer and
+  // to serialize into it
+
+  if (field_array_size_ < 0) {
+    Field field (cello::field_descr(), field_data_);
+    field_array_size_ = field_face_->num_bytes_array(field);
+  }
+  return field_array_size_;
+}
+
+//----------------------------------------------------------------------
+
 char * DataMsg::save_data (char * buffer) const
 {
   union {
@@ -66,7 +79,7 @@ char * DataMsg::save_data (char * buffer) const
   auto & fd = face_fluxes_list_;
 
   const int n_ff = (ff) ? ff->data_size() : 0;
-  const int n_fa = (ff) ? ff->num_bytes_array(field) : 0;
+  const int n_fa = (ff) ? field_array_size_get_() : 0;
   const int n_pa = (pd) ? pd->data_size(cello::particle_descr()) : 0;
   const int n_fd = fd.size();
 
@@ -27,7 +27,8 @@ public: // interface
       particle_data_(nullptr),
       particle_data_delete_(false),
       face_fluxes_list_(),
-      face_fluxes_delete_()
+      face_fluxes_delete_(),
+      field_array_size_(-1)
   {
     ++counter[cello::index_static()]; 
   }
@@ -89,6 +90,7 @@ public: // interface
   {
     field_face_ = field_face; 
     field_face_delete_ = is_new;
+    field_array_size_ = -1;
   }
 
   /// Return the serialized FieldFace array
@@ -105,6 +107,7 @@ public: // interface
   {
     field_data_ = field_data;
     field_data_delete_ = is_new;
+    field_array_size_ = -1;
   }
 
   /// --------------------
@@ -200,6 +203,12 @@ public: // interface
 public: // static methods
 
   
+protected: // functions
+
+  /// Return the number of bytes in the serialized field array,
+  /// computing it only on the first call
+  int field_array_size_get_ () const;
+
 protected: // attributes
 
   /// Field Face Data
@@ -231,6 +240,9 @@ protected: // attributes
   /// Whether Flux data should be deleted in destructor
   std::vector<bool> face_fluxes_delete_;
 
+  /// Cached size of the serialized field array, or -1 if unknown
+  mutable int field_array_size_;
+
 };
 
 #endif /* DATA_DATA_MSG_HPP */
@@ -158,6 +158,7 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
   size_t index_array = 0;
 
   std::vector <int> field_list = field_list_src_(field);
+  std::vector <int> field_list_dst = field_list_dst_(field);
 
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -175,8 +176,8 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
+    int index_src = field_list[i_f];
+    int index_dst = field_list_dst[i_f];
     const bool accumulate = accumulate_(index_src,index_dst);
 
     int i3[3], n3[3];
@@ -238,6 +239,7 @@ void FieldFace::array_to_face (char * array, Field field) throw()
   size_t index_array = 0;
 
   std::vector<int> field_list = field_list_dst_(field);
+  std::vector<int> field_list_src = field_list_src_(field);
   
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -255,8 +257,8 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
+    int index_src = field_list_src[i_f];
+    int index_dst = field_list[i_f];
     const bool accumulate = accumulate_(index_src,index_dst);
 
     int i3[3], n3[3];
@@ -431,6 +433,7 @@ int FieldFace::num_bytes_array(Field field) throw()
   int array_size = 0;
 
   std::vector<int> field_list = field_list_src_(field);
+  std::vector<int> field_list_dst = field_list_dst_(field);
 
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -445,8 +448,8 @@ int FieldFace::num_bytes_array(Field field) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
+    int index_src = field_list[i_f];
+    int index_dst = field_list_dst[i_f];
     const bool accumulate = accumulate_(index_src,index_dst);
     int op_type = (refresh_type_ == refresh_fine) ? op_load : op_store;
 
@@ -63,6 +63,7 @@ Block::Block ( MsgRefine * msg )
     sync_coarsen_(),
     sync_count_(),
     sync_max_(),
+    reduce_tree_list_(),
     face_level_curr_(),
     face_level_next_(),
     child_face_level_curr_(),
@@ -77,6 +78,8 @@ Block::Block ( MsgRefine * msg )
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    is_compute_overlap_(false),
+    method_stage_(),
     index_solver_(),
     refresh_()
 {
@@ -135,6 +138,7 @@ Block::Block ( process_type ip_source )
     sync_coarsen_(),
     sync_count_(),
     sync_max_(),
+    reduce_tree_list_(),
     face_level_curr_(),
     face_level_next_(),
     child_face_level_curr_(),
@@ -149,6 +153,8 @@ Block::Block ( process_type ip_source )
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    is_compute_overlap_(false),
+    method_stage_(),
     index_solver_(),
     refresh_()
 {
@@ -410,6 +416,7 @@ void Block::pup(PUP::er &p)
   p | sync_coarsen_;
   p | sync_count_;
   p | sync_max_;
+  p | reduce_tree_list_;
   p | face_level_curr_;
   p | face_level_next_;
   p | child_face_level_curr_;
@@ -424,6 +431,8 @@ void Block::pup(PUP::er &p)
   p | face_level_last_;
   p | name_;
   p | index_method_;
+  p | is_compute_overlap_;
+  p | method_stage_;
   p | index_solver_;
   p | refresh_;
   // SKIP method_: initialized when needed
@@ -719,6 +728,7 @@ Block::Block ()
     sync_coarsen_(),
     sync_count_(),
     sync_max_(),
+    reduce_tree_list_(),
     face_level_curr_(),
     face_level_next_(),
     child_face_level_curr_(),
@@ -733,6 +743,8 @@ Block::Block ()
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    is_compute_overlap_(false),
+    method_stage_(),
     index_solver_(),
     refresh_()
 {
@@ -757,6 +769,7 @@ Block::Block (CkMigrateMessage *m)
     sync_coarsen_(),
     sync_count_(),
     sync_max_(),
+    reduce_tree_list_(),
     face_level_curr_(),
     face_level_next_(),
     child_face_level_curr_(),
@@ -771,6 +784,8 @@ Block::Block (CkMigrateMessage *m)
     face_level_last_(),
     name_(""),
     index_method_(-1),
+    is_compute_overlap_(false),
+    method_stage_(),
     index_solver_(),
     refresh_()
     
@@ -800,6 +815,8 @@ void Block::init_new_refresh_()
 #endif  
   new_refresh_sync_list_.resize(count);
   new_refresh_msg_list_.resize(count);
+  new_refresh_face_list_.resize(count);
+  new_refresh_plan_list_.resize(count);
   for (int i=0; i<count; i++) {
     new_refresh_sync_list_[i].reset();
   }
@@ -309,6 +309,14 @@ public: // interface
   /// Return the currently-active Method
   Method * method () throw();
 
+  /// Return the number of times the currently-active Method has been
+  /// applied since its ghost zones were last refreshed
+  int method_stage() const throw()
+  {
+    return (index_method_ < int(method_stage_.size())) ?
+      method_stage_[index_method_] : 0;
+  }
+
   /// Start a new solver
   void push_solver(int index_solver) throw()
   {
@@ -350,6 +358,8 @@ protected: // methods
   void compute_continue_();
   /// Cleanup after all Methods have been applied
   void compute_end_();
+  /// Whether the Method is scheduled to be applied this cycle
+  bool is_scheduled_(Method * method);
   /// Exit control compute phase
   void compute_exit_();
 
@@ -545,6 +555,82 @@ public:
   void control_sync_quiescence (int entry_point);
   void control_sync_count    (int entry_point, int id, int count);
 
+public:
+
+  //--------------------------------------------------
+  // TREE REDUCTION
+  //--------------------------------------------------
+
+  /// Begin an asynchronous reduction of n values over the Blocks in
+  /// levels >= root_level, combining values using op[i].  Values are
+  /// combined up the mesh tree to the Blocks in root_level, and if
+  /// global is true then also across all Blocks in root_level (which
+  /// must be <= 0).  The reduced values are sent back down the tree,
+  /// and entry_point is called on each Block when they are available
+  /// from reduce_tree_result().  Blocks below root_level call
+  /// entry_point immediately with zero values.  Global reductions
+  /// over all Blocks use a CkReduction unless Performance:reduce_tree
+  /// is true.
+  void reduce_tree_start (int id_reduce, int entry_point,
+                          int n, const long double * values, const int * op,
+                          int root_level, bool global);
+
+  /// Begin a reduction using the same operation for all values
+  void reduce_tree_start (int id_reduce, int entry_point,
+                          int n, const long double * values, int op,
+                          int root_level, bool global)
+  {
+    std::vector<int> op_array(n,op);
+    reduce_tree_start (id_reduce,entry_point,n,values,op_array.data(),
+                       root_level,global);
+  }
+
+  /// Return the reduced values of the last completed reduction
+  const std::vector<long double> & reduce_tree_result (int id_reduce)
+  { return reduce_tree_(id_reduce).result(); }
+
+  /// Receive combined values from a child (or root-level) Block
+  void p_reduce_tree_up (int id_reduce, int n, long double * values, int * op)
+  {
+    performance_start_(perf_control);
+    reduce_tree_up_(id_reduce,n,values,op);
+    performance_stop_(perf_control);
+  }
+
+  /// Receive reduced values from the parent (or root-level) Block
+  void p_reduce_tree_down (int id_reduce, int n, long double * values)
+  {
+    performance_start_(perf_control);
+    reduce_tree_down_(id_reduce,n,values);
+    performance_stop_(perf_control);
+  }
+
+  /// Receive reduced values from a CkReduction over the Block array,
+  /// used for global reductions unless Performance:reduce_tree is set
+  void r_reduce_tree (CkReductionMsg * msg);
+
+protected:
+
+  /// Return the ReduceTree object for the given id, creating it if needed
+  ReduceTree & reduce_tree_ (int id_reduce)
+  {
+    if (id_reduce >= int(reduce_tree_list_.size()))
+      reduce_tree_list_.resize(id_reduce + 1);
+    return reduce_tree_list_[id_reduce];
+  }
+
+  void reduce_tree_up_   (int id_reduce, int n, long double * values, int * op);
+  void reduce_tree_down_ (int id_reduce, int n, const long double * values);
+
+  /// Number of root-level Blocks in a global reduction and the
+  /// position of this Block among them
+  void reduce_tree_root_ (int root_level, int * num_root, int * i_root,
+                          int na3[3]) const;
+
+  /// Index of the i'th root-level Block in a global reduction
+  Index reduce_tree_root_index_ (int root_level, int i_root,
+                                 const int na3[3]) const;
+
 public:
 
   //--------------------------------------------------
@@ -564,6 +650,10 @@ public:
   /// Receive a Refresh data message from an adjacent Block
   void p_new_refresh_recv (MsgRefresh * msg);
 
+  /// Receive serialized DataMsg data for a Refresh that was sent in
+  /// an aggregated buffer (see Simulation::p_refresh_aggregate_recv())
+  void p_new_refresh_recv_data (int id_refresh, int n, char * data);
+
   int new_refresh_load_field_faces_ (Refresh & refresh);
   /// Scatter particles in ghost zones to neighbors
   int new_refresh_load_particle_faces_ (Refresh & refresh, const bool copy = false);
@@ -582,6 +672,19 @@ public:
   void new_refresh_load_flux_face_
   (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
 
+  /// Compute the neighbor faces for sending field data in the given
+  /// Refresh, which are cached until the mesh next adapts
+  void new_refresh_plan_field_faces_ (Refresh & refresh, RefreshPlan & plan);
+
+  /// Compute the neighbor faces for sending flux data in the given
+  /// Refresh, which are cached until the mesh next adapts
+  void new_refresh_plan_flux_faces_ (Refresh & refresh, RefreshPlan & plan);
+
+  /// Send DataMsg refresh data (may be NULL) to the Block at index,
+  /// either in its own MsgRefresh or aggregated with other data for
+  /// the same PE
+  void new_refresh_send_ (Index index, int id_refresh, DataMsg * data_msg);
+
   void new_refresh_exit (Refresh & refresh);
 
   /// Enter the refresh phase after synchronizing
@@ -619,7 +722,7 @@ public:
   void p_refresh_child (int n, char a[],int ic3[3]);
 
   void p_method_flux_correct_refresh();
-  void r_method_flux_correct_sum_fields(CkReductionMsg * msg);
+  void p_method_flux_correct_sum_fields();
   void r_method_debug_sum_fields(CkReductionMsg * msg);
 
 protected:
@@ -687,8 +790,9 @@ protected:
   //--------------------------------------------------
 
 public:
-  /// Entry method after begin_stopping() to call Simulation::r_stopping()
-  void r_stopping_compute_timestep(CkReductionMsg * msg);
+  /// Entry method after begin_stopping() when the minimum timestep
+  /// and stopping criteria have been reduced
+  void p_stopping_compute_timestep();
 
   /// Enter the stopping phase
   void p_stopping_enter ()
@@ -994,6 +1098,9 @@ protected: // attributes
   std::vector<int>  sync_count_;
   std::vector<int>  sync_max_;
 
+  /// Tree reduction states for reduce_tree_start()
+  std::vector<ReduceTree> reduce_tree_list_;
+
   /// current level of neighbors along each face
   std::vector<int> face_level_curr_;
 
@@ -1037,6 +1144,14 @@ protected: // attributes
   /// Index of currently-active Method
   int index_method_;
 
+  /// Whether the current Method's compute_interior() has been called
+  /// while its refresh is in progress
+  bool is_compute_overlap_;
+
+  /// Number of times each Method has been applied since its last
+  /// refresh (see Method::stages_per_refresh())
+  std::vector<int> method_stage_;
+
   /// Stack of currently active solvers
   std::vector<int> index_solver_;
 
@@ -1047,6 +1162,14 @@ protected: // attributes
   std::vector < Sync > new_refresh_sync_list_;
   std::vector < std::vector <MsgRefresh * > > new_refresh_msg_list_;
 
+  /// Field faces left by Blocks on the same PE that started a refresh
+  /// before this Block, with the source FieldData to copy from
+  std::vector < std::vector < std::pair<FieldFace *, FieldData *> > >
+  new_refresh_face_list_;
+
+  /// Cached neighbor faces for each Refresh, cleared in adapt_end_()
+  std::vector < RefreshPlan > new_refresh_plan_list_;
+
 };
 
 #endif /* COMM_BLOCK_HPP */
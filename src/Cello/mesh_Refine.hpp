@@ -81,6 +81,31 @@ protected: // functions
     }
   }
 
+  /// Call evaluate(iz_first,iz_last,&any_refine,&all_coarsen) for
+  /// chunks of the z planes [iz_begin,iz_end), with the chunks executed
+  /// concurrently where supported, and combine the results of the
+  /// chunks with *any_refine and *all_coarsen
+  template <class F>
+  void evaluate_planes_ (int iz_begin, int iz_end, const F & evaluate,
+                         bool * any_refine, bool * all_coarsen,
+                         int num_chunks = cello::num_threads()) const
+  {
+    std::atomic<bool> any (*any_refine);
+    std::atomic<bool> all (*all_coarsen);
+    cello::parallel_for_range
+      (iz_begin, iz_end, [&] (int iz_first, int iz_last)
+       {
+         bool chunk_any = false;
+         bool chunk_all = true;
+         evaluate (iz_first, iz_last, &chunk_any, &chunk_all);
+         if (chunk_any)  any = true;
+         if (!chunk_all) all = false;
+       },
+       num_chunks);
+    *any_refine  = any;
+    *all_coarsen = all;
+  }
+
 protected:
 
   /// Minimum allowed value before refinement kicks in
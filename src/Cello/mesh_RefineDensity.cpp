@@ -81,15 +81,21 @@ int RefineDensity::apply_
 
   bool any_refine  = false;
   bool all_coarsen = true;
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] < max_coarsen_) all_coarsen = false;
-      }
-    }
-  }
+  evaluate_planes_
+    (gz, mz-gz, [&] (int iz_first, int iz_last,
+                     bool * any_refine, bool * all_coarsen)
+     {
+       for (int iz=iz_first; iz<iz_last; iz++) {
+         for (int iy=gy; iy<my-gy; iy++) {
+           for (int ix=gx; ix<mx-gx; ix++) {
+             int i = ix + mx*(iy + my*iz);
+             if (array[i] > min_refine_)  *any_refine  = true;
+             if (array[i] < max_coarsen_) *all_coarsen = false;
+           }
+         }
+       }
+     },
+     &any_refine, &all_coarsen);
   return 
     any_refine ?  adapt_refine :
     (all_coarsen ? adapt_coarsen : adapt_same) ;
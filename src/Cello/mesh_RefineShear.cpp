@@ -112,9 +112,6 @@ void RefineShear::evaluate_block_(const T * u,
 				  bool * all_coarsen, 
 				  int rank)
 {
-  T shear;
-  T uy = 0, vz = 0, wx = 0;
-  T uz = 0, vx = 0, wy = 0;
   const int kx = 1;
   const int ky = (rank >= 2) ? ndx : 0;
   const int kz = (rank >= 3) ? ndx*ndy : 0;
@@ -125,35 +122,47 @@ void RefineShear::evaluate_block_(const T * u,
 #ifdef TRACE_REFINE_SHEAR
   T min_shear = std::numeric_limits<T>::max();
   T max_shear = -std::numeric_limits<T>::max();
+  // min_shear and max_shear are shared by the chunks
+  const int num_chunks = 1;
+#else
+  const int num_chunks = cello::num_threads();
 #endif
-  for (int iz=gz; iz<nz+gz; iz++) {
-    for (int iy=gy; iy<ny+gy; iy++) {
-      for (int ix=gx; ix<nx+gx; ix++) {
-	int i = ix + ndx*(iy + ndy*iz);
-	if (rank >= 2) {
-	  uy = u[i+ky] - u[i-ky]; uy *= uy;
-	  vx = v[i+kx] - v[i-kx]; vx *= vx;
-	} 
-	if (rank >= 3) {
-	  uz = u[i+kz] - u[i-kz]; uz *= uz;
-	  vz = v[i+kz] - v[i-kz]; vz *= vz;
-	  wx = w[i+kx] - w[i-kx]; wx *= wx;
-	  wy = w[i+ky] - w[i-ky]; wy *= wy;
-	}
-	shear = uy + uz + vx + vz + wx + wy;
+  evaluate_planes_
+    (gz, nz+gz, [&] (int iz_first, int iz_last,
+                     bool * any_refine, bool * all_coarsen)
+     {
+       T uy = 0, vz = 0, wx = 0;
+       T uz = 0, vx = 0, wy = 0;
+       for (int iz=iz_first; iz<iz_last; iz++) {
+         for (int iy=gy; iy<ny+gy; iy++) {
+           for (int ix=gx; ix<nx+gx; ix++) {
+             int i = ix + ndx*(iy + ndy*iz);
+             if (rank >= 2) {
+               uy = u[i+ky] - u[i-ky]; uy *= uy;
+               vx = v[i+kx] - v[i-kx]; vx *= vx;
+             }
+             if (rank >= 3) {
+               uz = u[i+kz] - u[i-kz]; uz *= uz;
+               vz = v[i+kz] - v[i-kz]; vz *= vz;
+               wx = w[i+kx] - w[i-kx]; wx *= wx;
+               wy = w[i+ky] - w[i-ky]; wy *= wy;
+             }
+             T shear = uy + uz + vx + vz + wx + wy;
 #ifdef TRACE_REFINE_SHEAR
-	min_shear = std::min(min_shear,shear);
-	max_shear = std::max(max_shear,shear);
+             min_shear = std::min(min_shear,shear);
+             max_shear = std::max(max_shear,shear);
 #endif
-	if (shear > min_refine_)  *any_refine  = true;
-	if (shear > max_coarsen_) *all_coarsen = false;
-	if (output) {
-	  if (shear > max_coarsen_) output[i] =  0;
-	  if (shear > min_refine_)  output[i] = +1;
-	}
-      }
-    }
-  }
+             if (shear > min_refine_)  *any_refine  = true;
+             if (shear > max_coarsen_) *all_coarsen = false;
+             if (output) {
+               if (shear > max_coarsen_) output[i] =  0;
+               if (shear > min_refine_)  output[i] = +1;
+             }
+           }
+         }
+       }
+     },
+     any_refine, all_coarsen, num_chunks);
 #ifdef TRACE_REFINE_SHEAR
   CkPrintf ("%s:%d TRACE_REFINE_SHEAR %s %f %f (%f %f)\n",
     __FILE__,__LINE__,block_temp_->name().c_str(),min_shear,max_shear,
@@ -123,29 +123,35 @@ void RefineSlope::evaluate_block_(T * array, T * output ,
 				  int rank, 
 				  double * h3 )
 {
-  T slope;
   const int d3[3] = {1,mx,mx*my};
   T tiny = 1e-10;
-  int count=0;
-  for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
-	  slope = fabs( (array[i+id] - array[i-id]) / a);
-	  count++;
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
-	  if (output) {
-	    if (slope > max_coarsen_) output[i] =  0;
-	    if (slope > min_refine_)  output[i] = +1;
-	  }
-	}
-      }
-    }
-  }
+  // The axes are looped over inside the cell loops so that the chunks of
+  // z planes are independent. The output of each cell is still updated
+  // in order of increasing axis.
+  evaluate_planes_
+    (gz, mz-gz, [&] (int iz_first, int iz_last,
+                     bool * any_refine, bool * all_coarsen)
+     {
+       for (int iz=iz_first; iz<iz_last; iz++) {
+         for (int iy=gy; iy<my-gy; iy++) {
+           for (int ix=gx; ix<mx-gx; ix++) {
+             int i = ix + mx*(iy + my*iz);
+             for (int axis=0; axis<rank; axis++) {
+               int id = d3[axis];
+               T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
+               T slope = fabs( (array[i+id] - array[i-id]) / a);
+               if (slope > min_refine_)  *any_refine  = true;
+               if (slope > max_coarsen_) *all_coarsen = false;
+               if (output) {
+                 if (slope > max_coarsen_) output[i] =  0;
+                 if (slope > min_refine_)  output[i] = +1;
+               }
+             }
+           }
+         }
+       }
+     },
+     any_refine, all_coarsen);
 }
 //======================================================================
 
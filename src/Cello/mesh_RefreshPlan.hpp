@@ -0,0 +1,118 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     mesh_RefreshPlan.hpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Mesh] Declaration of the RefreshPlan class
+///
+/// This class caches the list of neighbor faces that a Block sends
+/// field and flux data to for a given Refresh object.  Computing the
+/// list requires iterating over neighbors and comparing face levels,
+/// which only change when the mesh adapts, so the list is computed on
+/// the first refresh after an adapt phase and replayed until the next.
+/// Plans are not migrated with the Block, but are recomputed instead.
+
+#ifndef MESH_REFRESH_PLAN_HPP
+#define MESH_REFRESH_PLAN_HPP
+
+class RefreshPlan {
+
+  /// @class    RefreshPlan
+  /// @ingroup  Mesh
+  /// @brief    [\ref Mesh] Cached neighbor faces for a Refresh on a Block
+
+public: // interface
+
+  /// A neighbor face and how data are sent to it
+  struct Face {
+    /// Index of the neighbor Block
+    Index index;
+    /// Face of this Block adjacent to the neighbor
+    int if3[3];
+    /// Child index used for coarse or fine neighbors
+    int ic3[3];
+    /// refresh_same, refresh_coarse, or refresh_fine
+    int refresh_type;
+  };
+
+  /// Create an empty invalid plan
+  RefreshPlan ()
+    : field_face_list_(),
+      flux_face_list_(),
+      is_field_valid_(false),
+      is_flux_valid_(false)
+  {}
+
+  /// Invalidate the plan, e.g. after the mesh changes
+  void clear ()
+  {
+    field_face_list_.clear();
+    flux_face_list_.clear();
+    is_field_valid_ = false;
+    is_flux_valid_  = false;
+  }
+
+  /// Whether the field face list is up to date
+  bool is_field_valid () const
+  { return is_field_valid_; }
+
+  /// Whether the flux face list is up to date
+  bool is_flux_valid () const
+  { return is_flux_valid_; }
+
+  /// Mark the field face list as complete
+  void set_field_valid ()
+  { is_field_valid_ = true; }
+
+  /// Mark the flux face list as complete
+  void set_flux_valid ()
+  { is_flux_valid_ = true; }
+
+  /// Append a face to the field face list
+  void add_field_face
+  (Index index, const int if3[3], const int ic3[3], int refresh_type)
+  { field_face_list_.push_back(face_(index,if3,ic3,refresh_type)); }
+
+  /// Append a face to the flux face list
+  void add_flux_face
+  (Index index, const int if3[3], const int ic3[3], int refresh_type)
+  { flux_face_list_.push_back(face_(index,if3,ic3,refresh_type)); }
+
+  /// Faces receiving field data
+  const std::vector<Face> & field_face_list () const
+  { return field_face_list_; }
+
+  /// Faces receiving flux data
+  const std::vector<Face> & flux_face_list () const
+  { return flux_face_list_; }
+
+private: // functions
+
+  static Face face_
+  (Index index, const int if3[3], const int ic3[3], int refresh_type)
+  {
+    Face face;
+    face.index = index;
+    for (int i=0; i<3; i++) {
+      face.if3[i] = if3[i];
+      face.ic3[i] = ic3[i];
+    }
+    face.refresh_type = refresh_type;
+    return face;
+  }
+
+private: // attributes
+
+  /// Neighbor faces for field data
+  std::vector<Face> field_face_list_;
+
+  /// Neighbor faces for flux data
+  std::vector<Face> flux_face_list_;
+
+  /// Whether field_face_list_ is up to date
+  bool is_field_valid_;
+
+  /// Whether flux_face_list_ is up to date
+  bool is_flux_valid_;
+};
+
+#endif /* MESH_REFRESH_PLAN_HPP */
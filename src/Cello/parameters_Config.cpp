@@ -113,6 +113,7 @@ void Config::pup (PUP::er &p)
   p | method_close_files_seconds_delay;
   p | method_close_files_group_size;
   p | method_courant;
+  p | method_stages_per_refresh;
   p | method_flux_correct_group;
   p | method_flux_correct_enable;
   p | method_flux_correct_min_digits_fields;
@@ -189,6 +190,10 @@ void Config::pup (PUP::er &p)
   p | performance_warnings;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
+  p | performance_num_threads;
+  p | performance_aggregate_refresh;
+  p | performance_aggregate_refresh_bytes;
+  p | performance_reduce_tree;
 
   // Physics
   
@@ -708,6 +713,7 @@ void Config::read_method_ (Parameters * p) throw()
 
   method_list.   resize(num_method);
   method_courant.resize(num_method);
+  method_stages_per_refresh.resize(num_method);
   method_flux_correct_group.resize(num_method);
   method_flux_correct_enable.resize(num_method);
   method_flux_correct_min_digits_fields.resize(num_method);
@@ -756,6 +762,14 @@ void Config::read_method_ (Parameters * p) throw()
     // Read courant condition if any
     method_courant[index_method] = p->value_float  (full_name + ":courant",1.0);
 
+    // Read number of steps between refreshes (requires deep ghost zones)
+    method_stages_per_refresh[index_method] = p->value_integer
+      (full_name + ":stages_per_refresh",1);
+    ASSERT2 ("Config::read_method_",
+	     "%s:stages_per_refresh = %d must be at least 1",
+	     full_name.c_str(),method_stages_per_refresh[index_method],
+	     (method_stages_per_refresh[index_method] >= 1));
+
     // Read field group for flux correction
     method_flux_correct_group[index_method] =
       p->value_string (full_name + ":group","conserved");
@@ -1233,6 +1247,17 @@ void Config::read_performance_ (Parameters * p) throw()
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  performance_num_threads = p->value_integer("Performance:num_threads",1);
+
+  performance_aggregate_refresh = p->value_logical
+    ("Performance:aggregate_refresh",false);
+
+  performance_aggregate_refresh_bytes = p->value_integer
+    ("Performance:aggregate_refresh_bytes",65536);
+
+  performance_reduce_tree = p->value_logical
+    ("Performance:reduce_tree",false);
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -81,6 +81,7 @@ public: // interface
     method_close_files_seconds_delay(),
     method_close_files_group_size(),
     method_courant(),
+    method_stages_per_refresh(),
     method_flux_correct_group(),
     method_flux_correct_enable(),
     method_flux_correct_min_digits_fields(),
@@ -143,6 +144,10 @@ public: // interface
     performance_warnings(false),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
+    performance_num_threads(1),
+    performance_aggregate_refresh(false),
+    performance_aggregate_refresh_bytes(0),
+    performance_reduce_tree(false),
     num_physics(0),
     physics_list(),
     restart_file(""),
@@ -239,6 +244,7 @@ public: // interface
       method_close_files_seconds_delay(),
       method_close_files_group_size(),
       method_courant(),
+      method_stages_per_refresh(),
       method_flux_correct_group(),
       method_flux_correct_enable(),
       method_flux_correct_min_digits_fields(),
@@ -300,6 +306,10 @@ public: // interface
       performance_warnings(false),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
+      performance_num_threads(1),
+      performance_aggregate_refresh(false),
+      performance_aggregate_refresh_bytes(0),
+      performance_reduce_tree(false),
       num_physics(0),
       physics_list(),
       restart_file(""),
@@ -443,6 +453,7 @@ public: // attributes
   std::vector<double>        method_close_files_seconds_delay;
   std::vector<int>           method_close_files_group_size;
   std::vector<double>        method_courant;
+  std::vector<int>           method_stages_per_refresh;
   std::vector<std::string>   method_flux_correct_group;
   std::vector<bool>          method_flux_correct_enable;
   std::vector<std::vector<std::string>> method_flux_correct_min_digits_fields;
@@ -523,6 +534,10 @@ public: // attributes
   bool                       performance_warnings;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
+  int                        performance_num_threads;
+  bool                       performance_aggregate_refresh;
+  int                        performance_aggregate_refresh_bytes;
+  bool                       performance_reduce_tree;
 
   // Physics
   
@@ -33,7 +33,8 @@ public: // interface
     schedule_(NULL),
     courant_(1.0),
     ir_post_(-1),
-    neighbor_type_(neighbor_leaf)
+    neighbor_type_(neighbor_leaf),
+    stages_per_refresh_(1)
 
   { }
 
@@ -53,6 +54,24 @@ public: // virtual functions
   virtual double timestep (Block * block) const throw()
   { return std::numeric_limits<double>::max(); }
 
+  /// Whether compute_interior() and compute_boundary() are used in
+  /// place of compute(), to overlap computation with the refresh
+  virtual bool overlap_refresh () const throw()
+  { return false; }
+
+  /// Compute what does not depend on ghost zones.  Called after the
+  /// Method's refresh is started but before ghost zones are updated,
+  /// so the refreshed fields must not be modified: results should be
+  /// kept in other Block data until compute_boundary(), since other
+  /// Blocks on the PE may compute in between
+  virtual void compute_interior ( Block * block) throw()
+  { }
+
+  /// Complete the computation once ghost zones are updated, which
+  /// must eventually call block->compute_done()
+  virtual void compute_boundary ( Block * block) throw()
+  { compute(block); }
+
   /// Resume computation after a reduction
   virtual void compute_resume ( Block * block,
 				CkReductionMsg * msg) throw()
@@ -86,6 +105,16 @@ public: // virtual functions
   void set_courant(double courant) throw ()
   { courant_ = courant; }
 
+  /// Number of times the Method is applied per refresh of its ghost
+  /// zones.  If greater than 1, the Method must also update ghost
+  /// zones, which become invalid from the outside in, using
+  /// Block::method_stage() to determine how many remain valid
+  int stages_per_refresh() const throw ()
+  { return stages_per_refresh_; }
+
+  void set_stages_per_refresh(int stages) throw ()
+  { stages_per_refresh_ = stages; }
+
 protected: // functions
 
   /// Perform vector copy X <- Y
@@ -117,6 +146,9 @@ protected: // attributes
   /// Default refresh type
   int neighbor_type_;
 
+  /// Number of times the Method is applied per refresh
+  int stages_per_refresh_;
+
   /// List of fields required for the Method
   std::vector<std::string> required_fields_;
 
@@ -153,35 +153,37 @@ void MethodFluxCorrect::compute_continue_refresh( Block * block ) throw()
     }
   }
 
-  CkCallback callback (CkIndex_Block::r_method_flux_correct_sum_fields(nullptr), 
-                       block->proxy_array());
+  // Sum over the mesh tree rather than the entire Block array
 
-  block->contribute
-    ((nf+1)*sizeof(long double), reduce, sum_long_double_n_type, callback);
+  block->reduce_tree_start
+    (reduce_id_method_flux_correct,
+     CkIndex_Block::p_method_flux_correct_sum_fields(),
+     nf+1, reduce, reduce_tree_sum,
+     cello::config()->mesh_min_level, true);
 
   delete [] reduce;
 }
 
 //----------------------------------------------------------------------
 
-void Block::Block::r_method_flux_correct_sum_fields(CkReductionMsg * msg)
+void Block::Block::p_method_flux_correct_sum_fields()
 {
   static_cast<MethodFluxCorrect*>
-    (this->method())->compute_continue_sum_fields(this,msg);
+    (this->method())->compute_continue_sum_fields(this);
 }
 
 //----------------------------------------------------------------------
 
 void MethodFluxCorrect::compute_continue_sum_fields
-( Block * block, CkReductionMsg * msg) throw()
+( Block * block) throw()
 {
   FluxData * flux_data = block->data()->flux_data();
   const int nf = flux_data->num_fields();
-  long double * data = (long double *) msg->getData();
+  const std::vector<long double> & data =
+    block->reduce_tree_result(reduce_id_method_flux_correct);
   for (int i_f=0; i_f<nf; i_f++) {
     field_sum_[i_f] = data[i_f+1];
   }
-  delete msg;
 
   Field field = block->data()->field();
 
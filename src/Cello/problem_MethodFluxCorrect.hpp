@@ -51,7 +51,7 @@ public: // interface
   };
 
   void compute_continue_refresh ( Block * block) throw();
-  void compute_continue_sum_fields ( Block * block, CkReductionMsg * msg) throw();
+  void compute_continue_sum_fields ( Block * block) throw();
 
 public: // virtual functions
 
@@ -459,6 +459,9 @@ void Problem::initialize_method ( Config * config ) throw()
 
       method_list_.push_back(method); 
 
+      method->set_stages_per_refresh
+	(config->method_stages_per_refresh[index_method]);
+
       int index_schedule = config->method_schedule_index[index_method];
 
       if (index_schedule != -1) {
@@ -476,6 +479,42 @@ void Problem::initialize_method ( Config * config ) throw()
 	     "Unknown Method %s",name.c_str());
     }
   }
+
+  // Methods applied in several stages per refresh rely on fields not
+  // being modified by other Methods between stages.  Flux correction
+  // and gravity both modify fields whose ghost zones would then be
+  // out of date
+
+  for (size_t index_method=0; index_method < num_method ; index_method++) {
+
+    const int stages = config->method_stages_per_refresh[index_method];
+
+    if (stages > 1) {
+
+      const std::string name = config->method_list[index_method];
+
+      for (size_t i=0; i < num_method ; i++) {
+	const std::string other = config->method_list[i];
+	ASSERT2 ("Problem::initialize_method",
+		 "Method:%s:stages_per_refresh > 1 is not supported "
+		 "with Method %s",
+		 name.c_str(),other.c_str(),
+		 (other != "flux_correct" && other != "gravity"));
+      }
+
+      // ghost zones are refreshed whenever the mesh adapts
+
+      if (config->mesh_max_level > 0 &&
+	  config->adapt_interval > 0 && config->adapt_interval < stages) {
+	WARNING4 ("Problem::initialize_method",
+		  "Adapt:interval = %d is less than "
+		  "Method:%s:stages_per_refresh = %d, so ghost zones "
+		  "are still refreshed every %d cycles",
+		  config->adapt_interval,name.c_str(),stages,
+		  config->adapt_interval);
+      }
+    }
+  }
 }
 
 //----------------------------------------------------------------------
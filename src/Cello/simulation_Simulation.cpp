@@ -61,7 +61,10 @@ Simulation::Simulation
   new_refresh_list_(),
   index_output_(-1),
   num_solver_iter_(),
-  max_solver_iter_()
+  max_solver_iter_(),
+  refresh_aggregate_buffer_(),
+  refresh_aggregate_pe_list_(),
+  refresh_aggregate_flush_pending_(false)
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
 #ifdef DEBUG_SIMULATION
@@ -126,7 +129,10 @@ Simulation::Simulation()
   new_refresh_list_(),
   index_output_(-1),
   num_solver_iter_(),
-  max_solver_iter_()
+  max_solver_iter_(),
+  refresh_aggregate_buffer_(),
+  refresh_aggregate_pe_list_(),
+  refresh_aggregate_flush_pending_(false)
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
 #ifdef DEBUG_SIMULATION
@@ -179,7 +185,10 @@ Simulation::Simulation (CkMigrateMessage *m)
     new_refresh_list_(),
     index_output_(-1),
     num_solver_iter_(),
-    max_solver_iter_()
+    max_solver_iter_(),
+  refresh_aggregate_buffer_(),
+  refresh_aggregate_pe_list_(),
+  refresh_aggregate_flush_pending_(false)
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
 #ifdef DEBUG_SIMULATION
@@ -308,6 +308,21 @@ public: // virtual functions
 
   /// Set block_array proxy on all processes
   void p_set_block_array(CProxy_Block block_array);
+
+  //--------------------------------------------------
+  // Refresh aggregation
+  //--------------------------------------------------
+
+  /// Append refresh data for the Block at the given index to the
+  /// buffer for PE ip, taking ownership of data_msg (may be NULL)
+  void refresh_aggregate_send
+  (int ip, Index index, int id_refresh, DataMsg * data_msg);
+
+  /// Send all buffered refresh data
+  void refresh_aggregate_flush();
+
+  /// Receive buffered refresh data for Blocks on this PE
+  void p_refresh_aggregate_recv (int n, char * buffer);
   
   /// Add a new Block to this local branch
   void data_insert_block(Block *) ;
@@ -427,6 +442,11 @@ protected: // functions
   /// Initialize the array of octrees
   void initialize_block_array_ () throw();
 
+  /// Reserve space in the refresh buffer for PE ip for size bytes of
+  /// data for the Block at the given index, and return its address
+  char * refresh_aggregate_reserve_
+  (int ip, Index index, int id_refresh, int size);
+
   /// Initialize the data object
   void initialize_data_descr_ () throw();
 
@@ -565,6 +585,15 @@ protected: // attributes
   std::vector<int> num_solver_iter_;
   /// Max of solver iterations over blocks for solver i
   std::vector<int> max_solver_iter_;
+
+  /// Buffers of refresh data for each destination PE
+  std::vector < std::vector<char> > refresh_aggregate_buffer_;
+
+  /// List of destination PEs with non-empty buffers
+  std::vector<int> refresh_aggregate_pe_list_;
+
+  /// Whether a flush is scheduled for when this PE becomes idle
+  bool refresh_aggregate_flush_pending_;
 };
 
 #endif /* SIMULATION_SIMULATION_HPP */
@@ -1092,6 +1092,53 @@ public:
 
 //----------------------------------------------------------------------
 
+class ReducedDimSliceTests{
+
+public:
+
+  template<template<typename, std::size_t> class Builder>
+  void test_reduced_dim_slice_(){
+    Builder<double, 3> builder(2,2,3);
+    CelloArray<double, 3> *arr_ptr = builder.get_arr();
+
+    // modifications to the reduced array are reflected in the original
+    CelloArray<double, 2> slice = arr_ptr->reduced_dim_slice(1);
+    ASSERT("ReducedDimSliceTests::test_reduced_dim_slice_",
+           "The reduced array has the wrong shape",
+           slice.shape(0) == 2 && slice.shape(1) == 3);
+    slice(0,2) = 1;
+    slice(1,0) = 2;
+    ASSERT("ReducedDimSliceTests::test_reduced_dim_slice_",
+           "The original array was not modified",
+           (*arr_ptr)(1,0,2) == 1 && (*arr_ptr)(1,1,0) == 2);
+
+    // take the reduced slice of a subarray
+    CelloArray<double, 3> sub = arr_ptr->subarray(CSlice(0,2), CSlice(0,2),
+                                                  CSlice(1,3));
+    CelloArray<double, 2> sub_slice = sub.reduced_dim_slice(1);
+    check_arr_vals(sub_slice, std::vector<double>({0, 1,
+                                                   0, 0}),
+                   "ReducedDimSliceTests::test_reduced_dim_slice_");
+    sub_slice(1,1) = 3;
+    ASSERT("ReducedDimSliceTests::test_reduced_dim_slice_",
+           "The original array was not modified",
+           (*arr_ptr)(1,1,2) == 3);
+    ASSERT("ReducedDimSliceTests::test_reduced_dim_slice_",
+           "The arrays are aliases.",
+           sub_slice.is_alias(sub.subarray(CSlice(1,2), CSlice(0,2),
+                                           CSlice(0,2))
+                              .reduced_dim_slice(0)));
+  }
+
+  void run_tests(){
+    test_reduced_dim_slice_<MemManagedArrayBuilder>();
+    test_reduced_dim_slice_<PtrWrapArrayBuilder>();
+  }
+
+};
+
+//----------------------------------------------------------------------
+
 PARALLEL_MAIN_BEGIN
 {
   PARALLEL_INIT;
@@ -1121,6 +1168,9 @@ PARALLEL_MAIN_BEGIN
   IsAliasTests is_alias_tests;
   is_alias_tests.run_tests();
 
+  ReducedDimSliceTests reduced_dim_slice_tests;
+  reduced_dim_slice_tests.run_tests();
+
   unit_finalize();
 
   exit_();
@@ -0,0 +1,160 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ParallelFor.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Test program for the node-level parallel loop functions
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "mesh.hpp"
+
+#ifdef CONFIG_SMP_MODE
+#  include "CkLoopAPI.h"
+#endif
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+#ifdef CONFIG_SMP_MODE
+  CkLoop_Init();
+#endif
+
+  unit_init(0,1);
+
+  unit_class("cello::parallel_for");
+
+  const int n = 1000;
+
+  unit_func("parallel_for_range");
+  {
+    // every iteration is visited exactly once, for any number of chunks
+    const int num_chunks[] = {1, 3, 7, 64, 2000};
+    for (int ic=0; ic<5; ic++) {
+      std::vector<int> count(n,0);
+      // chunks may execute concurrently, so each marks its own start
+      std::vector<int> is_first(n,0);
+      cello::parallel_for_range
+        (0, n, [&count,&is_first] (int first, int last)
+         {
+           is_first[first] = 1;
+           for (int i=first; i<last; i++) count[i]++;
+         },
+         num_chunks[ic]);
+      bool all_once = true;
+      int num_calls = 0;
+      for (int i=0; i<n; i++) {
+        all_once = all_once && (count[i] == 1);
+        num_calls += is_first[i];
+      }
+      unit_assert (all_once);
+      unit_assert (num_calls == std::min(num_chunks[ic],n));
+    }
+
+    // empty ranges don't call the body
+    int num_calls = 0;
+    cello::parallel_for_range
+      (5, 5, [&num_calls] (int, int) { ++num_calls; }, 4);
+    cello::parallel_for_range
+      (5, 2, [&num_calls] (int, int) { ++num_calls; }, 4);
+    unit_assert (num_calls == 0);
+  }
+
+  unit_func("parallel_for");
+  {
+    std::vector<double> a(n,0.0);
+    cello::parallel_for
+      (10, n-10, [&a] (int i) { a[i] = 2.0*i; }, 4);
+    bool ok = true;
+    for (int i=0; i<n; i++) {
+      ok = ok && (a[i] == ((i < 10 || i >= n-10) ? 0.0 : 2.0*i));
+    }
+    unit_assert (ok);
+  }
+
+  unit_func("count_tiles");
+  {
+    const int start[3] = {2,1,0};
+    const int stop[3]  = {11,8,0};
+    const int tile[3]  = {4,7,2};
+    int nt[3];
+    const int num_tiles = cello::count_tiles (start,stop,tile,nt);
+    unit_assert (nt[0] == 3 && nt[1] == 1 && nt[2] == 0);
+    unit_assert (num_tiles == 0);
+  }
+
+  unit_func("parallel_for_tiles");
+  {
+    const int mx = 13, my = 9, mz = 5;
+    std::vector<int> count(mx*my*mz,0);
+    const int start[3] = {2,1,0};
+    const int stop[3]  = {mx-2,my-1,mz};
+    const int tile[3]  = {4,4,2};
+    cello::parallel_for_tiles
+      (start, stop, tile, [&count] (const int lo[3], const int hi[3])
+       {
+         for (int iz=lo[2]; iz<hi[2]; iz++) {
+           for (int iy=lo[1]; iy<hi[1]; iy++) {
+             for (int ix=lo[0]; ix<hi[0]; ix++) {
+               count[ix + mx*(iy + my*iz)]++;
+             }
+           }
+         }
+       },
+       3);
+    bool ok = true;
+    for (int iz=0; iz<mz; iz++) {
+      for (int iy=0; iy<my; iy++) {
+        for (int ix=0; ix<mx; ix++) {
+          const bool inside =
+            (start[0] <= ix && ix < stop[0]) &&
+            (start[1] <= iy && iy < stop[1]) &&
+            (start[2] <= iz && iz < stop[2]);
+          ok = ok && (count[ix + mx*(iy + my*iz)] == (inside ? 1 : 0));
+        }
+      }
+    }
+    unit_assert (ok);
+  }
+
+  unit_func("in_parallel_loop");
+  {
+    unit_assert (! cello::in_parallel_loop());
+    bool inside = true;
+    int num_inner = 0;
+    cello::parallel_for_range
+      (0, 1, [&] (int, int)
+       {
+         inside = cello::in_parallel_loop();
+         // nested loops are executed serially by the calling PE
+         cello::parallel_for (0, 10, [&num_inner] (int) { ++num_inner; }, 4);
+       },
+       1);
+    unit_assert (inside);
+    unit_assert (num_inner == 10);
+    unit_assert (! cello::in_parallel_loop());
+  }
+
+  unit_class("cello::ThreadScratch");
+
+  unit_func("get");
+  {
+    cello::ThreadScratch<double> scratch;
+    double * p1 = scratch.get(100);
+    for (int i=0; i<100; i++) p1[i] = i;
+    // smaller requests reuse the existing array
+    double * p2 = scratch.get(10);
+    unit_assert (p1 == p2);
+    unit_assert (p2[99] == 99.0);
+    scratch.clear();
+    unit_assert (scratch.get(1) != nullptr);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,215 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ReduceTree.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Test program for the ReduceTree class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "mesh.hpp"
+
+//----------------------------------------------------------------------
+
+/// Simulate a global reduction over the root-level Blocks of an nb3
+/// root array, with the messages delivered in last-in first-out
+/// order so that contributions from children may arrive before a
+/// Block starts.  Each Block contributes (i+1) for sum, min and max.
+/// Return whether the root receives the correct values exactly once
+/// and the values sent down reach each Block exactly once.
+bool simulate_global (int root_level, const int nb3[3])
+{
+  int na3[3];
+  ReduceTree::root_count(root_level,nb3,na3);
+  const int num_root = na3[0]*na3[1]*na3[2];
+  const int op[3] = {reduce_tree_sum, reduce_tree_min, reduce_tree_max};
+
+  // root-level Block positions are unique and round-trip
+
+  const int step = 1 << (-root_level);
+  std::vector<int> count(num_root,0);
+  for (int iz=0; iz<nb3[2]; iz+=step) {
+    for (int iy=0; iy<nb3[1]; iy+=step) {
+      for (int ix=0; ix<nb3[0]; ix+=step) {
+        const int a3[3] = {ix,iy,iz};
+        const int i_root = ReduceTree::root_position(root_level,a3,na3);
+        if (i_root < 0 || i_root >= num_root) return false;
+        ++count[i_root];
+        int b3[3];
+        ReduceTree::root_array(root_level,i_root,na3,b3);
+        if (b3[0] != ix || b3[1] != iy || b3[2] != iz) return false;
+      }
+    }
+  }
+  for (int i=0; i<num_root; i++) if (count[i] != 1) return false;
+
+  // up: a message is (destination, self, values)
+
+  struct Message { int i_root; bool self; std::vector<long double> values; };
+  std::vector<Message> queue;
+  for (int i=0; i<num_root; i++) {
+    const long double v = i + 1;
+    queue.push_back({i,true,{v,v,v}});
+  }
+
+  std::vector<ReduceTree> reduce(num_root);
+  int num_done = 0;
+  bool ok = true;
+  while (! queue.empty()) {
+    Message m = queue.back();
+    queue.pop_back();
+    ReduceTree & r = reduce[m.i_root];
+    if (m.self) {
+      int stop = 1;
+      for (int k=0; k<2; k++) {
+        if (ReduceTree::root_child(m.i_root,k,num_root) >= 0) ++stop;
+      }
+      r.start(0,root_level,true,stop);
+    }
+    if (r.accumulate(3,m.values.data(),op)) {
+      std::vector<long double> values(r.values(),r.values()+3);
+      r.clear();
+      const int j_root = ReduceTree::root_parent(m.i_root);
+      if (j_root >= 0) {
+        queue.push_back({j_root,false,values});
+      } else {
+        ++num_done;
+        ok = ok && (m.i_root == 0);
+        ok = ok && (values[0] == 0.5*num_root*(num_root+1));
+        ok = ok && (values[1] == 1.0);
+        ok = ok && (values[2] == num_root);
+      }
+    }
+  }
+  ok = ok && (num_done == 1);
+
+  // down: every Block is reached exactly once from the root
+
+  std::fill(count.begin(),count.end(),0);
+  std::vector<int> down(1,0);
+  while (! down.empty()) {
+    const int i_root = down.back();
+    down.pop_back();
+    ++count[i_root];
+    for (int k=0; k<2; k++) {
+      const int j_root = ReduceTree::root_child(i_root,k,num_root);
+      if (j_root >= 0) {
+        ok = ok && (ReduceTree::root_parent(j_root) == i_root);
+        down.push_back(j_root);
+      }
+    }
+  }
+  for (int i=0; i<num_root; i++) ok = ok && (count[i] == 1);
+
+  return ok;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ReduceTree");
+
+  ReduceTree reduce;
+
+  unit_func("ReduceTree");
+
+  unit_assert(reduce.size() == 0);
+  unit_assert(reduce.result().size() == 0);
+
+  unit_func("combine");
+
+  unit_assert(ReduceTree::combine(reduce_tree_sum,2.0,3.0) == 5.0);
+  unit_assert(ReduceTree::combine(reduce_tree_min,2.0,3.0) == 2.0);
+  unit_assert(ReduceTree::combine(reduce_tree_max,2.0,3.0) == 3.0);
+
+  const int op[3] = {reduce_tree_sum, reduce_tree_min, reduce_tree_max};
+  const long double a[3] = { 1.0, 4.0, 4.0};
+  const long double b[3] = { 2.0, 2.0, 2.0};
+  const long double c[3] = { 3.0, 6.0, 6.0};
+
+  unit_func("accumulate");
+
+  // contribution may arrive before start()
+  unit_assert(reduce.accumulate(3,a,op) == false);
+  unit_assert(reduce.size() == 3);
+
+  reduce.start(7,-1,true,3);
+  unit_assert(reduce.entry_point() == 7);
+  unit_assert(reduce.root_level() == -1);
+  unit_assert(reduce.global() == true);
+
+  unit_assert(reduce.accumulate(3,b,op) == false);
+  unit_assert(reduce.accumulate(3,c,op) == true);
+
+  unit_assert(reduce.values()[0] == 6.0);
+  unit_assert(reduce.values()[1] == 2.0);
+  unit_assert(reduce.values()[2] == 6.0);
+  unit_assert(reduce.op()[1] == reduce_tree_min);
+
+  unit_func("clear");
+
+  reduce.clear();
+  unit_assert(reduce.size() == 0);
+  unit_assert(reduce.accumulate(3,a,op) == false);
+  reduce.clear();
+
+  unit_func("set_result");
+
+  reduce.set_result(3,c);
+  unit_assert(reduce.result().size() == 3);
+  unit_assert(reduce.result()[1] == 6.0);
+
+  unit_func("root_parent");
+
+  unit_assert(ReduceTree::root_parent(0) == -1);
+  unit_assert(ReduceTree::root_parent(1) == 0);
+  unit_assert(ReduceTree::root_parent(2) == 0);
+  unit_assert(ReduceTree::root_parent(6) == 2);
+
+  unit_func("root_child");
+
+  unit_assert(ReduceTree::root_child(0,0,3) == 1);
+  unit_assert(ReduceTree::root_child(0,1,3) == 2);
+  unit_assert(ReduceTree::root_child(1,0,4) == 3);
+  unit_assert(ReduceTree::root_child(1,1,4) == -1);
+  unit_assert(ReduceTree::root_child(0,0,1) == -1);
+
+  unit_func("root_count");
+  {
+    const int nb3[3] = {5,4,1};
+    int na3[3];
+    ReduceTree::root_count(0,nb3,na3);
+    unit_assert(na3[0] == 5 && na3[1] == 4 && na3[2] == 1);
+    ReduceTree::root_count(-1,nb3,na3);
+    unit_assert(na3[0] == 3 && na3[1] == 2 && na3[2] == 1);
+    ReduceTree::root_count(-2,nb3,na3);
+    unit_assert(na3[0] == 2 && na3[1] == 1 && na3[2] == 1);
+  }
+
+  // global reductions forwarded along the binary tree over
+  // root-level Blocks
+
+  unit_func("global");
+  {
+    const int nb3_list[4][3] = {{1,1,1},{2,2,2},{5,4,1},{6,5,3}};
+    bool ok = true;
+    for (int i=0; i<4; i++) {
+      for (int root_level=0; root_level>=-2; root_level--) {
+        ok = ok && simulate_global(root_level,nb3_list[i]);
+      }
+    }
+    unit_assert(ok);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
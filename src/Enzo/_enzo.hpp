@@ -103,13 +103,18 @@ enum enzo_sync_id {
   enzo_sync_id_solver_jacobi_3
 };
 
+enum enzo_reduce_id {
+  enzo_reduce_id_method_turbulence = reduce_id_last,
+  enzo_reduce_id_solver_bicgstab,
+  enzo_reduce_id_solver_cg
+};
+
 //----------------------------------------------------------------------
 
 // #include "macros_and_parameters.h"
 #include "enzo_defines.hpp"
 #include "enzo_typedefs.hpp"
 #include "enzo_fortran.hpp"
-#include "enzo_reductions.hpp"
 
 //----------------------------------------------------------------------
 
@@ -236,6 +241,7 @@ extern "C" {
 #include "enzo_EnzoMethodHydro.hpp"
 #include "enzo_EnzoMethodPmDeposit.hpp"
 #include "enzo_EnzoMethodPmUpdate.hpp"
+#include "enzo_EnzoPpmSolver.hpp"
 #include "enzo_EnzoMethodPpm.hpp"
 #include "enzo_EnzoMethodPpml.hpp"
 #include "enzo_EnzoMethodTurbulence.hpp"
@@ -244,6 +250,7 @@ extern "C" {
 #include "enzo_EnzoMethodMHDVlct.hpp"
 
 #include "enzo_EnzoMatrixDiagonal.hpp"
+#include "enzo_EnzoMatrixDiffuse.hpp"
 #include "enzo_EnzoMatrixIdentity.hpp"
 #include "enzo_EnzoMatrixLaplace.hpp"
 
@@ -257,8 +264,10 @@ extern "C" {
 
 #include "enzo_EnzoSolverBiCgStab.hpp"
 #include "enzo_EnzoSolverCg.hpp"
+#include "enzo_EnzoSolverChebyshev.hpp"
 #include "enzo_EnzoSolverDd.hpp"
 #include "enzo_EnzoSolverDiagonal.hpp"
+#include "enzo_EnzoSolverFft.hpp"
 #include "enzo_EnzoSolverJacobi.hpp"
 #include "enzo_EnzoSolverMg0.hpp"
 
@@ -37,6 +37,10 @@
 
 #include "charm_enzo.hpp"
 
+#ifdef CONFIG_SMP_MODE
+#  include "CkLoopAPI.h"
+#endif
+
 // The following needs to be included once and only once
 // This may not be the perfect place for this, but it is when it is included in
 // multiple object files
@@ -121,6 +125,12 @@ PARALLEL_MAIN_BEGIN
 
   proxy_main     = thishandle;
 
+#ifdef CONFIG_SMP_MODE
+  // Initialize CkLoop, used to divide work within a block among the
+  // PEs of a process
+  CkLoop_Init();
+#endif
+
   // --------------------------------------------------
   // ENTRY: #1 Main::Main() -> EnzoSimulation::EnzoSimulation()
   // ENTRY: create
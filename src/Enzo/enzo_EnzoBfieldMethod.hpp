@@ -126,9 +126,14 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
-  virtual void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
-                                            EnzoEFltArrayMap &r_map, int dim,
-                                            int stale_depth) noexcept = 0;
+  /// @param[in]     region Slices (ordered z, y, x) specifying the region of
+  ///     the block that the arrays in `l_map` and `r_map` correspond to. The
+  ///     slice along `dim` must always span the full axis. When the arrays
+  ///     cover the full block, every slice should be `CSlice(nullptr,
+  ///     nullptr)`.
+  virtual void correct_reconstructed_bfield
+  (EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim,
+   int stale_depth, const std::array<CSlice,3> &region) noexcept = 0;
 
   /// In the case of Constrained Transport, identifies and stores the upwind
   /// direction.
@@ -138,8 +143,13 @@ public: // interface
   /// @param[in] dim The dimension to identify the upwind direction along.
   /// @param[in] stale_depth The current staling depth. This should match the
   ///     staling depth used to compute the flux_group.
+  /// @param[in] region Slices (ordered z, y, x) specifying the region of the
+  ///     block that the arrays in `flux_map` correspond to. This follows the
+  ///     same conventions as the argument of `correct_reconstructed_bfield`.
   virtual void identify_upwind(const EnzoEFltArrayMap &flux_map, int dim,
-                               int stale_depth) noexcept = 0;
+                               int stale_depth,
+                               const std::array<CSlice,3> &region)
+    noexcept = 0;
 
   /// Updates all components of the bfields (this is to be called before the
   /// hydro quantities are updated)
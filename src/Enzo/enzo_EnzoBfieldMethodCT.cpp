@@ -55,9 +55,6 @@ void EnzoBfieldMethodCT::register_target_block_
     edge_efield_l_[0] = EFlt3DArray(mz-1, my-1,   mx);
     edge_efield_l_[1] = EFlt3DArray(mz-1,   my, mx-1);
     edge_efield_l_[2] = EFlt3DArray(  mz, my-1, mx-1);
-
-    // allocate array to temporarily store cell-centered e-field
-    center_efield_ = EFlt3DArray(mz,my,mx);
   }
 }
 
@@ -106,7 +103,7 @@ void EnzoBfieldMethodCT::check_required_fields() const noexcept
 
 void EnzoBfieldMethodCT::correct_reconstructed_bfield
 (EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim,
- int stale_depth) noexcept
+ int stale_depth, const std::array<CSlice,3> &region) noexcept
 {
   require_registered_block_(); // confirm that target_block_ is valid
 
@@ -131,7 +128,8 @@ void EnzoBfieldMethodCT::correct_reconstructed_bfield
     EnzoPermutedCoordinates coord(dim);
     CSlice full_ax(nullptr,nullptr);
     EFlt3DArray bfield = coord.get_subarray((*cur_bfieldi_l)[dim],
-                                            full_ax, full_ax, CSlice(1,-1));
+                                            full_ax, full_ax, CSlice(1,-1))
+      .subarray(region[0], region[1], region[2]);
 
     const std::string names[3] = {"bfield_x", "bfield_y", "bfield_z"};
     EFlt3DArray l_bfield = l_map.at(names[dim]);
@@ -153,7 +151,9 @@ void EnzoBfieldMethodCT::correct_reconstructed_bfield
 //----------------------------------------------------------------------
 
 void EnzoBfieldMethodCT::identify_upwind(const EnzoEFltArrayMap &flux_map,
-                                         int dim, int stale_depth) noexcept
+                                         int dim, int stale_depth,
+                                         const std::array<CSlice,3> &region)
+  noexcept
 {
   require_registered_block_(); // confirm that target_block_ is valid
 
@@ -175,8 +175,9 @@ void EnzoBfieldMethodCT::identify_upwind(const EnzoEFltArrayMap &flux_map,
     CSlice stale_slc = (stale_depth > 0) ?
       CSlice(stale_depth,-stale_depth) : CSlice(nullptr, nullptr);
 
-    EFlt3DArray weight_field = weight_l_[dim].subarray(stale_slc, stale_slc,
-                                                       stale_slc);
+    EFlt3DArray weight_field = weight_l_[dim]
+      .subarray(region[0], region[1], region[2])
+      .subarray(stale_slc, stale_slc, stale_slc);
 
     // Iteration limits compatible with both 2D and 3D grids
     for (int iz=0; iz<density_flux.shape(0); iz++) {
@@ -226,55 +227,60 @@ void EnzoBfieldMethodCT::update_all_bfield_components
   // First, compute the edge-centered Electric fields (each time, it uses
   // the current integrable quantities)
   EnzoBfieldMethodCT::compute_all_edge_efields(cur_prim_map, xflux_map,
-                                                     yflux_map, zflux_map,
-                                                     center_efield_,
-                                                     edge_efield_l_, weight_l_,
-                                                     stale_depth);
+                                               yflux_map, zflux_map,
+                                               edge_efield_l_, weight_l_,
+                                               stale_depth);
 
   // Update longitudinal B-field (add source terms of constrained transport)
+  // and the cell-centered B-field (both components are updated in one pass)
+  const std::string names[3] = {"bfield_x", "bfield_y", "bfield_z"};
   for (int dim = 0; dim<3; dim++){
+    EFlt3DArray bfield_center = out_centered_bfield_map.at(names[dim]);
     EnzoBfieldMethodCT::update_bfield
       (cell_widths_, dim, edge_efield_l_, (*cur_bfieldi_l)[dim],
-       (*out_bfieldi_l)[dim], dt, stale_depth);
-  }
-
-  // Finally, update cell-centered B-field
-  const std::string names[3] = {"bfield_x", "bfield_y", "bfield_z"};
-  for (int dim = 0; dim<3; dim++){
-    EnzoBfieldMethodCT::compute_center_bfield
-      (dim, out_centered_bfield_map[names[dim]], (*out_bfieldi_l)[dim],
-       stale_depth);
+       (*out_bfieldi_l)[dim], bfield_center, dt, stale_depth);
   }
 }
 
 //----------------------------------------------------------------------
 
-void EnzoBfieldMethodCT::compute_center_efield
-(int dim, EFlt3DArray &efield, const EnzoEFltArrayMap &prim_map,
- int stale_depth)
-{
-  const std::string v_names[3] = {"velocity_x", "velocity_y", "velocity_z"};
-  const std::string b_names[3] = {"bfield_x", "bfield_y", "bfield_z"};
-
-  EnzoPermutedCoordinates coord(dim);
-  int j = coord.j_axis();
-  int k = coord.k_axis();
+// Helper class used to compute component i of the cell-centered E-field on
+// the fly (i, j, and k are any cyclic permutation of x, y, z):
+//   E_i = -v_j * B_k + v_k * B_j
+//
+// compute_edge_ evaluates this at the 4 cell-centers that surround each edge.
+// Although this means that each cell-centered value is computed 4 times, it's
+// cheaper than writing all of the values to a separate array in an earlier
+// pass over the block (and then reading them back)
+class CenterEfield_ {
+
+public:
+  CenterEfield_(EFlt3DArray velocity_j, EFlt3DArray velocity_k,
+                EFlt3DArray bfield_j, EFlt3DArray bfield_k)
+    : velocity_j_(velocity_j), velocity_k_(velocity_k),
+      bfield_j_(bfield_j), bfield_k_(bfield_k)
+  { }
+
+  // Analogous to EnzoPermutedCoordinates::left_edge_offset
+  CenterEfield_ left_edge_offset(const EnzoPermutedCoordinates &coord,
+                                 int kstart, int jstart, int istart)
+  {
+    return CenterEfield_
+      (coord.left_edge_offset(velocity_j_, kstart, jstart, istart),
+       coord.left_edge_offset(velocity_k_, kstart, jstart, istart),
+       coord.left_edge_offset(bfield_j_, kstart, jstart, istart),
+       coord.left_edge_offset(bfield_k_, kstart, jstart, istart));
+  }
 
-  // Load the jth and kth components of the velocity and cell-centered bfield
-  EFlt3DArray velocity_j = prim_map.at(v_names[j]);
-  EFlt3DArray velocity_k = prim_map.at(v_names[k]);
-  EFlt3DArray bfield_j = prim_map.at(b_names[j]);
-  EFlt3DArray bfield_k = prim_map.at(b_names[k]);
-
-  for (int iz=stale_depth; iz<efield.shape(0)-stale_depth; iz++) {
-    for (int iy=stale_depth; iy<efield.shape(1)-stale_depth; iy++) {
-      for (int ix=stale_depth; ix<efield.shape(2)-stale_depth; ix++) {
-	efield(iz,iy,ix) = (-velocity_j(iz,iy,ix) * bfield_k(iz,iy,ix) +
-                            velocity_k(iz,iy,ix) * bfield_j(iz,iy,ix));
-      }
-    }
+  enzo_float operator()(int iz, int iy, int ix) const noexcept
+  {
+    return (-velocity_j_(iz,iy,ix) * bfield_k_(iz,iy,ix) +
+            velocity_k_(iz,iy,ix) * bfield_j_(iz,iy,ix));
   }
-}
+
+private:
+  EFlt3DArray velocity_j_, velocity_k_, bfield_j_, bfield_k_;
+};
 
 //----------------------------------------------------------------------
 
@@ -361,6 +367,9 @@ void EnzoBfieldMethodCT::compute_center_efield
 //     Ej_kp1(k,j,i)   =     E(  k+1,j+1/2,i)
 //     Ek(k,j,i)       =     E(k+1/2,    j,i)
 //     Ek_jp1(k,j,i)   =     E(k+1/2,  j+1,i)
+//   Rather than passing Ej and Ej_kp1, we pass the corresponding j-fluxes of
+//   the k-component of the B-field (Ej = -1 * jflux(Bk)). The cell-centered
+//   E-field is computed on the fly.
 //
 //   edge-centered E-field (i-component):
 //     Eedge(k,j,i)    =     E(k+1/2,j+1/2,i)
@@ -370,10 +379,10 @@ void EnzoBfieldMethodCT::compute_center_efield
 void compute_edge_(int xstart, int ystart, int zstart,
 		   int xstop, int ystop, int zstop,
 		   EFlt3DArray &Eedge, EFlt3DArray &Wj, EFlt3DArray &Wj_kp1,
-		   EFlt3DArray &Wk, EFlt3DArray &Wk_jp1, EFlt3DArray &Ec,
-		   EFlt3DArray &Ec_jkp1, EFlt3DArray &Ec_jp1,
-		   EFlt3DArray &Ec_kp1, EFlt3DArray &Ej, EFlt3DArray &Ej_kp1,
-		   EFlt3DArray &Ek, EFlt3DArray &Ek_jp1)
+		   EFlt3DArray &Wk, EFlt3DArray &Wk_jp1, const CenterEfield_ &Ec,
+		   const CenterEfield_ &Ec_jkp1, const CenterEfield_ &Ec_jp1,
+		   const CenterEfield_ &Ec_kp1, EFlt3DArray &jflux,
+		   EFlt3DArray &jflux_kp1, EFlt3DArray &Ek, EFlt3DArray &Ek_jp1)
 {
   for (int iz = zstart; iz < zstop; iz++){
     for (int iy = ystart; iy < ystop; iy++){
@@ -381,35 +390,44 @@ void compute_edge_(int xstart, int ystart, int zstart,
 
 	enzo_float dEdj_l, dEdj_r, dEdk_l, dEdk_r;
 
+	// Ex(k,j+1/2,i) = -1.*yflux(Bz)
+	enzo_float ej = -jflux(iz,iy,ix);
+	enzo_float ej_kp1 = -jflux_kp1(iz,iy,ix);
+
+	enzo_float ec = Ec(iz,iy,ix);
+	enzo_float ec_jp1 = Ec_jp1(iz,iy,ix);
+	enzo_float ec_kp1 = Ec_kp1(iz,iy,ix);
+	enzo_float ec_jkp1 = Ec_jkp1(iz,iy,ix);
+
 	//  dEdj(k+1/2,j+3/4,i) =
 	//       W_k(k+1/2,  j+1)  * (E(    k,  j+1) - E(    k,j+1/2)) +
 	//    (1-W_k(k+1/2,  j+1)) * (E(  k+1,  j+1) - E(  k+1,j+1/2))
 	dEdj_r =
-	       Wk_jp1(iz,iy,ix)  * ( Ec_jp1(iz,iy,ix) -     Ej(iz,iy,ix)) +
-	  (1 - Wk_jp1(iz,iy,ix)) * (Ec_jkp1(iz,iy,ix) - Ej_kp1(iz,iy,ix));
+	       Wk_jp1(iz,iy,ix)  * ( ec_jp1 - ej) +
+	  (1 - Wk_jp1(iz,iy,ix)) * (ec_jkp1 - ej_kp1);
 
 	//  dEdj(k+1/2,j+1/4,i) =
 	//       W_k(k+1/2,    j)  * (E(    k,j+1/2) - E(    k,    j)) +
 	//    (1-W_k(k+1/2,    j)) * (E(  k+1,j+1/2) - E(  k+1,    j))
 	dEdj_l =
-	           Wk(iz,iy,ix)  * (     Ej(iz,iy,ix) -     Ec(iz,iy,ix)) +
-	  (1 -     Wk(iz,iy,ix)) * ( Ej_kp1(iz,iy,ix) - Ec_kp1(iz,iy,ix));
+	           Wk(iz,iy,ix)  * (     ej -     ec) +
+	  (1 -     Wk(iz,iy,ix)) * ( ej_kp1 - ec_kp1);
 
 	//  dEdk(k+3/4,j+1/2,i) =
 	//       W_j(  k+1,j+1/2)  * (E(  k+1,    j) - E(k+1/2,    j)) +
 	//    (1-W_j(  k+1,j+1/2)) * (E(  k+1,  j+1) - E(k+1/2,  j+1))
 	dEdk_r =
-	       Wj_kp1(iz,iy,ix)  * ( Ec_kp1(iz,iy,ix) -     Ek(iz,iy,ix)) +
-	  (1 - Wj_kp1(iz,iy,ix)) * (Ec_jkp1(iz,iy,ix) - Ek_jp1(iz,iy,ix));
+	       Wj_kp1(iz,iy,ix)  * ( ec_kp1 -     Ek(iz,iy,ix)) +
+	  (1 - Wj_kp1(iz,iy,ix)) * (ec_jkp1 - Ek_jp1(iz,iy,ix));
 
 	//  dEdk(k+1/4,j+1/2,i) =
 	//       W_j(    k,j+1/2)  * (E(k+1/2,     j) - E(    k,    j)) +
 	//    (1-W_j(    k,j+1/2)) * (E(k+1/2,   j+1) - E(    k,  j+1))
 	dEdk_l =
-	           Wj(iz,iy,ix)  * (     Ek(iz,iy,ix) -     Ec(iz,iy,ix)) +
-	  (1 -     Wj(iz,iy,ix)) * ( Ek_jp1(iz,iy,ix) - Ec_jp1(iz,iy,ix));
+	           Wj(iz,iy,ix)  * (     Ek(iz,iy,ix) -     ec) +
+	  (1 -     Wj(iz,iy,ix)) * ( Ek_jp1(iz,iy,ix) - ec_jp1);
 
-	Eedge(iz,iy,ix) = 0.25*(Ej(iz,iy,ix) + Ej_kp1(iz,iy,ix) +
+	Eedge(iz,iy,ix) = 0.25*(ej + ej_kp1 +
 				Ek(iz,iy,ix) + Ek_jp1(iz,iy,ix) +
 				(dEdj_l-dEdj_r) + (dEdk_l - dEdk_r));
 
@@ -420,21 +438,10 @@ void compute_edge_(int xstart, int ystart, int zstart,
 
 //----------------------------------------------------------------------
 
-void inplace_entry_multiply_(EFlt3DArray &array, enzo_float val){
-  for (int iz = 0; iz < array.shape(0); iz++){
-    for (int iy = 0; iy < array.shape(1); iy++){
-      for (int ix = 0; ix < array.shape(2); ix++){
-	array(iz,iy,ix)*=val;
-      }
-    }
-  }
-}
-
-//----------------------------------------------------------------------
-
 // Computes the edge-centered E-fields pointing in the ith direction
 // It uses the component of the cell-centered E-field pointing in that
-// direction, and the face-centered E-field pointed in that direction
+// direction (computed on the fly from the cell-centered velocity and
+// B-field), and the face-centered E-field pointed in that direction
 // the face-centered E-fields are given by elements of jflux_ids and
 // kflux_ids. dim points along i.
 // i, j, and k are any cyclic permutation of x, y, z
@@ -452,7 +459,7 @@ void inplace_entry_multiply_(EFlt3DArray &array, enzo_float val){
 //     to indicate that the upwind direction is in positive and negative
 //     direction, or 0 to indicate no upwind direction.
 void EnzoBfieldMethodCT::compute_edge_efield
-(int dim, EFlt3DArray &center_efield, EFlt3DArray &edge_efield,
+(int dim, const EnzoEFltArrayMap &prim_map, EFlt3DArray &edge_efield,
  EnzoEFltArrayMap &jflux_map, EnzoEFltArrayMap &kflux_map,
  std::array<EFlt3DArray,3> &weight_l, int stale_depth)
 {
@@ -466,12 +473,24 @@ void EnzoBfieldMethodCT::compute_edge_efield
   CSlice stale_slc = (stale_depth > 0) ?
       CSlice(stale_depth,-stale_depth) : CSlice(nullptr, nullptr);
 
-  // Initialize Cell-Centered E-fields
-  EFlt3DArray Ec, Ec_jp1, Ec_kp1, Ec_jkp1;
-  Ec = center_efield.subarray(stale_slc, stale_slc, stale_slc);
-  Ec_jp1  = coord.left_edge_offset(Ec, 0, 1, 0);
-  Ec_kp1  = coord.left_edge_offset(Ec, 1, 0, 0);
-  Ec_jkp1 = coord.left_edge_offset(Ec, 1, 1, 0);
+  // Initialize Cell-Centered E-fields (from the jth and kth components of
+  // the velocity and cell-centered bfield)
+  const std::string v_names[3] = {"velocity_x", "velocity_y", "velocity_z"};
+  const std::string b_names[3] = {"bfield_x", "bfield_y", "bfield_z"};
+  int j = coord.j_axis();
+  int k = coord.k_axis();
+  EFlt3DArray velocity_j = prim_map.at(v_names[j])
+    .subarray(stale_slc, stale_slc, stale_slc);
+  CenterEfield_ Ec(velocity_j,
+                   prim_map.at(v_names[k]).subarray(stale_slc, stale_slc,
+                                                    stale_slc),
+                   prim_map.at(b_names[j]).subarray(stale_slc, stale_slc,
+                                                    stale_slc),
+                   prim_map.at(b_names[k]).subarray(stale_slc, stale_slc,
+                                                    stale_slc));
+  CenterEfield_ Ec_jp1  = Ec.left_edge_offset(coord, 0, 1, 0);
+  CenterEfield_ Ec_kp1  = Ec.left_edge_offset(coord, 1, 0, 0);
+  CenterEfield_ Ec_jkp1 = Ec.left_edge_offset(coord, 1, 1, 0);
 
   // Initialize edge-centered Efield [it maps (k,j,i) -> (k+1/2,j+1/2,i)]
   EFlt3DArray Eedge = edge_efield.subarray(stale_slc, stale_slc, stale_slc);
@@ -479,10 +498,9 @@ void EnzoBfieldMethodCT::compute_edge_efield
   // Initialize face-centered E-fields
   const std::string keys[] = {"bfield_x", "bfield_y", "bfield_z"};
 
-  // Ex(k,j+1/2,i) = -1.*yflux(Bz)
-  EFlt3DArray Ej = jflux_map.get(keys[coord.k_axis()],stale_depth);
-  inplace_entry_multiply_(Ej,-1.);
-  EFlt3DArray Ej_kp1 = coord.left_edge_offset(Ej, 1, 0, 0);
+  // Ex(k,j+1/2,i) = -1.*yflux(Bz) (compute_edge_ applies the factor of -1)
+  EFlt3DArray jflux = jflux_map.get(keys[coord.k_axis()],stale_depth);
+  EFlt3DArray jflux_kp1 = coord.left_edge_offset(jflux, 1, 0, 0);
 
   // Ex(k+1/2,j,i) = zflux(By)
   EFlt3DArray Ek = kflux_map.get(keys[coord.j_axis()],stale_depth);
@@ -522,9 +540,10 @@ void EnzoBfieldMethodCT::compute_edge_efield
   int zstart = 1 - j_z - k_z; // if dim==2: 1, otherwise: 0
 
   compute_edge_(xstart, ystart, zstart,
-		Ec.shape(2) - 1, Ec.shape(1) - 1, Ec.shape(0) - 1,
+		velocity_j.shape(2) - 1, velocity_j.shape(1) - 1,
+		velocity_j.shape(0) - 1,
 		Eedge, Wj, Wj_kp1, Wk, Wk_jp1, Ec, Ec_jkp1, Ec_jp1, Ec_kp1,
-		Ej, Ej_kp1, Ek, Ek_jp1);
+		jflux, jflux_kp1, Ek, Ek_jp1);
 }
 
 //----------------------------------------------------------------------
@@ -532,14 +551,11 @@ void EnzoBfieldMethodCT::compute_edge_efield
 void EnzoBfieldMethodCT::compute_all_edge_efields
   (EnzoEFltArrayMap &prim_map, EnzoEFltArrayMap &xflux_map,
    EnzoEFltArrayMap &yflux_map, EnzoEFltArrayMap &zflux_map,
-   EFlt3DArray &center_efield, std::array<EFlt3DArray,3> &edge_efield_l,
+   std::array<EFlt3DArray,3> &edge_efield_l,
    std::array<EFlt3DArray,3> &weight_l, int stale_depth)
 {
 
   for (int i = 0; i < 3; i++){
-    EnzoBfieldMethodCT::compute_center_efield(i, center_efield, prim_map,
-                                                    stale_depth);
-
     EnzoEFltArrayMap *jflux_map;
     EnzoEFltArrayMap *kflux_map;
     if (i == 0){
@@ -553,10 +569,53 @@ void EnzoBfieldMethodCT::compute_all_edge_efields
       kflux_map = &yflux_map;
     }
 
-    EnzoBfieldMethodCT::compute_edge_efield(i, center_efield,
-                                                  edge_efield_l[i], *jflux_map,
-                                                  *kflux_map, weight_l,
-                                                  stale_depth);
+    EnzoBfieldMethodCT::compute_edge_efield(i, prim_map, edge_efield_l[i],
+                                            *jflux_map, *kflux_map, weight_l,
+                                            stale_depth);
+  }
+}
+
+//----------------------------------------------------------------------
+
+// Computes the cell-centered B-field component along the ith dimension by
+// averaging the face-centered values for the cells in the box that spans
+// [kstart,kstop), [jstart,jstop), and [istart,istop).
+//
+// b_center holds cell-centered values and bfieldi holds face-centered values
+// (including the exterior faces). The first entries of both arrays must
+// correspond to the same cell.
+//
+// This is specialized on the axis of the face-centered component (see
+// enzo_sweep_dispatch)
+template<class Sweep>
+static void average_faces_(EFlt3DArray &b_center, EFlt3DArray &bfieldi,
+                           int kstart, int kstop, int jstart, int jstop,
+                           int istart, int istop)
+{
+  if ((kstart >= kstop) || (jstart >= jstop) || (istart >= istop)) {return;}
+
+  const EnzoPermutedCoordinates coord = Sweep::coord();
+  CSlice k_slc(kstart, kstop);
+  CSlice j_slc(jstart, jstop);
+  EFlt3DArray bc = coord.get_subarray(b_center, k_slc, j_slc,
+                                      CSlice(istart, istop));
+  EFlt3DArray bi_left = coord.get_subarray(bfieldi, k_slc, j_slc,
+                                           CSlice(istart, istop + 1));
+  // bi_right(k,j,i) -> bi_left(k,j,i+1)
+  const intp right_offset = Sweep::i_offset(bi_left);
+
+  const int nz = bc.shape(0);
+  const int ny = bc.shape(1);
+  const int nx = bc.shape(2);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      enzo_float * const bc_row = &bc(iz,iy,0);
+      const enzo_float * const bi_left_row = &bi_left(iz,iy,0);
+      const enzo_float * const bi_right_row = bi_left_row + right_offset;
+      for (int ix=0; ix<nx; ix++) {
+	bc_row[ix] = 0.5*(bi_left_row[ix] + bi_right_row[ix]);
+      }
+    }
   }
 }
 
@@ -585,75 +644,161 @@ void EnzoBfieldMethodCT::compute_all_edge_efields
 // Then:
 //   E_k_term(k,j,i+1/2) = dt/dj*(ek_Rj(k,j,i) - ek_Lj(k,j,i))
 //   E_j_term(k,j,i+1/2) = dt/dk*(ej_Rk(k,j,i) - ej_Lk(k,j,i))
-void EnzoBfieldMethodCT::update_bfield
-(const enzo_float* &cell_widths, int dim,
- const std::array<EFlt3DArray,3> &efield_l,
- EFlt3DArray &cur_interface_bfield, EFlt3DArray &out_interface_bfield,
- enzo_float dt, int stale_depth)
-{
-  EnzoPermutedCoordinates coord(dim);
-
-  // compute the ratios of dt to the widths of cells along j and k directions
-  enzo_float dtdj = dt/cell_widths[coord.j_axis()];
-  enzo_float dtdk = dt/cell_widths[coord.k_axis()];
+//
+// In the same pass, we compute the ith component of the cell-centered B-field
+// for the cell immediately to the left of each updated face:
+//   B_i(k,j,i) = 0.5*(B_i(k,j,i-1/2) + B_i(k,j,i+1/2))
+// The face at i-1/2 is either the exterior face (which isn't updated) or an
+// interior face that was already updated during an earlier iteration (any
+// position offset by -1 along a single axis is visited earlier). The
+// remaining cell-centered values are computed afterwards.
+//
+// The implementation is specialized on the axis of the face-centered component
+// (see enzo_sweep_dispatch).
+struct UpdateBfieldKernel_{
+
+  template<class Sweep>
+  static void apply(const enzo_float* &cell_widths,
+                    const std::array<EFlt3DArray,3> &efield_l,
+                    EFlt3DArray &cur_interface_bfield,
+                    EFlt3DArray &out_interface_bfield,
+                    EFlt3DArray &center_bfield, enzo_float dt,
+                    int stale_depth)
+  {
+    const EnzoPermutedCoordinates coord = Sweep::coord();
+
+    // compute the ratios of dt to the widths of cells along j and k directions
+    enzo_float dtdj = dt/cell_widths[coord.j_axis()];
+    enzo_float dtdk = dt/cell_widths[coord.k_axis()];
 
-  CSlice stale_slc = (stale_depth > 0) ?
+    CSlice stale_slc = (stale_depth > 0) ?
       CSlice(stale_depth,-stale_depth) : CSlice(nullptr, nullptr);
 
-  // Load edge centered efields 
-  EFlt3DArray E_j, ej_Lk, ej_Rk, E_k, ek_Lj, ek_Rj;
-  E_j = efield_l[coord.j_axis()].subarray(stale_slc, stale_slc, stale_slc);
-  E_k = efield_l[coord.k_axis()].subarray(stale_slc, stale_slc, stale_slc);
-
-  // Load interface bfields (includes exterior faces)
-  EFlt3DArray cur_bfield, bcur, out_bfield, bout;
-  cur_bfield = cur_interface_bfield.subarray(stale_slc, stale_slc, stale_slc);
-  out_bfield = out_interface_bfield.subarray(stale_slc, stale_slc, stale_slc);
-
-  // The following all assume that we are talking about the unstaled region
-  // (i.e. we have dropped all staled cells)
-
-  // Now to take slices. If the unstaled region of the grid has shape
-  // (mk, mj, mi) then:
-  //   - E_j has shape (mk-1, mj, mi-1)
-  //       ej_Lk includes k=1/2 up to (but not including) k=mk-3/2
-  //       ej_Rk includes k=3/2 up to (but not including) k=mk-1/2
-  //   - E_k has shape (mk, mj-1, mi-1)
-  //       ek_Lj includes j=1/2 up to (but not including) j=mj-3/2
-  //       ek_Rj includes j=3/2 up to (but not including) j=mj-1/2
-  //   - cur_bfield and out_bfield each have shape (mk, mj, mi+1)
-  //       bnew and bout only include interior faces
-  //
-  // Also need to omit outermost layer of cell-centered vals
-  CSlice full_ax(nullptr, nullptr); // includes full axis
-  CSlice inner_cent(1,-1);          // excludes outermost cell-centered values
-
-  // the following arrays should all have the same shape
-  ej_Lk = coord.get_subarray(E_j, CSlice(0,      -1), inner_cent, full_ax);
-  ej_Rk = coord.get_subarray(E_j, CSlice(1, nullptr), inner_cent, full_ax);
-  ek_Lj = coord.get_subarray(E_k, inner_cent, CSlice(0,      -1), full_ax);
-  ek_Rj = coord.get_subarray(E_k, inner_cent, CSlice(1, nullptr), full_ax);
-  bcur = coord.get_subarray(cur_bfield, inner_cent, inner_cent, CSlice(1,-1));
-  bout = coord.get_subarray(out_bfield, inner_cent, inner_cent, CSlice(1,-1));
-
-  // We could simplify this iteration by using subarrays - However, it would be
-  // more complicated
-  for (int iz=0; iz<bout.shape(0); iz++) {
-    for (int iy=0; iy<bout.shape(1); iy++) {
-      for (int ix=0; ix<bout.shape(2); ix++) {
-
-	// E_k_term(k,j,i+1/2) = dt/dj*(E_k(k,j+1/2,i+1/2) - E_k(k,j-1/2,i+1/2))
-	enzo_float E_k_term = dtdj*(ek_Rj(iz,iy,ix) - ek_Lj(iz,iy,ix));
-
-	// E_j_term(k,j,i+1/2) = dt/dk*(E_j(k+1/2,j,i+1/2) - E_j(k-1/2,j,i+1/2))
-	enzo_float E_j_term = dtdk*(ej_Rk(iz,iy,ix) - ej_Lk(iz,iy,ix)); 
-
-	// Bnew_i(k, j, i+1/2) =
-	//   Bold_i(k, j, i+1/2) - E_k_term(k,j,i+1/2) + E_j_term(k,j,i+1/2)
-	bout(iz,iy,ix) = bcur(iz,iy,ix) - E_k_term + E_j_term;
+    // Load edge centered efields
+    EFlt3DArray E_j, ej_Lk, E_k, ek_Lj;
+    E_j = efield_l[coord.j_axis()].subarray(stale_slc, stale_slc, stale_slc);
+    E_k = efield_l[coord.k_axis()].subarray(stale_slc, stale_slc, stale_slc);
+
+    // Load interface bfields (includes exterior faces)
+    EFlt3DArray cur_bfield, bcur, out_bfield, bout_left;
+    cur_bfield = cur_interface_bfield.subarray(stale_slc, stale_slc,
+                                               stale_slc);
+    out_bfield = out_interface_bfield.subarray(stale_slc, stale_slc,
+                                               stale_slc);
+
+    // Load the cell-centered bfield
+    EFlt3DArray b_center = center_bfield.subarray(stale_slc, stale_slc,
+                                                  stale_slc);
+
+    // The following all assume that we are talking about the unstaled region
+    // (i.e. we have dropped all staled cells)
+
+    // Now to take slices. If the unstaled region of the grid has shape
+    // (mk, mj, mi) then:
+    //   - E_j has shape (mk-1, mj, mi-1)
+    //       ej_Lk includes k=1/2 up to (but not including) k=mk-3/2
+    //       ej_Rk includes k=3/2 up to (but not including) k=mk-1/2
+    //   - E_k has shape (mk, mj-1, mi-1)
+    //       ek_Lj includes j=1/2 up to (but not including) j=mj-3/2
+    //       ek_Rj includes j=3/2 up to (but not including) j=mj-1/2
+    //   - cur_bfield and out_bfield each have shape (mk, mj, mi+1)
+    //       bnew and bout only include interior faces
+    //       bout_left includes the faces immediately to the left of bout
+    //   - b_center has shape (mk, mj, mi)
+    //       bc only includes the cells immediately to the left of bout
+    //
+    // Only the arrays with a "L" suffix, bcur, bout_left and bc are actually
+    // constructed. ej_Rk, ek_Rj and bout are accessed through offsets (along
+    // k, j, and i) from rows of ej_Lk, ek_Lj and bout_left.
+    //
+    // Also need to omit outermost layer of cell-centered vals
+    CSlice full_ax(nullptr, nullptr); // includes full axis
+    CSlice inner_cent(1,-1);          // excludes outermost cell-centered vals
+
+    // the following arrays should all have the same shape
+    ej_Lk = coord.get_subarray(E_j, CSlice(0,      -1), inner_cent, full_ax);
+    ek_Lj = coord.get_subarray(E_k, inner_cent, CSlice(0,      -1), full_ax);
+    bcur = coord.get_subarray(cur_bfield, inner_cent, inner_cent,
+                              CSlice(1,-1));
+    bout_left = coord.get_subarray(out_bfield, inner_cent, inner_cent,
+                                   CSlice(0,-2));
+    EFlt3DArray bc = coord.get_subarray(b_center, inner_cent, inner_cent,
+                                        CSlice(0,-1));
+
+    const int nz = bc.shape(0);
+    const int ny = bc.shape(1);
+    const int nx = bc.shape(2);
+
+    if ((nz > 0) && (ny > 0) && (nx > 0)) {
+      // offsets between neighboring elements along k, j, and i (the k and j
+      // offsets are taken from arrays with the same strides as ej_Lk, ek_Lj)
+      const intp ej_k_offset =
+        EnzoSweepSpec<(Sweep::i_axis + 2) % 3>::i_offset(E_j);
+      const intp ek_j_offset =
+        EnzoSweepSpec<(Sweep::i_axis + 1) % 3>::i_offset(E_k);
+      const intp bout_offset = Sweep::i_offset(out_bfield);
+
+      for (int iz=0; iz<nz; iz++) {
+        for (int iy=0; iy<ny; iy++) {
+          const enzo_float * const ej_Lk_row = &ej_Lk(iz,iy,0);
+          const enzo_float * const ej_Rk_row = ej_Lk_row + ej_k_offset;
+          const enzo_float * const ek_Lj_row = &ek_Lj(iz,iy,0);
+          const enzo_float * const ek_Rj_row = ek_Lj_row + ek_j_offset;
+          const enzo_float * const bcur_row = &bcur(iz,iy,0);
+          enzo_float * const bout_left_row = &bout_left(iz,iy,0);
+          enzo_float * const bout_row = bout_left_row + bout_offset;
+          enzo_float * const bc_row = &bc(iz,iy,0);
+
+          for (int ix=0; ix<nx; ix++) {
+
+            // E_k_term(k,j,i+1/2) =
+            //     dt/dj*(E_k(k,j+1/2,i+1/2) - E_k(k,j-1/2,i+1/2))
+            enzo_float E_k_term = dtdj*(ek_Rj_row[ix] - ek_Lj_row[ix]);
+
+            // E_j_term(k,j,i+1/2) =
+            //     dt/dk*(E_j(k+1/2,j,i+1/2) - E_j(k-1/2,j,i+1/2))
+            enzo_float E_j_term = dtdk*(ej_Rk_row[ix] - ej_Lk_row[ix]);
+
+            // Bnew_i(k, j, i+1/2) =
+            //   Bold_i(k, j, i+1/2) - E_k_term(k,j,i+1/2) + E_j_term(k,j,i+1/2)
+            enzo_float bnew = bcur_row[ix] - E_k_term + E_j_term;
+            bout_row[ix] = bnew;
+
+            // B_i(k,j,i) = 0.5*(B_i(k,j,i-1/2) + B_i(k,j,i+1/2))
+            bc_row[ix] = 0.5*(bout_left_row[ix] + bnew);
+          }
+        }
       }
     }
+
+    // Compute the remaining cell-centered values. These include the outermost
+    // cells along the j and k axes (their faces are not updated) and the last
+    // cell along the i axis
+    int mk = b_center.shape(2 - coord.k_axis());
+    int mj = b_center.shape(2 - coord.j_axis());
+    int mi = b_center.shape(2 - coord.i_axis());
+    average_faces_<Sweep>(b_center, out_bfield,      0,      1, 0, mj, 0, mi);
+    average_faces_<Sweep>(b_center, out_bfield, mk - 1,     mk, 0, mj, 0, mi);
+    average_faces_<Sweep>(b_center, out_bfield,      1, mk - 1, 0,  1, 0, mi);
+    average_faces_<Sweep>(b_center, out_bfield,      1, mk - 1, mj - 1, mj,
+                          0, mi);
+    average_faces_<Sweep>(b_center, out_bfield,      1, mk - 1, 1, mj - 1,
+                          mi - 1, mi);
   }
+};
+
+//----------------------------------------------------------------------
+
+void EnzoBfieldMethodCT::update_bfield
+(const enzo_float* &cell_widths, int dim,
+ const std::array<EFlt3DArray,3> &efield_l,
+ EFlt3DArray &cur_interface_bfield, EFlt3DArray &out_interface_bfield,
+ EFlt3DArray &center_bfield, enzo_float dt, int stale_depth)
+{
+  enzo_sweep_dispatch<UpdateBfieldKernel_>(dim, cell_widths, efield_l,
+                                           cur_interface_bfield,
+                                           out_interface_bfield,
+                                           center_bfield, dt, stale_depth);
 }
 
 //----------------------------------------------------------------------
@@ -669,28 +814,33 @@ void EnzoBfieldMethodCT::update_bfield
 //   B_center(k,j,i)   ->  B_i(k,j,i+1)
 //   Bi_left(k,j,i)    ->  B_i(k,j,i+1/2)
 //   Bi_right(k,j,i)   ->  B_i(k,j,i+3/2)
+// Kernel that is specialized on the axis of the face-centered component (see
+// enzo_sweep_dispatch)
+struct CenterBfieldKernel_{
+  template<class Sweep>
+  static void apply(EFlt3DArray &b_center, EFlt3DArray &bi)
+  {
+    const EnzoPermutedCoordinates coord = Sweep::coord();
+    // iteration limits are compatible with a 2D grid and 3D grid
+    average_faces_<Sweep>(b_center, bi,
+                          0, b_center.shape(2 - coord.k_axis()),
+                          0, b_center.shape(2 - coord.j_axis()),
+                          0, b_center.shape(2 - coord.i_axis()));
+  }
+};
+
 void EnzoBfieldMethodCT::compute_center_bfield(int dim,
                                                EFlt3DArray &bfieldc_comp,
                                                EFlt3DArray &bfieldi_comp,
                                                int stale_depth)
 {
-  EnzoPermutedCoordinates coord(dim);
   CSlice stale_slc = (stale_depth > 0) ?
       CSlice(stale_depth,-stale_depth) : CSlice(nullptr, nullptr);
 
   // Load Cell-centered fields
   EFlt3DArray b_center = bfieldc_comp.subarray(stale_slc,stale_slc,stale_slc);
   // Load Face-centered fields
-  EFlt3DArray bi_left = bfieldi_comp.subarray(stale_slc,stale_slc,stale_slc);
-  // Get the view of the Face-center B-field that starting from i=1
-  EFlt3DArray bi_right = coord.left_edge_offset(bi_left,0,0,1);
-
-  // iteration limits are compatible with a 2D grid and 3D grid
-  for (int iz=0; iz<b_center.shape(0); iz++) {
-    for (int iy=0; iy<b_center.shape(1); iy++) {
-      for (int ix=0; ix<b_center.shape(2); ix++) {
-	b_center(iz,iy,ix) = 0.5*(bi_left(iz,iy,ix) + bi_right(iz,iy,ix));
-      }
-    }
-  }
+  EFlt3DArray bi = bfieldi_comp.subarray(stale_slc,stale_slc,stale_slc);
+
+  enzo_sweep_dispatch<CenterBfieldKernel_>(dim, b_center, bi);
 }
@@ -54,9 +54,13 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
+  /// @param[in]     region Slices (ordered z, y, x) specifying the region of
+  ///     the block that the arrays in `l_map` and `r_map` correspond to.
   void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
                                     EnzoEFltArrayMap &r_map, int dim,
-                                    int stale_depth) noexcept;
+                                    int stale_depth,
+                                    const std::array<CSlice,3> &region)
+    noexcept;
 
   /// identifies and stores the upwind direction
   ///
@@ -65,8 +69,11 @@ public: // interface
   /// @param[in] dim The dimension to identify the upwind direction along.
   /// @param[in] stale_depth The current staling depth. This should match the
   ///     staling depth used to compute the flux_group.
+  /// @param[in] region Slices (ordered z, y, x) specifying the region of the
+  ///     block that the arrays in `flux_map` correspond to.
   void identify_upwind(const EnzoEFltArrayMap &flux_map, int dim,
-                       int stale_depth) noexcept;
+                       int stale_depth, const std::array<CSlice,3> &region)
+    noexcept;
 
   /// Updates all components of the face-centered and the cell-centered bfields
   ///
@@ -110,7 +117,9 @@ public: // interface
   /// @param[in]  stale_depth indicates the current stale_depth for the
   ///     supplied quantities.
   ///
-  /// @note this function is called in `update_all_bfield_components`
+  /// @note `update_all_bfield_components` doesn't call this function. Instead,
+  /// `update_bfield` computes the cell-centered values while it updates the
+  /// face-centered values.
   static void compute_center_bfield(int dim, EFlt3DArray &bfieldc_comp,
 				    EFlt3DArray &bfieldi_comp,
                                     int stale_depth = 0);
@@ -127,22 +136,6 @@ protected: // methods
   void register_target_block_(Block *target_block,
                               bool first_initialization) noexcept;
 
-  /// Computes component i of the cell-centered E-field.
-  ///
-  /// @param[in]  dim The component of the cell-centered E-field to compute.
-  ///     Values of 0, 1 and 2 correspond to the x, y and z directions.
-  /// @param[out] center_efield The array where the computed cell-centered
-  ///     values of the E-field are written.
-  /// @param[in]  prim_map Map containing the current values of the
-  ///     cell-centered integrable quantities. Specifically, the velocity and
-  ///     bfield entries are used to compute the cell-centered E-field.
-  /// @param[in]  stale_depth the stale depth at the time of this function call
-  ///
-  /// @note this function is called in `compute_all_edge_efields`
-  static void compute_center_efield(int dim, EFlt3DArray &center_efield,
-                                    const EnzoEFltArrayMap &prim_map,
-                                    int stale_depth = 0);
-
   /// Computes component i of the edge-centered E-field that sits on the faces
   /// of dimensions j and k (i, j, and k are any cyclic permutation of x, y, z).
   /// This uses the component i of the cell-centered E-field and component i
@@ -150,16 +143,20 @@ protected: // methods
   /// B-field stored in jflux_group and kflux_group). Additionally, it requires
   /// knowledge of the upwind direction on the j and k faces.
   ///
+  /// The cell-centered E-field is computed on the fly (it's never stored in
+  /// a separate array).
+  ///
   /// @param[in]  dim The component of the edge-centered E-field to compute.
   ///     Values of 0, 1 and 2 correspond to the x, y and z directions.
-  /// @param[in]  center_efield The array holding the cell-centered values for
-  ///     component `dim` of the E-field.
+  /// @param[in]  prim_map Map containing the current values of the
+  ///     cell-centered integrable quantities. Specifically, the velocity and
+  ///     bfield entries are used to compute the cell-centered E-field.
   /// @param[out] edge_efield The array where the edge centered values for
   ///     component `dim` of the E-field are to be written. The array should
-  ///     have the same number of elements as `center_efield` along dimensions
-  ///     `dim` and one more element along the other dimensions (e.g. The
-  ///     x-component is cell-centered along the x-direction an face-centered
-  ///     along the y- and z-axes).
+  ///     have the same number of elements as a cell-centered array along
+  ///     dimensions `dim` and one fewer element along the other dimensions
+  ///     (e.g. The x-component is cell-centered along the x-direction an
+  ///     face-centered along the y- and z-axes).
   /// @param[in]  jflux_map,kflux_map Maps containing the values of the fluxes
   ///     along the j- and k- dimensions (where the dimension i is aligned with
   ///     `dim`). The function namely makes use of the magnetic field fluxes.
@@ -172,7 +169,7 @@ protected: // methods
   /// @param[in]  stale_depth the stale depth at the time of this function call
   ///
   /// @note this function is called in compute_all_edge_efields
-  void static compute_edge_efield (int dim, EFlt3DArray &center_efield,
+  void static compute_edge_efield (int dim, const EnzoEFltArrayMap &prim_map,
 				   EFlt3DArray &edge_efield,
                                    EnzoEFltArrayMap &jflux_map,
                                    EnzoEFltArrayMap &kflux_map,
@@ -190,10 +187,6 @@ protected: // methods
   /// @param[in]  xflux_map,yflux_map,zflux_map Maps containing the values of
   ///     the fluxes computed along the x, y, and z directions. The function
   ///     namely makes use of the various magnetic field fluxes
-  /// @param[in] center_efield The array where the computed cell-centered
-  ///     values of different components of the E-field are temporarily written
-  ///     (and then possibly overwritten). This is effectively a preallocated
-  ///     scratch buffer whose input values are insignificant.
   /// @param[out] edge_efield_l A set of arrays where the values for each
   ///     component of the edge-centered E-field are to be written. Each entry
   ///     corresponds to a different component. Entries 0, 1, and 2 are used to
@@ -210,11 +203,13 @@ protected: // methods
   static void compute_all_edge_efields
   (EnzoEFltArrayMap &prim_map, EnzoEFltArrayMap &xflux_map,
    EnzoEFltArrayMap &yflux_map, EnzoEFltArrayMap &zflux_map,
-   EFlt3DArray &center_efield, std::array<EFlt3DArray,3> &edge_efield_l,
+   std::array<EFlt3DArray,3> &edge_efield_l,
    std::array<EFlt3DArray,3> &weight_l, int stale_depth);
 
   /// Updates the face-centered B-field component along the ith dimension using
-  /// the jth and kth components of the edge-centered E-field
+  /// the jth and kth components of the edge-centered E-field. In the same
+  /// pass, the ith component of the cell-centered B-field is computed from the
+  /// updated face-centered values (see `compute_center_bfield`).
   ///
   /// @param[in]  dim The component of the interface B-field to update.
   ///     Values of 0, 1 and 2 correspond to the x, y and z directions.
@@ -238,6 +233,8 @@ protected: // methods
   ///     should have the same shape as `cur_interface_bfield`. This can either
   ///     be the same array passed to `cur_interface_bfield`, or a completely
   ///     different array.
+  /// @param[out] center_bfield Array where the updated cell-centered values
+  ///     of the `dim` component of the B-field are written.
   /// @param[in] dt The time time-step over which to apply the fluxes
   /// @param[in] stale_depth indicates the current stale_depth for the supplied
   ///     quantities
@@ -245,6 +242,7 @@ protected: // methods
                             const std::array<EFlt3DArray,3> &efield_l,
                             EFlt3DArray &cur_interface_bfield,
                             EFlt3DArray &out_interface_bfield,
+                            EFlt3DArray &center_bfield,
 			    enzo_float dt, int stale_depth);
 
 protected: // attributes
@@ -293,9 +291,5 @@ protected: // attributes
   /// respectively.
   std::array<EFlt3DArray,3> edge_efield_l_;
 
-  /// Array used to temporarily store cell-centered values of different
-  /// electric field components. This array is reused for each component.
-  EFlt3DArray center_efield_;
-
 };
 #endif /* ENZO_ENZO_BFIELDMETHODCT_HPP */
@@ -200,17 +200,23 @@ public: // interface
 
 public: /// entry methods
 
-  /// Perform the necessary reductions
-  CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs);
-
-  /// Compute sum, min, and max of g values for EnzoMethodTurbulence
-  void p_method_turbulence_end(CkReductionMsg *msg);
+  /// Continue EnzoMethodTurbulence after reducing sum, min, and max
+  /// of g values
+  void p_method_turbulence_end();
 
   /// TEMP
   double timestep() { return dt; }
 
   //--------------------------------------------------
 
+  /// Continue EnzoMethodHeat after the implicit solve
+  void p_method_heat_end();
+
+  //--------------------------------------------------
+
+  /// Solve for potential after refreshing the initial guess
+  void p_method_gravity_solve();
+
   /// Synchronize after potential solve and before accelerations
   void p_method_gravity_continue();
 
@@ -220,22 +226,22 @@ public: /// entry methods
   //--------------------------------------------------
 
   /// EnzoSolverCg entry method: DOT ==> refresh P
-  void r_solver_cg_loop_0a (CkReductionMsg * msg) ;  
+  void p_solver_cg_loop_0a () ;  
 
   /// EnzoSolverCg entry method: ==> refresh P
-  void r_solver_cg_loop_0b (CkReductionMsg * msg) ;  
+  void p_solver_cg_loop_0b () ;  
 
   /// EnzoSolverCg entry method: DOT(R,R) after shift
-  void r_solver_cg_shift_1 (CkReductionMsg * msg) ;
+  void p_solver_cg_shift_1 () ;
 
   /// EnzoSolverCg entry method
   void p_solver_cg_loop_2 () ;
 
   /// EnzoSolverCg entry method: DOT(P,AP)
-  void r_solver_cg_loop_3 (CkReductionMsg * msg) ;
+  void p_solver_cg_loop_3 () ;
 
   /// EnzoSolverCg entry method: DOT(R,R)
-  void r_solver_cg_loop_5 (CkReductionMsg * msg) ;
+  void p_solver_cg_loop_5 () ;
 
   /// EnzoSolverCg entry method: 
   /// perform the necessary reductions for shift
@@ -275,12 +281,12 @@ public: /// entry methods
   /// EnzoSolverBiCGStab entry method: ITER++
   void r_solver_bicgstab_loop_15(CkReductionMsg* msg);
 
-  void p_dot_recv_parent  (int n, long double * dot_block,
-			   std::vector<int> is_array,
-			   int i_function, int iter);
-  void p_dot_recv_children(int n, long double * dot_block,
-			   std::vector<int> is_array,
-			   int i_function);
+  /// EnzoSolverBiCGStab entry method: tree reduction complete
+  void p_solver_bicgstab_dot_done();
+
+  // EnzoSolverChebyshev
+
+  void p_solver_chebyshev_continue();
 
 /// EnzoSolverDd
   
@@ -293,6 +299,13 @@ public: /// entry methods
   void r_solver_dd_barrier(CkReductionMsg* msg);
   void r_solver_dd_end(CkReductionMsg* msg);
 
+  // EnzoSolverFft
+
+  void p_solver_fft_gather(int is, Index index,
+			   int ibx, int iby, int ibz,
+			   int n, double * b);
+  void p_solver_fft_scatter(int n, double * x);
+
   // EnzoSolverJacobi
 
   void p_solver_jacobi_continue();
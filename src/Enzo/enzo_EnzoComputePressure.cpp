@@ -128,32 +128,50 @@ void EnzoComputePressure::compute_(Block * block,
     int m = (nx+2*gx) * (ny+2*gy) * (nz+2*gz);
     enzo_float gm1 = gamma_ - 1.0;
 
+    // the cells are independent, so they are divided among threads
+
     if (enzo::config()->ppm_dual_energy) {
 
-      for (int i=0; i<m; i++) {
-        p[i] = gm1 * d[i] * ie[i];
-      }
+      cello::parallel_for_range
+        (0, m, [=] (int first, int last)
+         {
+           for (int i=first; i<last; i++) {
+             p[i] = gm1 * d[i] * ie[i];
+           }
+         });
 
     } else {
       if (rank == 1) {
-        for (int i=0; i<m; i++) {
-          enzo_float ke = 0.5*vx[i]*vx[i];
-          enzo_float me_den = mhd ? 0.5*bx[i]*bx[i] : 0.;
-          p[i] = gm1 * (d[i] * (te[i] - ke) - me_den);
-        }
+        cello::parallel_for_range
+          (0, m, [=] (int first, int last)
+           {
+             for (int i=first; i<last; i++) {
+               enzo_float ke = 0.5*vx[i]*vx[i];
+               enzo_float me_den = mhd ? 0.5*bx[i]*bx[i] : 0.;
+               p[i] = gm1 * (d[i] * (te[i] - ke) - me_den);
+             }
+           });
       } else if (rank == 2) {
-        for (int i=0; i<m; i++) {
-          enzo_float ke = 0.5*(vx[i]*vx[i] + vy[i]*vy[i]);
-          enzo_float me_den = mhd ? 0.5*(bx[i]*bx[i] + by[i]*by[i]) : 0.;
-          p[i] = gm1 * (d[i] * (te[i] - ke) - me_den);
-        }
+        cello::parallel_for_range
+          (0, m, [=] (int first, int last)
+           {
+             for (int i=first; i<last; i++) {
+               enzo_float ke = 0.5*(vx[i]*vx[i] + vy[i]*vy[i]);
+               enzo_float me_den = mhd ? 0.5*(bx[i]*bx[i] + by[i]*by[i]) : 0.;
+               p[i] = gm1 * (d[i] * (te[i] - ke) - me_den);
+             }
+           });
       } else if (rank == 3) {
-        for (int i=0; i<m; i++) {
-          enzo_float ke = 0.5*(vx[i]*vx[i] + vy[i]*vy[i] + vz[i]*vz[i]);
-          enzo_float me_den = mhd ?
-            0.5*(bx[i]*bx[i] + by[i]*by[i] + bz[i]*bz[i]) : 0.;
-          p[i] = gm1 * (d[i] * (te[i] - ke) - me_den);
-        }
+        cello::parallel_for_range
+          (0, m, [=] (int first, int last)
+           {
+             for (int i=first; i<last; i++) {
+               enzo_float ke = 0.5*(vx[i]*vx[i] + vy[i]*vy[i] + vz[i]*vz[i]);
+               enzo_float me_den = mhd ?
+                 0.5*(bx[i]*bx[i] + by[i]*by[i] + bz[i]*bz[i]) : 0.;
+               p[i] = gm1 * (d[i] * (te[i] - ke) - me_den);
+             }
+           });
       }
     }
   }
@@ -22,6 +22,7 @@ EnzoConfig::EnzoConfig() throw ()
   ppm_dual_energy_eta_1(0.0),
   ppm_dual_energy_eta_2(0.0),
   ppm_flattening(0),
+  ppm_flattening_per_pencil(false),
   ppm_minimum_pressure_support_parameter(0),
   ppm_number_density_floor(0.0),
   ppm_density_floor(0.0),
@@ -184,6 +185,9 @@ EnzoConfig::EnzoConfig() throw ()
   method_check_gravity_particle_type(),
   // EnzoMethodHeat
   method_heat_alpha(0.0),
+  method_heat_solver(""),
+  method_heat_theta(1.0),
+  method_heat_overlap(false),
 
   // EnzoMethodHydro
   method_hydro_method(""),
@@ -233,6 +237,7 @@ EnzoConfig::EnzoConfig() throw ()
   method_gravity_solver(""),
   method_gravity_order(4),
   method_gravity_accumulate(false),
+  method_gravity_initial_guess(""),
   /// EnzoMethodBackgroundAcceleration
   method_background_acceleration_type(""),
   method_background_acceleration_mass(0.0),
@@ -260,6 +265,7 @@ EnzoConfig::EnzoConfig() throw ()
   method_vlct_mhd_choice(""),
   method_vlct_dual_energy(false),
   method_vlct_dual_energy_eta(0.0),
+  method_vlct_tile_size(0),
   /// EnzoProlong
   prolong_enzo_type(),
   prolong_enzo_positive(true),
@@ -270,11 +276,16 @@ EnzoConfig::EnzoConfig() throw ()
   solver_coarse_solve(),
   solver_domain_solve(),
   solver_weight(),
+  solver_eigen_ratio(),
+  solver_sweeps_per_refresh(),
   solver_restart_cycle(),
   /// EnzoSolver<Krylov>
   solver_precondition(),
   solver_coarse_level(),
   solver_is_unigrid(),
+  solver_expand_residual_dots(),
+  solver_mixed_precision(),
+  solver_deflate(),
   stopping_redshift()
 
 {
@@ -329,6 +340,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | ppm_dual_energy_eta_1;
   p | ppm_dual_energy_eta_2;
   p | ppm_flattening;
+  p | ppm_flattening_per_pencil;
   p | ppm_minimum_pressure_support_parameter;
   p | ppm_number_density_floor;
   p | ppm_density_floor;
@@ -507,6 +519,9 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_check_gravity_particle_type;
 
   p | method_heat_alpha;
+  p | method_heat_solver;
+  p | method_heat_theta;
+  p | method_heat_overlap;
 
   p | method_hydro_method;
   p | method_hydro_dual_energy;
@@ -548,6 +563,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_gravity_solver;
   p | method_gravity_order;
   p | method_gravity_accumulate;
+  p | method_gravity_initial_guess;
 
   p | method_background_acceleration_type;
   p | method_background_acceleration_mass;
@@ -576,6 +592,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_vlct_mhd_choice;
   p | method_vlct_dual_energy;
   p | method_vlct_dual_energy_eta;
+  p | method_vlct_tile_size;
 
   p | prolong_enzo_type;
   p | prolong_enzo_positive;
@@ -586,10 +603,15 @@ void EnzoConfig::pup (PUP::er &p)
   p | solver_coarse_solve;
   p | solver_domain_solve;
   p | solver_weight;
+  p | solver_eigen_ratio;
+  p | solver_sweeps_per_refresh;
   p | solver_restart_cycle;
   p | solver_precondition;
   p | solver_coarse_level;
   p | solver_is_unigrid;
+  p | solver_expand_residual_dots;
+  p | solver_mixed_precision;
+  p | solver_deflate;
 
   p | stopping_redshift;
 
@@ -652,6 +674,8 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:ppm:dual_energy_eta_2", 0.1);
   ppm_flattening = p->value_integer
     ("Method:ppm:flattening", 3);
+  ppm_flattening_per_pencil = p->value_logical
+    ("Method:ppm:flattening_per_pencil", false);
   ppm_minimum_pressure_support_parameter = p->value_integer
     ("Method:ppm:minimum_pressure_support_parameter",100);
   ppm_number_density_floor = p->value_float
@@ -1068,6 +1092,15 @@ void EnzoConfig::read(Parameters * p) throw()
   method_heat_alpha = p->value_float
     ("Method:heat:alpha",1.0);
 
+  method_heat_solver = p->value_string
+    ("Method:heat:solver","");
+
+  method_heat_theta = p->value_float
+    ("Method:heat:theta",1.0);
+
+  method_heat_overlap = p->value_logical
+    ("Method:heat:overlap",false);
+
   method_hydro_method = p->value_string
     ("Method:hydro:method","ppm");
 
@@ -1170,6 +1203,9 @@ void EnzoConfig::read(Parameters * p) throw()
   method_gravity_accumulate = p->value_logical
     ("Method:gravity:accumulate",true);
 
+  method_gravity_initial_guess = p->value_string
+    ("Method:gravity:initial_guess","zero");
+
   method_background_acceleration_type = p->value_string
    ("Method:background_acceleration:type","unknown");
 
@@ -1235,6 +1271,8 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:mhd_vlct:dual_energy", false);
   method_vlct_dual_energy_eta = p->value_float
     ("Method:mhd_vlct:dual_energy_eta", 0.001);
+  method_vlct_tile_size = p->value_integer
+    ("Method:mhd_vlct:tile_size", 0);
 
   // we should raise an error if mhd_choice is not specified
   bool uses_vlct = false;
@@ -1313,10 +1351,15 @@ void EnzoConfig::read(Parameters * p) throw()
   solver_post_smooth. resize(num_solvers);
   solver_last_smooth. resize(num_solvers);
   solver_weight.      resize(num_solvers);
+  solver_eigen_ratio. resize(num_solvers);
+  solver_sweeps_per_refresh.resize(num_solvers);
   solver_restart_cycle.resize(num_solvers);
   solver_precondition.resize(num_solvers);
   solver_coarse_level.resize(num_solvers);
   solver_is_unigrid.resize(num_solvers);
+  solver_expand_residual_dots.resize(num_solvers);
+  solver_mixed_precision.resize(num_solvers);
+  solver_deflate.resize(num_solvers);
 
   for (int index_solver=0; index_solver<num_solvers; index_solver++) {
 
@@ -1370,6 +1413,12 @@ void EnzoConfig::read(Parameters * p) throw()
     solver_weight[index_solver] =
       p->value_float(solver_name + ":weight",1.0);
 
+    solver_eigen_ratio[index_solver] =
+      p->value_float(solver_name + ":eigen_ratio",0.0);
+
+    solver_sweeps_per_refresh[index_solver] =
+      p->value_integer(solver_name + ":sweeps_per_refresh",1);
+
     solver_restart_cycle[index_solver] =
       p->value_integer(solver_name + ":restart_cycle",1);
 
@@ -1380,6 +1429,15 @@ void EnzoConfig::read(Parameters * p) throw()
     solver_is_unigrid[index_solver] =
       p->value_logical (solver_name + ":is_unigrid",false);
 
+    solver_expand_residual_dots[index_solver] =
+      p->value_logical (solver_name + ":expand_residual_dots",false);
+
+    solver_mixed_precision[index_solver] =
+      p->value_logical (solver_name + ":mixed_precision",false);
+
+    solver_deflate[index_solver] =
+      p->value_logical (solver_name + ":deflate",false);
+
   }
 
   //======================================================================
@@ -113,6 +113,7 @@ public: // interface
       ppm_dual_energy_eta_1(0.0),
       ppm_dual_energy_eta_2(0.0),
       ppm_flattening(0),
+      ppm_flattening_per_pencil(false),
       ppm_minimum_pressure_support_parameter(0),
       ppm_number_density_floor(0.0),
       ppm_density_floor(0.0),
@@ -279,6 +280,9 @@ public: // interface
       method_check_gravity_particle_type(),
       // EnzoMethodHeat
       method_heat_alpha(0.0),
+      method_heat_solver(""),
+      method_heat_theta(1.0),
+      method_heat_overlap(false),
       // EnzoMethodHydro
       method_hydro_method(""),
       method_hydro_dual_energy(false),
@@ -328,6 +332,7 @@ public: // interface
       method_gravity_solver(""),
       method_gravity_order(4),
       method_gravity_accumulate(false),
+      method_gravity_initial_guess(""),
       // EnzoMethodBackgroundAcceleration
       method_background_acceleration_type(""),
       method_background_acceleration_mass(0.0),
@@ -355,6 +360,7 @@ public: // interface
       method_vlct_mhd_choice(""),
       method_vlct_dual_energy(false),
       method_vlct_dual_energy_eta(0.0),
+      method_vlct_tile_size(0),
       // EnzoProlong
       prolong_enzo_type(),
       prolong_enzo_positive(true),
@@ -365,11 +371,16 @@ public: // interface
       solver_coarse_solve(),
       solver_domain_solve(),
       solver_weight(),
+      solver_eigen_ratio(),
+      solver_sweeps_per_refresh(),
       solver_restart_cycle(),
       // EnzoSolver<Krylov>
       solver_precondition(),
       solver_coarse_level(),
       solver_is_unigrid(),
+      solver_expand_residual_dots(),
+      solver_mixed_precision(),
+      solver_deflate(),
       // EnzoStopping
       stopping_redshift()
 
@@ -413,6 +424,7 @@ public: // attributes
   double                     ppm_dual_energy_eta_1;
   double                     ppm_dual_energy_eta_2;
   int                        ppm_flattening;
+  bool                       ppm_flattening_per_pencil;
   int                        ppm_minimum_pressure_support_parameter;
   double                     ppm_number_density_floor;
   double                     ppm_density_floor;
@@ -614,6 +626,9 @@ public: // attributes
 
   /// EnzoMethodHeat
   double                     method_heat_alpha;
+  std::string                method_heat_solver;
+  double                     method_heat_theta;
+  bool                       method_heat_overlap;
 
   /// EnzoMethodHydro
   std::string                method_hydro_method;
@@ -674,6 +689,7 @@ public: // attributes
   std::string                method_gravity_solver;
   int                        method_gravity_order;
   bool                       method_gravity_accumulate;
+  std::string                method_gravity_initial_guess;
 
   /// EnzoMethodBackgroundAcceleration
 
@@ -713,6 +729,8 @@ public: // attributes
   // unlike ppm, only use a single eta value. It should have a default value
   // closer to method_ppm_dual_energy_eta1
   double                     method_vlct_dual_energy_eta;
+  // number of cells per tile when fluxes are computed in tiles (0 disables)
+  int                        method_vlct_tile_size;
 
 
   std::string                prolong_enzo_type;
@@ -746,6 +764,15 @@ public: // attributes
 
   std::vector<double>        solver_weight;
 
+  /// EnzoSolverChebyshev: ratio of the largest to smallest eigenvalue
+  /// of the interval damped by the smoother
+
+  std::vector<double>        solver_eigen_ratio;
+
+  /// EnzoSolverJacobi: number of sweeps between ghost zone refreshes
+
+  std::vector<int>           solver_sweeps_per_refresh;
+
   /// Whether to start the iterative solver using the previous solution
 
   std::vector<int>           solver_restart_cycle;
@@ -760,6 +787,18 @@ public: // attributes
   std::vector<int>           solver_coarse_level;
   std::vector<int>           solver_is_unigrid;
 
+  /// EnzoSolverBiCgStab: whether to compute DOT(R,R) and DOT(R,R0)
+  /// by expanding R = Q - omega * U in the preceding reduction
+  std::vector<int>           solver_expand_residual_dots;
+
+  /// EnzoSolverMg0: whether to send restricted residuals and prolonged
+  /// corrections in single precision
+  std::vector<int>           solver_mixed_precision;
+
+  /// EnzoSolverCg: whether to deflate the low modes using one coarse
+  /// unknown per root-level block
+  std::vector<int>           solver_deflate;
+
   /// Stop at specified redshift for cosmology
   double                     stopping_redshift;
 
@@ -10,11 +10,111 @@
 
 //----------------------------------------------------------------------
 
+EnzoEFltArrayMap::EnzoEFltArrayMap(std::string name,
+                                   const std::vector<std::string> &keys,
+                                   const std::array<int,3> &shape)
+  : EnzoEFltArrayMap(name)
+{
+  if (keys.size() > 0){
+    backing_array_ = CelloArray<enzo_float,4>((int)keys.size(), shape[0],
+                                              shape[1], shape[2]);
+  }
+  for (std::size_t i = 0; i < keys.size(); i++){
+    insert_(keys[i], backing_array_.reduced_dim_slice(i));
+  }
+  frozen_ = true;
+}
+
+//----------------------------------------------------------------------
+
+EnzoEFltArrayMap::EnzoEFltArrayMap(std::string name,
+                                   const std::vector<std::string> &keys,
+                                   const std::vector<EFlt3DArray> &arrays)
+  : EnzoEFltArrayMap(name)
+{
+  ASSERT("EnzoEFltArrayMap", "keys and arrays must have the same length",
+         keys.size() == arrays.size());
+  for (std::size_t i = 0; i < keys.size(); i++){
+    insert_(keys[i], arrays[i]);
+  }
+  frozen_ = true;
+}
+
+//----------------------------------------------------------------------
+
+/// compares the key of an entry of a key-index table against a key
+static bool key_index_less_(const std::pair<std::string, std::size_t> &entry,
+                            const std::string &key)
+{ return entry.first < key; }
+
+//----------------------------------------------------------------------
+
+std::vector<std::pair<std::string, std::size_t>>::const_iterator
+EnzoEFltArrayMap::find_(const std::string& key) const noexcept
+{
+  auto result = std::lower_bound(key_indices_.cbegin(), key_indices_.cend(),
+                                 key, key_index_less_);
+  if ((result != key_indices_.cend()) && (result->first == key)){
+    return result;
+  }
+  return key_indices_.cend();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoEFltArrayMap::insert_(const std::string& key,
+                               const EFlt3DArray& arr) noexcept
+{
+  auto pos = std::lower_bound(key_indices_.begin(), key_indices_.end(),
+                              key, key_index_less_);
+  ASSERT1("EnzoEFltArrayMap::insert_", "the key, \"%s\", is already present",
+          key.c_str(), (pos == key_indices_.end()) || (pos->first != key));
+  key_indices_.insert(pos, key_index_pair_(key, keys_.size()));
+  keys_.push_back(key);
+  arrays_.push_back(arr);
+}
+
+//----------------------------------------------------------------------
+
+EFlt3DArray& EnzoEFltArrayMap::operator[] (const std::string& key)
+{
+  auto result = find_(key);
+  if (result != key_indices_.cend()){
+    ASSERT1("EnzoEFltArrayMap::operator[]",
+            ("Can't use operator[] to access the \"%s\" key of a frozen "
+             "map. Use at or get instead."),
+            key.c_str(), !frozen_);
+    return arrays_[result->second];
+  }
+
+  if (frozen_){
+    ERROR1("EnzoEFltArrayMap::operator[]",
+           "Can't insert the key, \"%s\", into a frozen map", key.c_str());
+  }
+  // default-construct the new array in place (copying an uninitialized
+  // EFlt3DArray isn't allowed)
+  auto pos = std::lower_bound(key_indices_.begin(), key_indices_.end(),
+                              key, key_index_less_);
+  key_indices_.insert(pos, key_index_pair_(key, keys_.size()));
+  keys_.push_back(key);
+  arrays_.emplace_back();
+  return arrays_.back();
+}
+
+//----------------------------------------------------------------------
+
 const EFlt3DArray& EnzoEFltArrayMap::at(const std::string& key) const noexcept
 {
-  auto result = map_.find(key);
-  if (result == map_.cend()){
-    ERROR1("EnzoEFltArrayMap::at", "map doesn't contain the key: \"%s\"",
+  return arrays_[index(key)];
+}
+
+//----------------------------------------------------------------------
+
+std::size_t EnzoEFltArrayMap::index(const std::string& key) const noexcept
+{
+  auto result = find_(key);
+  if (result == key_indices_.cend()){
+    ERROR1("EnzoEFltArrayMap::index", "map doesn't contain the key: \"%s\"",
            key.c_str());
   }
   return result->second;
@@ -36,10 +136,18 @@ EFlt3DArray exclude_stale_cells_(const EFlt3DArray &arr, int stale_depth)
 
 EFlt3DArray EnzoEFltArrayMap::get(const std::string& key,
                                   int stale_depth) const noexcept
+{
+  return get(index(key), stale_depth);
+}
+
+//----------------------------------------------------------------------
+
+EFlt3DArray EnzoEFltArrayMap::get(std::size_t index,
+                                  int stale_depth) const noexcept
 {
   ASSERT("EnzoEFltArrayMap::get", "stale_depth must be >= 0",
          stale_depth >= 0);
-  const EFlt3DArray& arr = this->at(key);
+  const EFlt3DArray& arr = this->at(index);
   if (stale_depth > 0){
     return exclude_stale_cells_(arr,stale_depth);
   } else {
@@ -49,6 +157,29 @@ EFlt3DArray EnzoEFltArrayMap::get(const std::string& key,
 
 //----------------------------------------------------------------------
 
+EnzoEFltArrayMap EnzoEFltArrayMap::subarray_map(const CSlice &slc_z,
+                                                const CSlice &slc_y,
+                                                const CSlice &slc_x)
+  const noexcept
+{
+  // the keys (and their indices) are the same as in this map
+  EnzoEFltArrayMap out(name_);
+  out.keys_ = keys_;
+  out.key_indices_ = key_indices_;
+  out.arrays_.reserve(size());
+  for (std::size_t i = 0; i < size(); i++){
+    out.arrays_.push_back(arrays_[i].subarray(slc_z, slc_y, slc_x));
+  }
+  if (has_backing_array()){
+    out.backing_array_ = backing_array_.subarray(CSlice(nullptr, nullptr),
+                                                 slc_z, slc_y, slc_x);
+  }
+  out.frozen_ = frozen_;
+  return out;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoEFltArrayMap::print_summary() const noexcept
 {
   std::size_t my_size = size();
@@ -71,17 +202,18 @@ void EnzoEFltArrayMap::print_summary() const noexcept
   int i = 0;
   CkPrintf("{");
 
-  for ( const auto &pair : map_ ) {
+  for (std::size_t index = 0; index < my_size; index++){
+    const EFlt3DArray &arr = arrays_[index];
     if (i != 0){
       CkPrintf(",\n ");
     }
     CkPrintf("\"%s\" : EFlt3DArray(%p, %d, %d, %d), owners: %ld",
-             pair.first.c_str(),
-             (void*)pair.second.shared_data_.get(),
-             (int)pair.second.shape(0),
-             (int)pair.second.shape(1),
-             (int)pair.second.shape(2),
-             pair.second.shared_data_.use_count());
+             keys_[index].c_str(),
+             (void*)arr.shared_data_.get(),
+             (int)arr.shape(0),
+             (int)arr.shape(1),
+             (int)arr.shape(2),
+             arr.shared_data_.use_count());
     i++;
   }
   CkPrintf("}\n");
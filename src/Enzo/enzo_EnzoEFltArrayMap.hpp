@@ -10,27 +10,26 @@
 /// implementation from using Groupings to using Maps. It may not be optimal to
 /// define this as it's own class
 ///
-/// I'm starting to think that a more optimal approach may be to perform all
-/// insertions in the constructor and to thereafter freeze the contained
-/// arrays (the entries of the arrays could still be modified).
-///   - The class could then provide the interface of a const std::map.
-///   - It could also potentially enforce that all contained arrays have a
-///     fixed shape
+/// There are 2 flavors of instances:
+///   1. Ordinary instances have keys that are inserted one at a time (with
+///      `operator[]`). These are primarily used to wrap existing Cello fields.
+///   2. Frozen instances have all of their keys specified at construction.
+///      Afterwards, keys can't be inserted and the contained arrays can't be
+///      replaced (the entries of the arrays can still be modified).
 ///
-/// This choice, also facillitates further optimizations based on the capacity
-/// to guarantee the ordering of arrays held within an instance. If the
-/// ordering is based off the requirements of the Riemann Solver and the class
-/// offers a method to return a (const?) vector of arrays with that ordering,
-/// optimizations could be made to the Riemann Solver (as well as
-/// EnzoReconstructor and EnzoIntegrableUpdater). This could be most
-/// efficiently achieved by internally storing the contained array within a
-/// vector and also storing some kind of mapping relating the keys to indices
-/// the vector.
+/// In both cases, the contained arrays are stored in the order that their
+/// keys were inserted. Each key is associated with the index of its array
+/// and the arrays can be directly accessed by index. Indices should be
+/// resolved once (e.g. while setting up a calculation) rather than looking
+/// up arrays by key inside of loops.
 ///
-/// To achieve similar results, instead of storing individual EFlt3DArrays
-/// within vectors, one large instance of CelloArray<enzo_float,4> could be
-/// stored. While that may help compiler optimizations, it may be too
-/// restrictive.
+/// When a frozen instance is constructed from a list of keys and a shape, a
+/// single instance of CelloArray<enzo_float,4> is allocated to store all of
+/// the arrays. The array associated with index `i` is a view of the `i`th
+/// entry along axis 0 of that backing array. If the keys are ordered to
+/// match the lookup table used by a Riemann Solver (see
+/// `EnzoRiemann::lut_ordered_keys`), then the quantities can be walked as
+/// a single strided array.
 
 #ifndef ENZO_ENZO_EFLT_ARRAY_MAP_HPP
 #define ENZO_ENZO_EFLT_ARRAY_MAP_HPP
@@ -42,17 +41,88 @@ class EnzoEFltArrayMap {
 
 public: // interface
 
+  /// Construct an empty (unfrozen) map
   EnzoEFltArrayMap(std::string name = "")
-    : name_(name)
+    : name_(name),
+      keys_(),
+      arrays_(),
+      key_indices_(),
+      frozen_(false),
+      backing_array_()
   { }
 
-  EFlt3DArray& operator[] (const std::string& key){ return map_[key]; }
-  EFlt3DArray& operator[] (std::string&& key){ return map_[key]; }
+  /// Construct a frozen map that allocates a single contiguous array to hold
+  /// an array of the specified shape for each key
+  ///
+  /// @param name The name of the map (to help with debugging)
+  /// @param keys The keys of the map. The index of each key in this vector is
+  ///     the index of the associated array. Each key must be unique.
+  /// @param shape The shape of each of the contained arrays
+  EnzoEFltArrayMap(std::string name, const std::vector<std::string> &keys,
+                   const std::array<int,3> &shape);
+
+  /// Construct a frozen map that wraps existing arrays
+  ///
+  /// @param name The name of the map (to help with debugging)
+  /// @param keys The keys of the map. Each key must be unique.
+  /// @param arrays The arrays associated with each key (with the same
+  ///     ordering as keys)
+  EnzoEFltArrayMap(std::string name, const std::vector<std::string> &keys,
+                   const std::vector<EFlt3DArray> &arrays);
+
+  /// Copy constructor (the copy shares data with other)
+  EnzoEFltArrayMap(const EnzoEFltArrayMap &other)
+    : name_(other.name_),
+      keys_(other.keys_),
+      arrays_(other.arrays_),
+      key_indices_(other.key_indices_),
+      frozen_(other.frozen_),
+      backing_array_()
+  {
+    // copying an uninitialized CelloArray isn't allowed
+    if (other.has_backing_array()) { backing_array_ = other.backing_array_; }
+  }
+
+  EnzoEFltArrayMap(EnzoEFltArrayMap &&other) = default;
+
+  EnzoEFltArrayMap& operator=(const EnzoEFltArrayMap &other)
+  {
+    EnzoEFltArrayMap tmp(other);
+    *this = std::move(tmp);
+    return *this;
+  }
+
+  EnzoEFltArrayMap& operator=(EnzoEFltArrayMap &&other) = default;
+
+  /// Returns a reference to the array associated with key. If the key is not
+  /// already present, it is inserted.
+  ///
+  /// This is not allowed for frozen maps (use `at` or `get` instead)
+  EFlt3DArray& operator[] (const std::string& key);
 
   const EFlt3DArray& at(const std::string& key) const noexcept;
 
+  /// Returns the array associated with the specified index
+  const EFlt3DArray& at(std::size_t index) const noexcept
+  {
+    ASSERT2("EnzoEFltArrayMap::at", "index %d exceeds the size, %d",
+            (int)index, (int)arrays_.size(), index < arrays_.size());
+    return arrays_[index];
+  }
+
   bool contains(const std::string& key) const noexcept{
-    return (map_.find(key) != map_.cend());
+    return (find_(key) != key_indices_.cend());
+  }
+
+  /// Returns the index associated with key
+  std::size_t index(const std::string& key) const noexcept;
+
+  /// Returns the key associated with index
+  const std::string& key(std::size_t index) const noexcept
+  {
+    ASSERT2("EnzoEFltArrayMap::key", "index %d exceeds the size, %d",
+            (int)index, (int)keys_.size(), index < keys_.size());
+    return keys_[index];
   }
 
   /// Similar to at, but a slice of the array ommitting staled values is
@@ -60,15 +130,74 @@ public: // interface
   EFlt3DArray get(const std::string& key,
                   int stale_depth = 0) const noexcept;
 
+  /// Similar to at, but a slice of the array ommitting staled values is
+  /// returned by value
+  EFlt3DArray get(std::size_t index, int stale_depth = 0) const noexcept;
+
+  /// Returns a new map with the same keys, where each entry is a view of the
+  /// specified region of the corresponding array in this map (the views
+  /// share data with the arrays held by this map).
+  ///
+  /// The slices are applied to every contained array (the arrays don't
+  /// necessarily need to share the same shape). The result is frozen if this
+  /// map is frozen.
+  EnzoEFltArrayMap subarray_map(const CSlice &slc_z, const CSlice &slc_y,
+                                const CSlice &slc_x) const noexcept;
+
   /// Provided to help debug
   void print_summary() const noexcept;
 
-  std::size_t size() const noexcept { return map_.size(); }
+  std::size_t size() const noexcept { return arrays_.size(); }
+
+  /// Indicates whether the map is frozen
+  bool is_frozen() const noexcept { return frozen_; }
+
+  /// Indicates whether all contained arrays are stored in a single backing
+  /// array
+  bool has_backing_array() const noexcept { return backing_array_.size() > 0; }
+
+  /// Returns the backing array that holds the contents of every contained
+  /// array (an error is raised if there isn't a backing array). Index `i`
+  /// along axis 0 corresponds to the array at index `i`
+  const CelloArray<enzo_float,4>& backing_array() const noexcept
+  {
+    ASSERT("EnzoEFltArrayMap::backing_array",
+           "This map doesn't have a backing array", has_backing_array());
+    return backing_array_;
+  }
+
+private: // helper methods
+
+  /// Inserts a new key-array pair at the end of the map
+  void insert_(const std::string& key, const EFlt3DArray& arr) noexcept;
+
+  /// Entry of key_indices_
+  typedef std::pair<std::string, std::size_t> key_index_pair_;
+
+  /// Returns an iterator to the entry of key_indices_ holding key (or the end
+  /// iterator if key isn't present)
+  std::vector<key_index_pair_>::const_iterator find_
+  (const std::string& key) const noexcept;
 
 private: // attributes
   // name_ is to help with debugging!
   std::string name_;
-  std::map<std::string, EFlt3DArray> map_;
+
+  /// ordered keys
+  std::vector<std::string> keys_;
+
+  /// contained arrays (with the same ordering as keys_)
+  std::vector<EFlt3DArray> arrays_;
+
+  /// table that maps each key to its index. The entries are sorted by key so
+  /// that they can be searched with a binary search.
+  std::vector<key_index_pair_> key_indices_;
+
+  /// whether keys can still be inserted
+  bool frozen_;
+
+  /// When non-empty, this holds the data of every entry in arrays_
+  CelloArray<enzo_float,4> backing_array_;
 };
 
 #endif /* ENZO_ENZO_EFLT_ARRAY_MAP_HPP */
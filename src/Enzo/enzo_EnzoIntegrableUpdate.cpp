@@ -80,9 +80,17 @@ void EnzoIntegrableUpdate::clear_dUcons_map
 (EnzoEFltArrayMap &dUcons_map, enzo_float value,
  const str_vec_t &passive_list) const noexcept
 {
-  auto init_arr = [value,&dUcons_map](const std::string& key)
+  if (dUcons_map.has_backing_array() &&
+      (dUcons_map.size() == integrable_keys_.size() + passive_list.size())){
+    // every array in the map gets initialized (the keys are unique), so the
+    // backing array holding all of them is initialized in a single pass
+    dUcons_map.backing_array().subarray() = value;
+    return;
+  }
+
+  auto init_arr = [value,&dUcons_map](std::size_t index)
   {
-    EFlt3DArray array = dUcons_map.at(key);
+    EFlt3DArray array = dUcons_map.at(index);
     for (int iz=0; iz<array.shape(0); iz++) {
       for (int iy=0; iy<array.shape(1); iy++) {
         for (int ix=0; ix<array.shape(2); ix++) {
@@ -92,23 +100,36 @@ void EnzoIntegrableUpdate::clear_dUcons_map
     }
   };
 
-  for (const std::string& key : integrable_keys_){ init_arr(key); }
-  for (const std::string& key : passive_list){ init_arr(key); }
+  for (const std::string& key : integrable_keys_){
+    init_arr(dUcons_map.index(key));
+  }
+  for (const std::string& key : passive_list){
+    init_arr(dUcons_map.index(key));
+  }
 }
 
 //----------------------------------------------------------------------
 
-void EnzoIntegrableUpdate::accumulate_flux_component
-(int dim, double dt, enzo_float cell_width, EnzoEFltArrayMap &flux_map,
- EnzoEFltArrayMap &dUcons_map, int stale_depth,
- const str_vec_t &passive_list) const noexcept
-{
-  EnzoPermutedCoordinates coord(dim);
-  enzo_float dtdx_i = dt/cell_width;
+// Kernel that is specialized on the sweep axis (see enzo_sweep_dispatch)
+struct AccumulateFluxKernel_{
 
-  auto accumulate = [dtdx_i,stale_depth,coord,
-                     &flux_map,&dUcons_map](const std::string& key)
+  template<class Sweep>
+  static void apply(enzo_float dtdx_i, int stale_depth,
+                    const EnzoEFltArrayMap &flux_map,
+                    const EnzoEFltArrayMap &dUcons_map,
+                    const str_vec_t &integrable_keys,
+                    const str_vec_t &passive_list) noexcept
+  {
+    const EnzoPermutedCoordinates coord = Sweep::coord();
+
+    // The index of key in each map is resolved once, before looping over
+    // the cells
+    auto accumulate = [dtdx_i, stale_depth, coord,
+                       &flux_map, &dUcons_map](const std::string& key)
     {
+      const std::size_t i_dU = dUcons_map.index(key);
+      const std::size_t i_flux = flux_map.index(key);
+
       CSlice full_ax(nullptr, nullptr);
       // Since we don't have fluxes on the exterior faces along axis i, we can
       // not update dU in the first & last cell along the axis. Thus we cast
@@ -117,28 +138,50 @@ void EnzoIntegrableUpdate::accumulate_flux_component
 
       // define : dU_center(k,j,i) -> dU(k,j,i+1)
       EFlt3DArray dU, dU_center;
-      dU = dUcons_map.get(key,stale_depth);
+      dU = dUcons_map.get(i_dU, stale_depth);
       dU_center = coord.get_subarray(dU, full_ax, full_ax, CSlice(1, -1));
 
+      const int nz = dU_center.shape(0);
+      const int ny = dU_center.shape(1);
+      const int nx = dU_center.shape(2);
+      if ((nz == 0) || (ny == 0) || (nx == 0)) { return; }
+
       // define:  fl(k,j,i)        -> flux(k, j, i+1/2)
-      //          fr(k,j,i)        -> flux(k, j, i+3/2)
-      EFlt3DArray flux, fl, fr;
-      flux = flux_map.get(key,stale_depth);
-      fl = coord.get_subarray(flux, full_ax, full_ax, CSlice(0, -1));
-      fr = coord.get_subarray(flux, full_ax, full_ax, CSlice(1, nullptr));
-
-      for (int iz=0; iz<dU_center.shape(0); iz++) {
-	for (int iy=0; iy<dU_center.shape(1); iy++) {
-	  for (int ix=0; ix<dU_center.shape(2); ix++) {
-	    dU_center(iz,iy,ix) -= dtdx_i * (fr(iz,iy,ix) - fl(iz,iy,ix));
+      //          fr(k,j,i)        -> flux(k, j, i+3/2) = fl(k, j, i+1)
+      EFlt3DArray flux = flux_map.get(i_flux, stale_depth);
+      const intp fr_offset = Sweep::i_offset(flux);
+      EFlt3DArray fl = coord.get_subarray(flux, full_ax, full_ax,
+                                          CSlice(0, -1));
+
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+          enzo_float * const dU_row = &dU_center(iz,iy,0);
+          const enzo_float * const fl_row = &fl(iz,iy,0);
+          const enzo_float * const fr_row = fl_row + fr_offset;
+	  for (int ix=0; ix<nx; ix++) {
+	    dU_row[ix] -= dtdx_i * (fr_row[ix] - fl_row[ix]);
 	  }
 	}
       }
-
     };
 
-  for (const std::string& key : integrable_keys_){ accumulate(key); }
-  for (const std::string& key : passive_list){ accumulate(key); }
+    for (const std::string& key : integrable_keys){ accumulate(key); }
+    for (const std::string& key : passive_list){ accumulate(key); }
+  }
+};
+
+//----------------------------------------------------------------------
+
+void EnzoIntegrableUpdate::accumulate_flux_component
+(int dim, double dt, enzo_float cell_width, EnzoEFltArrayMap &flux_map,
+ EnzoEFltArrayMap &dUcons_map, int stale_depth,
+ const str_vec_t &passive_list) const noexcept
+{
+  enzo_float dtdx_i = dt/cell_width;
+  // the specialized kernel is selected once for all of the fields
+  enzo_sweep_dispatch<AccumulateFluxKernel_>(dim, dtdx_i, stale_depth,
+                                             flux_map, dUcons_map,
+                                             integrable_keys_, passive_list);
 }
 
 //----------------------------------------------------------------------
@@ -149,7 +192,7 @@ EFlt3DArray* EnzoIntegrableUpdate::load_integrable_quantities_
   std::size_t nfields = integrable_keys_.size();
   EFlt3DArray* arr = new EFlt3DArray[nfields];
   for (std::size_t i = 0; i<nfields; i++){
-    arr[i] = map.get(integrable_keys_[i], stale_depth);
+    arr[i] = map.get(map.index(integrable_keys_[i]), stale_depth);
   }
   return arr;
 }
@@ -228,9 +271,11 @@ void EnzoIntegrableUpdate::update_passive_scalars_
 
   for (const std::string &key : passive_list){
     EFlt3DArray cur_specific, out_conserved, dU;
-    cur_specific = initial_integrable_map.get(key, stale_depth);
-    out_conserved = out_conserved_passive_scalar.get(key, stale_depth);
-    dU = dUcons_map.get(key, stale_depth);
+    cur_specific = initial_integrable_map.get
+      (initial_integrable_map.index(key), stale_depth);
+    out_conserved = out_conserved_passive_scalar.get
+      (out_conserved_passive_scalar.index(key), stale_depth);
+    dU = dUcons_map.get(dUcons_map.index(key), stale_depth);
 
     for (int iz=1; iz<mz-1; iz++) {
       for (int iy=1; iy<my-1; iy++) {
@@ -0,0 +1,107 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMatrixDiffuse.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Implementation of the implicit diffusion operator EnzoMatrixDiffuse
+
+#include "enzo.hpp"
+
+//======================================================================
+
+void EnzoMatrixDiffuse::matvec (int i_y, int i_x, Block * block,
+				int g0) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(i_x,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+  enzo_float * Y = (enzo_float * ) field.values(i_y);
+
+  matvec_(Y,X,g0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixDiffuse::matvec
+(precision_type precision,
+ void * y, void * x, int g0) throw()
+{
+  matvec_((enzo_float *)(y),(const enzo_float *)(x),g0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixDiffuse::diagonal (int i_x, Block * block, int g0) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions (i_x,&mx_,&my_,&mz_);
+  block->cell_width    (&hx_,&hy_,&hz_);
+
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+
+  diagonal_(X,g0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixDiffuse::matvec_
+(enzo_float * Y, const enzo_float * X, int g0) const throw()
+{
+  const int rank = cello::rank();
+
+  const int idx = 1;
+  const int idy = mx_;
+  const int idz = mx_*my_;
+
+  g0 = std::max(1,g0);
+
+  const double dx = (rank >= 1) ? a_ / (hx_*hx_) : 0.0;
+  const double dy = (rank >= 2) ? a_ / (hy_*hy_) : 0.0;
+  const double dz = (rank >= 3) ? a_ / (hz_*hz_) : 0.0;
+
+  const int iy0 = (rank >= 2) ? g0 : 0;
+  const int iz0 = (rank >= 3) ? g0 : 0;
+
+  // Y = X - a*(Lx + Ly + Lz) X; unused axes have zero weight
+
+  for     (int iz=iz0; iz<mz_-iz0; iz++) {
+    for   (int iy=iy0; iy<my_-iy0; iy++) {
+      for (int ix=g0;  ix<mx_-g0;  ix++) {
+	const int i = ix + mx_*(iy + my_*iz);
+	double y = X[i] - ( X[i-idx] - 2.0*X[i] + X[i+idx] ) * dx;
+	if (rank >= 2) y -= ( X[i-idy] - 2.0*X[i] + X[i+idy] ) * dy;
+	if (rank >= 3) y -= ( X[i-idz] - 2.0*X[i] + X[i+idz] ) * dz;
+	Y[i] = y;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixDiffuse::diagonal_ (enzo_float * X, int g0) const throw()
+{
+  const int rank = cello::rank();
+
+  g0 = std::max(1,g0);
+
+  const double dx = (rank >= 1) ? a_ / (hx_*hx_) : 0.0;
+  const double dy = (rank >= 2) ? a_ / (hy_*hy_) : 0.0;
+  const double dz = (rank >= 3) ? a_ / (hz_*hz_) : 0.0;
+
+  const double d = 1.0 + 2.0*(dx + dy + dz);
+
+  const int iy0 = (rank >= 2) ? g0 : 0;
+  const int iz0 = (rank >= 3) ? g0 : 0;
+
+  for     (int iz=iz0; iz<mz_-iz0; iz++) {
+    for   (int iy=iy0; iy<my_-iy0; iy++) {
+      for (int ix=g0;  ix<mx_-g0;  ix++) {
+	X[ix + mx_*(iy + my_*iz)] = d;
+      }
+    }
+  }
+}
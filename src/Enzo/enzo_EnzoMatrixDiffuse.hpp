@@ -0,0 +1,110 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMatrixDiffuse.hpp 
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Compute] Declaration of the EnzoMatrixDiffuse class
+
+#ifndef COMPUTE_MATRIX_DIFFUSE_HPP
+#define COMPUTE_MATRIX_DIFFUSE_HPP
+
+class EnzoMatrixDiffuse : public Matrix 
+{
+  /// @class    EnzoMatrixDiffuse
+  /// @ingroup  Compute
+  /// @brief    [\ref Compute] Implicit diffusion operator A = I - a L,
+  /// where L is the second-order discrete Laplacian and a is the
+  /// diffusivity times the (weighted) timestep
+
+public: // interface
+
+  /// Create a new EnzoMatrixDiffuse
+  EnzoMatrixDiffuse (double a) throw()
+    : Matrix(),
+      mx_(0),
+      my_(0),
+      mz_(0),
+      hx_(0.0),
+      hy_(0.0),
+      hz_(0.0),
+      a_(a)
+  {}
+
+  /// Destructor
+  virtual ~EnzoMatrixDiffuse() throw()
+  {}
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMatrixDiffuse);
+
+  /// CHARM++ migration constructor
+  EnzoMatrixDiffuse(CkMigrateMessage *m)
+    : Matrix(m),
+      mx_(0),
+      my_(0),
+      mz_(0),
+      hx_(0.0),
+      hy_(0.0),
+      hz_(0.0),
+      a_(0.0)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  { TRACEPUP;
+    PUP::able::pup(p);
+    p | mx_;
+    p | my_;
+    p | mz_;
+    p | hx_;
+    p | hy_;
+    p | hz_;
+    p | a_;
+  }
+
+  /// Set cell widths.  Required for lower-level methods that don't have
+  /// access to the Block
+  void set_cell_width (double hx, double hy, double hz)
+  {
+    hx_ = hx;
+    hy_ = hy;
+    hz_ = hz;
+  }
+
+public: // virtual functions
+
+  /// Apply the matrix to a vector Y <-- A*X
+  virtual void matvec (int id_y, int id_x, Block * block, int g0=1) throw();
+
+  /// Low-level matvec, useful for non-Block arrays.  Must call
+  /// set_cell_width first
+  virtual void matvec (precision_type precision,
+		       void * y, void * x, int g0=1) throw();
+
+  /// Extract the diagonal into the given field
+  virtual void diagonal (int id_x, Block * block, int g0=1) throw();
+
+  /// The identity shift makes the matrix nonsingular
+  virtual bool is_singular() const throw()
+  { return false; }
+
+  /// How many ghost zones required for matvec
+  virtual int ghost_depth() const throw()
+  { return 1; }
+
+protected: // functions
+
+  void matvec_ (enzo_float * Y, const enzo_float * X, int g0) const throw();
+
+  void diagonal_ (enzo_float * X, int g0) const throw();
+
+protected: // attributes
+
+  int mx_, my_, mz_;
+  double hx_, hy_, hz_;
+
+  /// Coefficient of the Laplacian
+  double a_;
+
+};
+
+#endif /* COMPUTE_MATRIX_DIFFUSE_HPP */
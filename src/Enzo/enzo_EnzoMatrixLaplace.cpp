@@ -12,12 +12,157 @@
 
 //======================================================================
 
+namespace {
+
+  /// Per-PE plane and ring buffers for jacobi_kernel_(), reused by
+  /// every sweep of every block computed on this PE
+  cello::ThreadScratch<enzo_float> scratch_jacobi;
+
+  /// Residual R <-- B - A*X on cells at least g0 from the edge, for
+  /// the Laplacian with stencil half-width NC in RANK dimensions.
+  /// Returns the sum of R*R over cells at least gi3 from the edge
+  template <int NC, int RANK>
+  double residual_kernel_
+  (enzo_float * R, const enzo_float * B, const enzo_float * X,
+   const double c[4], const double d3[3],
+   const int m3[3], int g0, const int gi3[3])
+  {
+    const int s3[3] = {1, m3[0], m3[0]*m3[1]};
+
+    int i0[3], i1[3];
+    for (int axis=0; axis<3; axis++) {
+      i0[axis] = (axis < RANK) ? g0 : 0;
+      i1[axis] = m3[axis] - i0[axis];
+    }
+
+    double cd[NC+1][RANK];
+    for (int j=1; j<=NC; j++) {
+      for (int a=0; a<RANK; a++) cd[j][a] = c[j]*d3[a];
+    }
+    const double diag = c[0]*(d3[0] + d3[1] + d3[2]);
+
+    double sum = 0.0;
+    for (int iz=i0[2]; iz<i1[2]; iz++) {
+      for (int iy=i0[1]; iy<i1[1]; iy++) {
+	const bool in_yz =
+	  (gi3[1] <= iy && iy < m3[1]-gi3[1]) &&
+	  (gi3[2] <= iz && iz < m3[2]-gi3[2]);
+	for (int ix=i0[0]; ix<i1[0]; ix++) {
+	  const int i = ix + m3[0]*(iy + m3[1]*iz);
+	  double y = diag*X[i];
+	  for (int j=1; j<=NC; j++) {
+	    for (int a=0; a<RANK; a++) {
+	      y += cd[j][a]*(X[i-j*s3[a]] + X[i+j*s3[a]]);
+	    }
+	  }
+	  const enzo_float r = B[i] - y;
+	  R[i] = r;
+	  if (in_yz && gi3[0] <= ix && ix < m3[0]-gi3[0]) sum += r*r;
+	}
+      }
+    }
+    return sum;
+  }
+
+  /// Weighted Jacobi sweep X <-- X + w*D^-1*(B - A*X) on cells at
+  /// least g0 from the edge, for the Laplacian with stencil half-width
+  /// NC in RANK dimensions.  X is updated in place while streaming
+  /// along the outermost axis: new values of a plane are computed into
+  /// a plane buffer, and the old values of the last NC planes are kept
+  /// in a ring buffer for the stencils of the following planes.
+  /// Returns the sum of R*R over cells at least gi3 from the edge
+  template <int NC, int RANK>
+  double jacobi_kernel_
+  (enzo_float * X, const enzo_float * B, double w,
+   const double c[4], const double d3[3],
+   const int m3[3], int g0, const int gi3[3])
+  {
+    const int s3[3] = {1, m3[0], m3[0]*m3[1]};
+    const int ao = RANK - 1;
+    const int np = s3[ao];
+
+    int i0[3], i1[3];
+    for (int axis=0; axis<3; axis++) {
+      i0[axis] = (axis < RANK) ? g0 : 0;
+      i1[axis] = m3[axis] - i0[axis];
+    }
+
+    double cd[NC+1][RANK];
+    for (int j=1; j<=NC; j++) {
+      for (int a=0; a<RANK; a++) cd[j][a] = c[j]*d3[a];
+    }
+    const double diag = c[0]*(d3[0] + d3[1] + d3[2]);
+    const double wd = w / diag;
+
+    enzo_float * plane = scratch_jacobi.get((NC+1)*np);
+    enzo_float * ring  = plane + np;
+
+    double sum = 0.0;
+    for (int io=i0[ao]; io<i1[ao]; io++) {
+
+      // Old values of plane io-j, indexed by position in the plane
+
+      const enzo_float * xm[NC+1];
+      for (int j=1; j<=NC; j++) {
+	xm[j] = (io-j >= i0[ao]) ?
+	  ring + ((io-j) % NC)*np : X + (io-j)*np;
+      }
+
+      int lo3[3] = {i0[0], i0[1], i0[2]};
+      int hi3[3] = {i1[0], i1[1], i1[2]};
+      lo3[ao] = io;
+      hi3[ao] = io + 1;
+
+      for (int iz=lo3[2]; iz<hi3[2]; iz++) {
+	for (int iy=lo3[1]; iy<hi3[1]; iy++) {
+	  const bool in_yz =
+	    (gi3[1] <= iy && iy < m3[1]-gi3[1]) &&
+	    (gi3[2] <= iz && iz < m3[2]-gi3[2]);
+	  for (int ix=lo3[0]; ix<hi3[0]; ix++) {
+	    const int i = ix + m3[0]*(iy + m3[1]*iz);
+	    const int p = i - io*np;
+	    double y = diag*X[i];
+	    for (int j=1; j<=NC; j++) {
+	      for (int a=0; a<RANK; a++) {
+		const enzo_float x_lower = (a == ao) ? xm[j][p] : X[i-j*s3[a]];
+		y += cd[j][a]*(x_lower + X[i+j*s3[a]]);
+	      }
+	    }
+	    const double r = B[i] - y;
+	    plane[p] = X[i] + wd*r;
+	    if (in_yz && gi3[0] <= ix && ix < m3[0]-gi3[0]) sum += r*r;
+	  }
+	}
+      }
+
+      // Save the old plane, then copy in the new values
+
+      enzo_float * save = ring + (io % NC)*np;
+      for (int iz=lo3[2]; iz<hi3[2]; iz++) {
+	for (int iy=lo3[1]; iy<hi3[1]; iy++) {
+	  for (int ix=lo3[0]; ix<hi3[0]; ix++) {
+	    const int i = ix + m3[0]*(iy + m3[1]*iz);
+	    const int p = i - io*np;
+	    save[p] = X[i];
+	    X[i] = plane[p];
+	  }
+	}
+      }
+    }
+    return sum;
+  }
+
+}
+
+//======================================================================
+
 void EnzoMatrixLaplace::matvec (int i_y, int i_x, Block * block,
 				int g0) throw()
 {
   Field field = block->data()->field();
 
   field.dimensions(0,&mx_,&my_,&mz_);
+  rank_ = cello::rank();
   block->cell_width (&hx_,&hy_,&hz_);
   
   enzo_float * X = (enzo_float * ) field.values(i_x);
@@ -42,6 +187,7 @@ void EnzoMatrixLaplace::diagonal (int i_x, Block * block, int g0) throw()
   Field field = block->data()->field();
 
   field.dimensions (i_x,&mx_,&my_,&mz_);
+  rank_ = cello::rank();
   block->cell_width    (&hx_,&hy_,&hz_);
 
   enzo_float * X = (enzo_float * ) field.values(i_x);
@@ -51,6 +197,134 @@ void EnzoMatrixLaplace::diagonal (int i_x, Block * block, int g0) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMatrixLaplace::residual (int i_r, int i_b, int i_x, Block * block,
+				  int g0, double * rr) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  rank_ = cello::rank();
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  int gi3[3];
+  field.ghost_depth(0,&gi3[0],&gi3[1],&gi3[2]);
+
+  enzo_float * R = (enzo_float * ) field.values(i_r);
+  enzo_float * B = (enzo_float * ) field.values(i_b);
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+
+  double c[4], d3[3];
+  const int nc = stencil_(c,d3);
+  const int m3[3] = {mx_, my_, mz_};
+  g0 = std::max(nc,g0);
+
+  double sum = 0.0;
+  switch (3*(nc-1) + rank_-1) {
+  case 0: sum = residual_kernel_<1,1>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 1: sum = residual_kernel_<1,2>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 2: sum = residual_kernel_<1,3>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 3: sum = residual_kernel_<2,1>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 4: sum = residual_kernel_<2,2>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 5: sum = residual_kernel_<2,3>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 6: sum = residual_kernel_<3,1>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 7: sum = residual_kernel_<3,2>(R,B,X,c,d3,m3,g0,gi3); break;
+  case 8: sum = residual_kernel_<3,3>(R,B,X,c,d3,m3,g0,gi3); break;
+  }
+
+  if (rr) (*rr) += sum;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixLaplace::jacobi (int i_x, int i_b, int i_r, int i_d, double w,
+				Block * block, int g0, double * rr) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  rank_ = cello::rank();
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  int gi3[3];
+  field.ghost_depth(0,&gi3[0],&gi3[1],&gi3[2]);
+
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+  enzo_float * B = (enzo_float * ) field.values(i_b);
+
+  const double sum = jacobi (X,B,w,g0,gi3);
+
+  if (rr) (*rr) += sum;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMatrixLaplace::jacobi
+(enzo_float * X, const enzo_float * B, double w,
+ int g0, const int gi3[3]) throw()
+{
+  double c[4], d3[3];
+  const int nc = stencil_(c,d3);
+  const int m3[3] = {mx_, my_, mz_};
+  g0 = std::max(nc,g0);
+
+  double sum = 0.0;
+  switch (3*(nc-1) + rank_-1) {
+  case 0: sum = jacobi_kernel_<1,1>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 1: sum = jacobi_kernel_<1,2>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 2: sum = jacobi_kernel_<1,3>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 3: sum = jacobi_kernel_<2,1>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 4: sum = jacobi_kernel_<2,2>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 5: sum = jacobi_kernel_<2,3>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 6: sum = jacobi_kernel_<3,1>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 7: sum = jacobi_kernel_<3,2>(X,B,w,c,d3,m3,g0,gi3); break;
+  case 8: sum = jacobi_kernel_<3,3>(X,B,w,c,d3,m3,g0,gi3); break;
+  }
+  return sum;
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMatrixLaplace::stencil_ (double c[4], double d3[3]) const throw()
+{
+  const int rank = rank_;
+
+  int nc = 0;
+  double scale = 0.0;
+  c[0] = c[1] = c[2] = c[3] = 0.0;
+
+  if (order_ == 2) {
+    nc = 1;
+    scale = 1.0;
+    c[0] = -2.0;
+    c[1] = 1.0;
+  } else if (order_ == 4) {
+    nc = 2;
+    scale = 12.0;
+    c[0] = -30.0;
+    c[1] = 16.0;
+    c[2] = -1.0;
+  } else if (order_ == 6) {
+    nc = 3;
+    scale = 1080.0;
+    c[0] = -2720.0;
+    c[1] = 1455.0;
+    c[2] = -96.0;
+    c[3] = 1.0;
+  } else {
+    ERROR1 ("EnzoMatrixLaplace::stencil_()",
+	    "Order %d operator is not supported",
+	    order_);
+  }
+
+  d3[0] = (rank >= 1) ? 1.0/(scale*hx_*hx_) : 0.0;
+  d3[1] = (rank >= 2) ? 1.0/(scale*hy_*hy_) : 0.0;
+  d3[2] = (rank >= 3) ? 1.0/(scale*hz_*hz_) : 0.0;
+
+  return nc;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMatrixLaplace::matvec_
 (enzo_float * Y, enzo_float * X, int g0) const throw()
 {
@@ -58,7 +332,7 @@ void EnzoMatrixLaplace::matvec_
   const int idy = mx_;
   const int idz = mx_*my_;
 
-  const int rank = cello::rank();
+  const int rank = rank_;
 
   if (order_ == 2) {
 
@@ -222,7 +496,7 @@ void EnzoMatrixLaplace::matvec_
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idy] +X[i+idy]) +
 		    c2*(X[i-idy2]+X[i+idy2]) +
-		    c2*(X[i-idy3]+X[i+idy3])) * dy
+		    c3*(X[i-idy3]+X[i+idy3])) * dy
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idz] +X[i+idz]) +
 		    c2*(X[i-idz2]+X[i+idz2]) +
@@ -242,7 +516,7 @@ void EnzoMatrixLaplace::matvec_
 
 void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
 {
-  const int rank = cello::rank();
+  const int rank = rank_;
 
   if (order_ == 2) {
     
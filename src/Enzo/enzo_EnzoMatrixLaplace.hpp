@@ -27,6 +27,7 @@ public: // interface
       hx_(0.0),
       hy_(0.0),
       hz_(0.0),
+      rank_(0),
       order_(order)
   {}
 
@@ -49,6 +50,7 @@ public: // interface
       hx_(0.0),
       hy_(0.0),
       hz_(0.0),
+      rank_(0),
       order_(0)
   { }
 
@@ -65,6 +67,7 @@ public: // interface
     p | hx_;
     p | hy_;
     p | hz_;
+    p | rank_;
     p | order_;
   }
 
@@ -76,7 +79,18 @@ public: // interface
     hy_ = hy;
     hz_ = hz;
   }
-  
+
+  /// Set array dimensions, and the rank as the number of axes with
+  /// more than one cell.  Required for lower-level methods that don't
+  /// have access to the Block
+  void set_dimensions (int mx, int my, int mz)
+  {
+    mx_ = mx;
+    my_ = my;
+    mz_ = mz;
+    rank_ = (mz > 1) ? 3 : ((my > 1) ? 2 : 1);
+  }
+
 public: // virtual functions
 
   /// Apply the matrix to a vector Y <-- A*X
@@ -91,6 +105,23 @@ public: // virtual functions
   /// Extract the diagonal into the given field
   virtual void diagonal (int id_x, Block * block, int g0=1) throw();
 
+  /// Compute residual R <-- B - A*X, and optionally its norm, in a
+  /// single pass
+  virtual void residual (int ir, int ib, int ix, Block * block, int g0=1,
+			 double * rr = NULL) throw();
+
+  /// Perform one weighted Jacobi sweep in a single pass over X and B.
+  /// The temporary fields ir and id are not used
+  virtual void jacobi (int ix, int ib, int ir, int id, double w,
+		       Block * block, int g0=1, double * rr = NULL) throw();
+
+  /// Low-level weighted Jacobi sweep X <-- X + w*D^-1*(B - A*X) on
+  /// cells at least g0 from the edge, useful for non-Block arrays.
+  /// Must call set_cell_width and set_dimensions first manually!
+  /// Returns the sum of R*R over cells at least gi3 from the edge
+  double jacobi (enzo_float * x, const enzo_float * b, double w,
+		 int g0, const int gi3[3]) throw();
+
   /// Whether the matrix is singular or not
   virtual bool is_singular() const throw()
   { return true; }
@@ -99,17 +130,27 @@ public: // virtual functions
   virtual int ghost_depth() const throw()
   { return (order_ == 2) ? 1 : ( (order_ == 4) ? 2 : 3); }
 
+  /// Order of accuracy of the discretization (2, 4, or 6)
+  int order() const throw()
+  { return order_; }
+
 protected: // functions
 
   void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
 
   void diagonal_ (enzo_float * X, int g0) const throw();
 
+  /// Return the half-width of the stencil, and set its coefficients c
+  /// and the scaling d3 along each axis (zero for unused axes)
+  int stencil_ (double c[4], double d3[3]) const throw();
+
 protected: // attributes
 
   int mx_, my_, mz_;
   int nx_, ny_, nz_;
   double hx_, hy_, hz_;
+  /// Rank of the arrays, from cello::rank() or set_dimensions()
+  int rank_;
   /// Order of the operator, 2 or 4
   int order_;
 
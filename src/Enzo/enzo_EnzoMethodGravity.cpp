@@ -20,13 +20,31 @@ EnzoMethodGravity::EnzoMethodGravity
 (int index_solver,
  double grav_const,
  int order,
- bool accumulate)
+ bool accumulate,
+ std::string initial_guess)
   : Method(),
     index_solver_(index_solver),
     grav_const_(grav_const),
     order_(order),
-    ir_exit_(-1)
+    ir_exit_(-1),
+    num_history_(0),
+    ir_guess_(-1),
+    is_num_saved_(-1),
+    is_time_1_(-1),
+    is_time_2_(-1)
 {
+  if (initial_guess == "zero") {
+    num_history_ = 0;
+  } else if (initial_guess == "previous") {
+    num_history_ = 1;
+  } else if (initial_guess == "extrapolate") {
+    num_history_ = 2;
+  } else {
+    ERROR1 ("EnzoMethodGravity::EnzoMethodGravity()",
+            "Unknown initial_guess \"%s\": must be \"zero\", "
+            "\"previous\", or \"extrapolate\"",
+            initial_guess.c_str());
+  }
 
 
   // Change this if fields used in this routine change
@@ -56,6 +74,23 @@ EnzoMethodGravity::EnzoMethodGravity
                                   {"density_particle","density_particle_accumulate"});
   }
 
+  // Previous potentials are permanent fields so that they are
+  // interpolated during refinement and coarsening
+
+  if (num_history_ >= 1) this->required_fields_.push_back("potential_history_1");
+  if (num_history_ >= 2) this->required_fields_.push_back("potential_history_2");
+
+  // The number and times of the saved potentials are Block scalars,
+  // since Blocks created by refinement start with no saved times
+
+  if (num_history_ > 0) {
+    is_num_saved_ = cello::scalar_descr_int()->new_value
+      ("method_gravity_num_saved");
+    ScalarDescr * scalar_descr_quad = cello::scalar_descr_long_double();
+    is_time_1_ = scalar_descr_quad->new_value("method_gravity_time_1");
+    is_time_2_ = scalar_descr_quad->new_value("method_gravity_time_2");
+  }
+
   // now define fields if they do not exist
   this->define_fields();
 
@@ -85,6 +120,19 @@ EnzoMethodGravity::EnzoMethodGravity
   refresh_exit->add_field("potential");
 
   refresh_exit->set_callback(CkIndex_EnzoBlock::p_method_gravity_end());
+
+  // Refresh initial guess ghost zones before the solve, since they
+  // may be inconsistent with neighbors after adapt
+
+  if (num_history_ > 0) {
+    ir_guess_ = add_new_refresh_();
+    cello::simulation()->new_refresh_set_name(ir_guess_,name()+":guess");
+    Refresh * refresh_guess = cello::refresh(ir_guess_);
+
+    refresh_guess->add_field("potential");
+
+    refresh_guess->set_callback(CkIndex_EnzoBlock::p_method_gravity_solve());
+  }
 }
 
 //----------------------------------------------------------------------
@@ -151,19 +199,149 @@ void EnzoMethodGravity::compute(Block * block) throw()
   for (int i=0; i<m; i++) B_copy[i] = B[i];
 #endif
 
+  EnzoBlock * enzo_block = enzo::block(block);
+
+  // Initialize the potential from previous solves if requested, and
+  // refresh it before solving
+
+  if (num_history_ > 0) {
+
+    initial_guess_(enzo_block);
+
+    cello::refresh(ir_guess_)->set_active(block->is_leaf());
+    enzo_block->new_refresh_start
+      (ir_guess_, CkIndex_EnzoBlock::p_method_gravity_solve());
+
+  } else {
+
+    solve_potential(enzo_block);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_gravity_solve()
+{
+  EnzoMethodGravity * method = static_cast<EnzoMethodGravity*> (this->method());
+  method->solve_potential(this);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGravity::solve_potential (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  const int ib = field.field_id ("B");
+  const int ix = field.field_id ("potential");
+
   Solver * solver = enzo::problem()->solver(index_solver_);
 
   // May exit before solve is done...
   solver->set_callback (CkIndex_EnzoBlock::p_method_gravity_continue());
 
-  const int ix = field.field_id ("potential");
-
   std::shared_ptr<Matrix> A (std::make_shared<EnzoMatrixLaplace>(order_));
 
   solver->set_field_x(ix);
   solver->set_field_b(ib);
 
-  solver->apply (A, block);
+  solver->apply (A, enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGravity::initial_guess_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (0,&mx,&my,&mz);
+  const int m = mx*my*mz;
+
+  enzo_float * X  = (enzo_float*) field.values ("potential");
+  enzo_float * X1 = (enzo_float*) field.values ("potential_history_1");
+  enzo_float * X2 = (num_history_ >= 2) ?
+    (enzo_float*) field.values ("potential_history_2") : nullptr;
+
+  Scalar<int> scalar_int = enzo_block->data()->scalar_int();
+  Scalar<long double> scalar_quad = enzo_block->data()->scalar_long_double();
+
+  initial_guess (X, X1, X2, m, num_history_,
+                 *scalar_int.value(is_num_saved_),
+                 enzo_block->time(),
+                 *scalar_quad.value(is_time_1_),
+                 *scalar_quad.value(is_time_2_));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGravity::initial_guess
+(enzo_float * X, const enzo_float * X1, const enzo_float * X2, int m,
+ int num_history, int num_saved,
+ long double time, long double time_1, long double time_2) throw()
+{
+  // Blocks without a saved potential keep their current potential: it
+  // is interpolated from the parent's last solve for Blocks created by
+  // refinement, and the initial value otherwise
+
+  if (num_saved == 0) return;
+
+  if (num_history >= 2 && num_saved >= 2 && time_1 > time_2) {
+
+    // X = X1 + (t - t1) * (X1 - X2) / (t1 - t2)
+
+    const enzo_float w = (time - time_1) / (time_1 - time_2);
+
+    for (int i=0; i<m; i++) X[i] = X1[i] + w*(X1[i] - X2[i]);
+
+  } else {
+
+    for (int i=0; i<m; i++) X[i] = X1[i];
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGravity::save_history_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (0,&mx,&my,&mz);
+  const int m = mx*my*mz;
+
+  enzo_float * X  = (enzo_float*) field.values ("potential");
+  enzo_float * X1 = (enzo_float*) field.values ("potential_history_1");
+  enzo_float * X2 = (num_history_ >= 2) ?
+    (enzo_float*) field.values ("potential_history_2") : nullptr;
+
+  Scalar<int> scalar_int = enzo_block->data()->scalar_int();
+  Scalar<long double> scalar_quad = enzo_block->data()->scalar_long_double();
+
+  save_history (X, X1, X2, m, num_history_,
+                *scalar_int.value(is_num_saved_),
+                enzo_block->time(),
+                *scalar_quad.value(is_time_1_),
+                *scalar_quad.value(is_time_2_));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGravity::save_history
+(const enzo_float * X, enzo_float * X1, enzo_float * X2, int m,
+ int num_history, int & num_saved,
+ long double time, long double & time_1, long double & time_2) throw()
+{
+  if (num_history >= 2) {
+    for (int i=0; i<m; i++) X2[i] = X1[i];
+  }
+  for (int i=0; i<m; i++) X1[i] = X[i];
+
+  num_saved = std::min(num_saved + 1, num_history);
+  time_2 = time_1;
+  time_1 = time;
 }
 
 //----------------------------------------------------------------------
@@ -208,6 +386,10 @@ void EnzoMethodGravity::compute_accelerations (EnzoBlock * enzo_block) throw()
   const int m = mx*my*mz;
   enzo_float * potential = (enzo_float*) field.values ("potential");
 
+  // Save the potential before scaling, since it is the solver's X
+
+  if (num_history_ > 0) save_history_(enzo_block);
+
   EnzoPhysicsCosmology * cosmology = enzo::cosmology();
 
   if (cosmology) {
@@ -27,14 +27,20 @@ public: // interface
   EnzoMethodGravity(int index_solver,
 		    double grav_const,
 		    int order,
-		    bool accumulate);
+		    bool accumulate,
+		    std::string initial_guess);
 
   EnzoMethodGravity()
     : index_solver_(-1),
       grav_const_(0.0),
       order_(4),
-      ir_exit_(-1)
-  {};
+      ir_exit_(-1),
+      num_history_(0),
+      ir_guess_(-1),
+      is_num_saved_(-1),
+      is_time_1_(-1),
+      is_time_2_(-1)
+  { };
 
   /// Destructor
   virtual ~EnzoMethodGravity() throw() {}
@@ -48,8 +54,12 @@ public: // interface
       index_solver_(-1),
       grav_const_(0.0),
       order_(4),
-      ir_exit_(-1)
-      
+      ir_exit_(-1),
+      num_history_(0),
+      ir_guess_(-1),
+      is_num_saved_(-1),
+      is_time_1_(-1),
+      is_time_2_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -68,6 +78,11 @@ public: // interface
     p | grav_const_;
     p | order_;
     p | ir_exit_;
+    p | num_history_;
+    p | ir_guess_;
+    p | is_num_saved_;
+    p | is_time_1_;
+    p | is_time_2_;
 
   }
 
@@ -85,10 +100,35 @@ public: // interface
 
   void refresh_potential (EnzoBlock * enzo_block) throw();
 
+  /// Apply the linear solver to the potential (after the initial
+  /// guess has been refreshed if needed)
+  void solve_potential (EnzoBlock * enzo_block) throw();
+
+  /// Set the potential X (of length m) to the initial guess from the
+  /// num_saved previous potentials X1 and X2, saved at time_1 and
+  /// time_2.  X is left unchanged if no potential has been saved
+  static void initial_guess
+  (enzo_float * X, const enzo_float * X1, const enzo_float * X2, int m,
+   int num_history, int num_saved,
+   long double time, long double time_1, long double time_2) throw();
+
+  /// Save the potential X solved at the given time as the most recent
+  /// previous potential X1 (moving X1 to X2 if num_history is 2)
+  static void save_history
+  (const enzo_float * X, enzo_float * X1, enzo_float * X2, int m,
+   int num_history, int & num_saved,
+   long double time, long double & time_1, long double & time_2) throw();
+
   protected: // methods
 
   void compute_ (EnzoBlock * enzo_block) throw();
 
+  /// Initialize the "potential" field from previous potentials
+  void initial_guess_ (EnzoBlock * enzo_block) throw();
+
+  /// Save the current potential to the "potential_history_*" fields
+  void save_history_ (EnzoBlock * enzo_block) throw();
+
   /// Compute maximum timestep for this method
   double timestep_ (Block * block) const throw() ;
   
@@ -106,6 +146,21 @@ protected: // attributes
 
   /// Refresh id's
   int ir_exit_;
+
+  /// Number of previous potentials kept for the initial guess: 0 for
+  /// a zero initial guess, 1 to reuse the previous potential, or 2 to
+  /// extrapolate linearly in time from the previous two
+  int num_history_;
+
+  /// Refresh id for the initial guess
+  int ir_guess_;
+
+  /// Block scalar indices for the number of potentials saved in the
+  /// "potential_history_*" fields (0, 1, or 2), and the times of the
+  /// most recent and second most recent saved potentials
+  int is_num_saved_;
+  int is_time_1_;
+  int is_time_2_;
 };
 
 
@@ -9,15 +9,32 @@
 
 #include "enzo.hpp"
 
+#include "enzo.decl.h"
+
 //----------------------------------------------------------------------
 
-EnzoMethodHeat::EnzoMethodHeat (double alpha, double courant)
+EnzoMethodHeat::EnzoMethodHeat
+(double alpha, double courant, int index_solver, double theta,
+ bool overlap)
   : Method(),
     alpha_(alpha),
-    courant_(courant)
+    courant_(courant),
+    index_solver_(index_solver),
+    theta_(theta),
+    overlap_(overlap)
 {
+  ASSERT1 ("EnzoMethodHeat::EnzoMethodHeat()",
+	   "theta = %g must be in (0,1] for the implicit solver",
+	   theta_, (! is_implicit() || (0.0 < theta_ && theta_ <= 1.0)));
 
   this->required_fields_ = std::vector<std::string> {"temperature"};
+
+  // right-hand side of the implicit system, or the updated
+  // temperature while overlapping the update with the refresh
+  if (is_implicit() || overlap_refresh()) {
+    this->required_fields_.push_back("B");
+  }
+
   this->define_fields();
 
   // Initialize default Refresh object
@@ -41,12 +58,22 @@ void EnzoMethodHeat::pup (PUP::er &p)
 
   p | alpha_;
   p | courant_;
+  p | index_solver_;
+  p | theta_;
+  p | overlap_;
 }
 
 //----------------------------------------------------------------------
 
 void EnzoMethodHeat::compute ( Block * block) throw()
 {
+  if (is_implicit()) {
+    ASSERT1 ("EnzoMethodHeat::compute()",
+	     "stages_per_refresh = %d must be 1 for the implicit solver",
+	     stages_per_refresh(), (stages_per_refresh() == 1));
+    compute_implicit_(block);
+    return;
+  }
 
   if (block->is_leaf()) {
 
@@ -62,9 +89,79 @@ void EnzoMethodHeat::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodHeat::compute_interior ( Block * block) throw()
+{
+  // Update cells whose stencil does not include ghost zones into B,
+  // leaving the temperature unchanged for the refresh in progress
+
+  if (block->is_leaf()) {
+
+    Field field = block->data()->field();
+
+    const enzo_float * T = (enzo_float *) field.values ("temperature");
+    enzo_float *       B = (enzo_float *) field.values ("B");
+
+    int a0[3],a1[3],b0[3],b1[3];
+    ranges_ (block,a0,a1,b0,b1);
+
+    compute_range_ (block,T,B,b0,b1);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::compute_boundary ( Block * block) throw()
+{
+  if (block->is_leaf()) {
+
+    Field field = block->data()->field();
+
+    enzo_float * T = (enzo_float *) field.values ("temperature");
+    enzo_float * B = (enzo_float *) field.values ("B");
+
+    int a0[3],a1[3],b0[3],b1[3];
+    const int rank = ranges_ (block,a0,a1,b0,b1);
+
+    // Update the remaining active cells, which lie in two slabs
+    // along each axis between the active and interior ranges
+
+    for (int axis=rank-1; axis>=0; axis--) {
+      for (int face=0; face<2; face++) {
+	int lo[3],hi[3];
+	for (int i=0; i<3; i++) {
+	  lo[i] = (i > axis) ? b0[i] : a0[i];
+	  hi[i] = (i > axis) ? b1[i] : a1[i];
+	}
+	lo[axis] = (face == 0) ? a0[axis] : b1[axis];
+	hi[axis] = (face == 0) ? b0[axis] : a1[axis];
+	compute_range_ (block,T,B,lo,hi);
+      }
+    }
+
+    // Copy updated cells back to the temperature
+
+    int mx,my,mz;
+    field.dimensions (field.field_id("temperature"),&mx,&my,&mz);
+
+    for (int iz=a0[2]; iz<a1[2]; iz++) {
+      for (int iy=a0[1]; iy<a1[1]; iy++) {
+	const int i = mx*(iy + my*iz);
+	std::copy (B + i + a0[0], B + i + a1[0], T + i + a0[0]);
+      }
+    }
+  }
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodHeat::timestep ( Block * block ) const throw()
 {
-  // initialize_(block);
+  // The implicit update is unconditionally stable, so the timestep
+  // is left to other methods (e.g. the hydro CFL condition)
+
+  if (is_implicit()) return std::numeric_limits<double>::max();
 
   Data * data = block->data();
   Field field = data->field();
@@ -86,20 +183,150 @@ double EnzoMethodHeat::timestep ( Block * block ) const throw()
   return 0.5*courant_*h_min*h_min/alpha_;
 }
 
-//======================================================================
+//----------------------------------------------------------------------
 
-void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
+void EnzoMethodHeat::compute_implicit_ (Block * block) throw()
 {
-  Data * data = block->data();
-  Field field   =      data->field();
+  // Solve (I - theta*a*L) T_new = (I + (1-theta)*a*L) T, a = alpha*dt
+
+  Field field = block->data()->field();
 
-  const int id_temp_ = field.field_id ("temperature");
+  const int it = field.field_id ("temperature");
+  const int ib = field.field_id ("B");
 
   int mx,my,mz;
   int gx,gy,gz;
+  field.dimensions  (it,&mx,&my,&mz);
+  field.ghost_depth (it,&gx,&gy,&gz);
+
+  enzo_float * T = (enzo_float *) field.values (it);
+  enzo_float * B = (enzo_float *) field.values (ib);
+
+  const double a = alpha_*block->dt();
+
+  std::copy (T, T + mx*my*mz, B);
+
+  if (theta_ < 1.0) {
+
+    // explicit part of Crank-Nicolson, using T's refreshed ghost zones
+
+    EnzoMatrixLaplace laplace (2);
+    laplace.matvec (ib,it,block);
+
+    const double w = (1.0 - theta_)*a;
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+	for (int ix=gx; ix<mx-gx; ix++) {
+	  const int i = ix + mx*(iy + my*iz);
+	  B[i] = T[i] + w*B[i];
+	}
+      }
+    }
+  }
 
-  field.dimensions  (id_temp_,&mx,&my,&mz);
-  field.ghost_depth (id_temp_,&gx,&gy,&gz);
+  Solver * solver = enzo::problem()->solver(index_solver_);
+
+  solver->set_callback (CkIndex_EnzoBlock::p_method_heat_end());
+
+  std::shared_ptr<Matrix> A (std::make_shared<EnzoMatrixDiffuse>(theta_*a));
+
+  solver->set_field_x(it);
+  solver->set_field_b(ib);
+
+  solver->apply (A, block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_heat_end()
+{
+  compute_done();
+}
+
+//======================================================================
+
+namespace {
+  /// Per-PE copy of the field being updated
+  cello::ThreadScratch<enzo_float> scratch_heat;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (field.field_id("temperature"),&mx,&my,&mz);
+
+  const int m = mx*my*mz;
+
+  // copy of the initial values (reused by each block computed on this PE)
+  enzo_float * U = scratch_heat.get(m);
+  cello::parallel_for_range
+    (0, m, [U,Unew] (int first, int last)
+     { std::copy (Unew + first, Unew + last, U + first); });
+
+  int a0[3],a1[3],b0[3],b1[3];
+  ranges_ (block,a0,a1,b0,b1);
+
+  compute_range_ (block,U,Unew,a0,a1);
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMethodHeat::ranges_
+(Block * block, int a0[3], int a1[3], int b0[3], int b1[3]) const throw()
+{
+  Field field = block->data()->field();
+
+  const int id_temp = field.field_id ("temperature");
+
+  int m3[3], g3[3];
+  field.dimensions  (id_temp,&m3[0],&m3[1],&m3[2]);
+  field.ghost_depth (id_temp,&g3[0],&g3[1],&g3[2]);
+
+  const int rank = ((m3[2] == 1) ? ((m3[1] == 1) ? 1 : 2) : 3);
+
+  // Ghost zones remaining valid after this update if they are only
+  // refreshed every stages_per_refresh() updates
+
+  const int stages = stages_per_refresh();
+  const int e = stages - 1 - block->method_stage();
+
+  for (int axis=0; axis<rank; axis++) {
+    ASSERT3 ("EnzoMethodHeat::ranges_()",
+	     "ghost depth %d along axis %d must be at least "
+	     "stages_per_refresh = %d",
+	     g3[axis],axis,stages,
+	     (g3[axis] >= stages));
+  }
+
+  for (int axis=0; axis<3; axis++) {
+    const int d = (axis < rank) ? 1 : 0;
+    a0[axis] = g3[axis] - d*e;
+    a1[axis] = m3[axis] - g3[axis] + d*e;
+    // interior excludes active cells adjacent to ghost zones
+    b0[axis] = g3[axis] + d;
+    b1[axis] = std::max(m3[axis] - g3[axis] - d, b0[axis]);
+  }
+
+  return rank;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::compute_range_
+(Block * block, const enzo_float * U, enzo_float * Unew,
+ const int lo[3], const int hi[3]) const throw()
+{
+  if (lo[0] >= hi[0] || lo[1] >= hi[1] || lo[2] >= hi[2]) return;
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (field.field_id("temperature"),&mx,&my,&mz);
 
   // Initialize array increments
   const int idx = 1;
@@ -115,61 +342,62 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) const throw()
   double dyi = 1.0/(hy*hy);
   double dzi = 1.0/(hz*hz);
 
-  const int m = mx*my*mz;
-
   const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
 
   const double dt = timestep(block);
 
-  enzo_float * U = new enzo_float [m];
-  for (int i=0; i<m; i++) U[i]=Unew[i];
+  // the cells are independent, so rows are divided among threads
+
+  const double alpha_dt = alpha_*dt;
 
   if (rank == 1) {
 
-    for (int ix=gx; ix<mx-gx; ix++) {
+    for (int ix=lo[0]; ix<hi[0]; ix++) {
 
       int i = ix;
 
       enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
 
-      Unew[i] = U[i] + alpha_*dt*(Uxx);
+      Unew[i] = U[i] + alpha_dt*(Uxx);
 
     }
 
   } else if (rank == 2) {
 
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gy; ix<mx-gy; ix++) {
+    cello::parallel_for
+      (lo[1], hi[1], [&] (int iy)
+       {
+         for (int ix=lo[0]; ix<hi[0]; ix++) {
 
-	int i = ix + mx*iy;
+           int i = ix + mx*iy;
 
-	enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
-	enzo_float Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
+           enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
+           enzo_float Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
 
-	Unew[i] = U[i] + alpha_*dt*(Uxx + Uyy);
+           Unew[i] = U[i] + alpha_dt*(Uxx + Uyy);
 
-      }
-    }
+         }
+       });
 
   } else if (rank == 3) {
 
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
+    cello::parallel_for
+      (lo[2], hi[2], [&] (int iz)
+       {
+         for (int iy=lo[1]; iy<hi[1]; iy++) {
+           for (int ix=lo[0]; ix<hi[0]; ix++) {
 
-	  int i = ix + mx*(iy + my*iz);
+             int i = ix + mx*(iy + my*iz);
 
-	  enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
-	  enzo_float Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
-	  enzo_float Uzz = dzi*(U[i-idz] - 2*U[i] + U[i+idz]);
+             enzo_float Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
+             enzo_float Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
+             enzo_float Uzz = dzi*(U[i-idz] - 2*U[i] + U[i+idz]);
 
-	  Unew[i] = U[i] + alpha_*dt*(Uxx + Uyy + Uzz);
+             Unew[i] = U[i] + alpha_dt*(Uxx + Uyy + Uzz);
 
-	}
-      }
-    }
+           }
+         }
+       });
   }
 
-  delete [] U;
-
 }
@@ -4,7 +4,7 @@
 /// @author   James Bordner (jobordner@ucsd.edu) 
 /// @date     Thu Apr  1 16:14:38 PDT 2010
 /// @brief    [\ref Enzo] Declaration of EnzoMethodHeat
-///           forward Euler solver for the heat equation
+///           forward Euler or implicit solver for the heat equation
 
 #ifndef ENZO_ENZO_METHOD_HEAT_HPP
 #define ENZO_ENZO_METHOD_HEAT_HPP
@@ -15,17 +15,23 @@ class EnzoMethodHeat : public Method {
   /// @ingroup  Enzo
   ///
   /// @brief [\ref Enzo] Demonstration method to solve heat equation
-  /// using forward Euler method
+  /// using forward Euler method, or if a solver is given using the
+  /// implicit theta method (theta = 1 backward Euler, theta = 0.5
+  /// Crank-Nicolson)
 
 public: // interface
 
   /// Create a new EnzoMethodHeat object
-  EnzoMethodHeat(double alpha, double courant);
+  EnzoMethodHeat(double alpha, double courant,
+		 int index_solver, double theta, bool overlap = false);
 
   EnzoMethodHeat()
     : Method(),
       alpha_(0.0),
-      courant_(0.0)
+      courant_(0.0),
+      index_solver_(-1),
+      theta_(1.0),
+      overlap_(false)
   { }
 
   /// Charm++ PUP::able declarations
@@ -35,7 +41,10 @@ public: // interface
   EnzoMethodHeat (CkMigrateMessage *m)
     : Method (m),
       alpha_(0.0),
-      courant_(0.0)
+      courant_(0.0),
+      index_solver_(-1),
+      theta_(1.0),
+      overlap_(false)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -47,13 +56,42 @@ public: // interface
   virtual std::string name () throw () 
   { return "heat"; }
 
+  /// Whether the explicit update is overlapped with the refresh
+  virtual bool overlap_refresh () const throw()
+  { return overlap_ && ! is_implicit(); }
+
+  /// Update cells not adjacent to ghost zones into the "B" field
+  virtual void compute_interior ( Block * block) throw();
+
+  /// Update the remaining cells and copy "B" to the temperature
+  virtual void compute_boundary ( Block * block) throw();
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) const throw();
 
+  /// Whether the implicit solver is used
+  bool is_implicit () const
+  { return index_solver_ >= 0; }
+
 protected: // methods
 
   void compute_ (Block * block, enzo_float * Unew ) const throw();
 
+  /// Compute the range [a0,a1) of cells to update, which includes
+  /// ghost zones if they are not refreshed every update, and the
+  /// range [b0,b1) of active cells that do not depend on ghost zones,
+  /// and return the rank
+  int ranges_ (Block * block, int a0[3], int a1[3],
+	       int b0[3], int b1[3]) const throw();
+
+  /// Apply the explicit update from U to Unew in the cell range [lo,hi)
+  void compute_range_ (Block * block, const enzo_float * U,
+		       enzo_float * Unew,
+		       const int lo[3], const int hi[3]) const throw();
+
+  /// Set up and solve the implicit system for the temperature
+  void compute_implicit_ (Block * block) throw();
+
 protected: // attributes
 
   /// Thermal diffusivity
@@ -61,6 +99,15 @@ protected: // attributes
 
   /// Courant safety number
   double courant_;
+
+  /// Index of the solver for implicit updates, or -1 if explicit
+  int index_solver_;
+
+  /// Implicit weight: 1.0 for backward Euler, 0.5 for Crank-Nicolson
+  double theta_;
+
+  /// Whether to overlap the explicit update with the refresh
+  bool overlap_;
 };
 
 #endif /* ENZO_ENZO_METHOD_HEAT_HPP */
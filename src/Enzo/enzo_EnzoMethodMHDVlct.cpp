@@ -50,9 +50,14 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
 				      double pressure_floor,
 				      std::string mhd_choice,
 				      bool dual_energy_formalism,
-				      double dual_energy_formalism_eta)
-  : Method()
+				      double dual_energy_formalism_eta,
+				      int tile_size)
+  : Method(),
+    tile_size_(tile_size)
 {
+  ASSERT("EnzoMethodMHDVlct", "tile_size must not be negative",
+         tile_size >= 0);
+
   // Initialize equation of state (check the validity of quantity floors)
   EnzoEquationOfState::check_floor(density_floor);
   EnzoEquationOfState::check_floor(pressure_floor);
@@ -82,6 +87,7 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (std::string rsolver,
   // then make sure all required fields are defined
   build_field_l_(integrable_quantities, integrable_field_list_);
   build_field_l_(reconstructable_quantities, reconstructable_field_list_);
+  set_scratch_keys_();
 
   // make sure "pressure" is defined (it's needed to compute the timestep)
   FieldDescr * field_descr = cello::field_descr();
@@ -208,6 +214,11 @@ void EnzoMethodMHDVlct::pup (PUP::er &p)
   p|integrable_field_list_;
   p|reconstructable_field_list_;
   p|lazy_passive_list_;
+  p|tile_size_;
+
+  if (p.isUnpacking()){
+    set_scratch_keys_();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -328,11 +339,14 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
     // from computed by the Riemann Solver (to use in the calculation of the
     // internal energy source term). If the dual energy formalism is not in
     // use, don't actually allocate the array and set the pointer to NULL.
+    // (When fluxes are computed in tiles, compute_flux_tiled_ retrieves this
+    // array itself)
     EFlt3DArray interface_velocity_arr, *interface_velocity_arr_ptr;
-    if (eos_->uses_dual_energy_formalism()){
-      EFlt3DArray density = primitive_map.at("density");
-      interface_velocity_arr = EFlt3DArray(density.shape(0), density.shape(1),
-                                           density.shape(2));
+    if (eos_->uses_dual_energy_formalism() && (tile_size_ == 0)){
+      const EFlt3DArray &density = primitive_map.at("density");
+      interface_velocity_arr = reconstructed_scratch_
+        ({density.shape(0), density.shape(1), density.shape(2)})
+        .interface_velocity;
       interface_velocity_arr_ptr = &interface_velocity_arr;
     } else {
       interface_velocity_arr_ptr = nullptr;
@@ -345,17 +359,25 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
 
     const enzo_float* const cell_widths = enzo::block(block)->CellWidth;
 
+    // indicates that arrays passed to compute_flux_ cover the full block
+    const CSlice full_ax(nullptr, nullptr);
+    const std::array<CSlice,3> full_region = {full_ax, full_ax, full_ax};
+
     double dt = block->dt();
 
     // stale_depth indicates the number of field entries from the outermost
     // field value that the region including "stale" values (need to be
-    // refreshed) extends over.
-    int stale_depth = 0;
+    // refreshed) extends over. When ghost zones are refreshed only
+    // every stages_per_refresh() cycles, values staled by earlier
+    // cycles since the last refresh are still stale.
+    int stale_depth = block->method_stage() *
+      (half_dt_recon_->total_staling_rate() +
+       full_dt_recon_->total_staling_rate());
 
     // convert the passive scalars from conserved form to specific form
     // (outside the integrator, they are treated like conserved densities)
     compute_specific_passive_scalars_(*(lazy_passive_list_.get_list()),
-                                      primitive_map["density"],
+                                      primitive_map.at("density"),
                                       conserved_passive_scalar_map,
                                       primitive_map, stale_depth);
 
@@ -386,7 +408,7 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
         // held by conserved_passive_scalar_map.
         // Need to convert them to specific form
         compute_specific_passive_scalars_(*(lazy_passive_list_.get_list()),
-                                          cur_integrable_map["density"],
+                                          cur_integrable_map.at("density"),
                                           conserved_passive_scalar_map,
                                           cur_integrable_map, stale_depth);
       }
@@ -415,21 +437,22 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
                                             *(lazy_passive_list_.get_list()));
 
       // Compute flux along each dimension
-      compute_flux_(0, cur_dt, cell_widths[0], cur_reconstructable_map,
-                    priml_map, primr_map, pressure_l, pressure_r,
-                    xflux_map, dUcons_map, interface_velocity_arr_ptr,
-                    *reconstructor, bfield_method_, stale_depth,
-                    *(lazy_passive_list_.get_list()));
-      compute_flux_(1, cur_dt, cell_widths[1], cur_reconstructable_map,
-                    priml_map, primr_map, pressure_l, pressure_r,
-                    yflux_map, dUcons_map, interface_velocity_arr_ptr,
-                    *reconstructor, bfield_method_, stale_depth,
-                    *(lazy_passive_list_.get_list()));
-      compute_flux_(2, cur_dt, cell_widths[2], cur_reconstructable_map,
-                    priml_map, primr_map, pressure_l, pressure_r,
-                    zflux_map, dUcons_map, interface_velocity_arr_ptr,
-                    *reconstructor, bfield_method_, stale_depth,
-                    *(lazy_passive_list_.get_list()));
+      EnzoEFltArrayMap* flux_maps[3] = {&xflux_map, &yflux_map, &zflux_map};
+      for (int dim = 0; dim < 3; dim++){
+        if (tile_size_ > 0){
+          compute_flux_tiled_(dim, cur_dt, cell_widths[dim],
+                              cur_reconstructable_map, *(flux_maps[dim]),
+                              dUcons_map, *reconstructor, bfield_method_,
+                              stale_depth, *(lazy_passive_list_.get_list()));
+        } else {
+          compute_flux_(dim, cur_dt, cell_widths[dim],
+                        cur_reconstructable_map, priml_map, primr_map,
+                        pressure_l, pressure_r, *(flux_maps[dim]), dUcons_map,
+                        interface_velocity_arr_ptr, *reconstructor,
+                        bfield_method_, stale_depth,
+                        *(lazy_passive_list_.get_list()), full_region);
+        }
+      }
 
       // increment the stale_depth
       stale_depth+=reconstructor->immediate_staling_rate();
@@ -489,12 +512,20 @@ void EnzoMethodMHDVlct::check_mesh_and_ghost_size_(Block *block) const noexcept
 			 full_dt_recon_->total_staling_rate());
   ASSERT1("EnzoMethodMHDVlct::compute", "ghost depth must be at least %d.",
 	  min_ghost_depth, std::min(nx, std::min(ny, nz)) >= min_ghost_depth);
+
+  // Check that ghost zones are deep enough to skip refreshes
+  const int stages = stages_per_refresh();
+  ASSERT2("EnzoMethodMHDVlct::compute",
+	  "ghost depth must be at least %d for stages_per_refresh = %d.",
+	  stages*min_ghost_depth, stages,
+	  (stages == 1 ||
+	   std::min(gx, std::min(gy, gz)) >= stages*min_ghost_depth));
 }
 
 //----------------------------------------------------------------------
 
 void EnzoMethodMHDVlct::compute_specific_passive_scalars_
-(const str_vec_t &passive_list, EFlt3DArray& density,
+(const str_vec_t &passive_list, const EFlt3DArray& density,
  EnzoEFltArrayMap& conserved_passive_scalar_map,
  EnzoEFltArrayMap& specific_passive_scalar_map, int stale_depth) const noexcept
 {
@@ -527,7 +558,8 @@ void EnzoMethodMHDVlct::compute_flux_
  EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
  EFlt3DArray *interface_velocity_arr_ptr, EnzoReconstructor &reconstructor,
  EnzoBfieldMethod *bfield_method, int stale_depth,
- const str_vec_t& passive_list) const noexcept
+ const str_vec_t& passive_list,
+ const std::array<CSlice,3> &region) const noexcept
 {
 
   // purely for the purposes of making the caluclation more explicit, we define
@@ -553,7 +585,7 @@ void EnzoMethodMHDVlct::compute_flux_
   if (bfield_method != nullptr) {
     bfield_method->correct_reconstructed_bfield(reconstructable_l,
                                                 reconstructable_r,
-                                                dim, cur_stale_depth);
+                                                dim, cur_stale_depth, region);
   }
 
   // Calculate integrable values on left and right faces:
@@ -589,29 +621,150 @@ void EnzoMethodMHDVlct::compute_flux_
 
   // Finally, have the record the upwind direction (for handling CT)
   if (bfield_method != nullptr){
-    bfield_method->identify_upwind(flux_map, dim, cur_stale_depth);
+    bfield_method->identify_upwind(flux_map, dim, cur_stale_depth, region);
   }
 }
 
 //----------------------------------------------------------------------
 
-static void add_temporary_arrays_to_map_
-(EnzoEFltArrayMap &map, std::array<int,3> &shape,
- const std::vector<std::string>* const nonpassive_names,
- const str_vec_t* const passive_lists)
+EnzoMethodMHDVlct::ScratchSpace_
+EnzoMethodMHDVlct::scratch_spaces_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+// Constructs a frozen map of temporary arrays (backed by a single contiguous
+// allocation). The nonpassive keys come first (in the order they are listed),
+// followed by the passive scalar keys.
+static EnzoEFltArrayMap build_temporary_map_
+(std::string name, const std::array<int,3> &shape,
+ const std::vector<std::string> &nonpassive_names,
+ const str_vec_t &passive_list)
+{
+  std::vector<std::string> keys = nonpassive_names;
+  keys.insert(keys.end(), passive_list.begin(), passive_list.end());
+  return EnzoEFltArrayMap(name, keys, shape);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMHDVlct::set_scratch_keys_() noexcept
 {
+  // To assist with setting up arrays, let's create a list of ALL primitive
+  // keys (excluding passive scalars). This includes all integrable keys and
+  // reconstructable keys (the latter includes quantities like pressure).
+  //
+  // The keys operated upon by the Riemann Solver are listed first (in the
+  // same order as its lookup table), so that the leading entries of the
+  // frozen temporary maps are laid out in that order.
+  primitive_keys_ = unique_combination_
+    (riemann_solver_->lut_ordered_keys(),
+     unique_combination_(integrable_field_list_, reconstructable_field_list_));
+  // If CT is in use, dUcons_map should not have storage for magnetic fields
+  // since CT independently updates magnetic fields (this exclusion is
+  // implicitly handled integrable_updater_)
+  dUcons_keys_ = integrable_updater_->integrable_keys();
+}
 
-  if (nonpassive_names != nullptr){
-    for (const std::string& name : (*nonpassive_names)){
-      map[name] = EFlt3DArray(shape[0], shape[1], shape[2]);
-    }
+//----------------------------------------------------------------------
+
+EnzoMethodMHDVlct::ScratchSpace_& EnzoMethodMHDVlct::scratch_space_
+(const std::array<int,3> &shape, const str_vec_t &passive_keys) const noexcept
+{
+  ScratchSpace_ &scratch = scratch_spaces_[cello::index_static()];
+  const std::vector<std::string> &primitive_keys = primitive_keys_;
+  const std::vector<std::string> &dUcons_keys = dUcons_keys_;
+  bool dual_energy = eos_->uses_dual_energy_formalism();
+
+  if ((scratch.shape == shape) && (scratch.primitive_keys == primitive_keys) &&
+      (scratch.dUcons_keys == dUcons_keys) &&
+      (scratch.passive_keys == passive_keys) &&
+      (scratch.dual_energy == dual_energy)){
+    return scratch;
   }
 
-  if (passive_lists != nullptr){
-    for (const std::string& key : (*passive_lists)){
-      map[key] = EFlt3DArray(shape[0], shape[1], shape[2]);
-    }
+  // release the previously allocated arrays before allocating new ones (so
+  // that the old and new arrays are never held at the same time)
+  scratch = ScratchSpace_();
+  scratch.shape = shape;
+  scratch.primitive_keys = primitive_keys;
+  scratch.dUcons_keys = dUcons_keys;
+  scratch.passive_keys = passive_keys;
+  scratch.dual_energy = dual_energy;
+
+  scratch.specific_passive_map = build_temporary_map_
+    ("specific_passive", shape, std::vector<std::string>(), passive_keys);
+  scratch.temp_primitive_map = build_temporary_map_
+    ("temp_primitive", shape, primitive_keys, passive_keys);
+
+  const char* flux_map_names[3] = {"zflux", "yflux", "xflux"};
+  for (std::size_t i = 0; i < 3; i++){
+    std::array<int,3> cur_shape = shape; // makes a deep copy
+    cur_shape[i] -= 1;
+    scratch.flux_maps[i] = build_temporary_map_
+      (flux_map_names[i], cur_shape, primitive_keys, passive_keys);
+  }
+
+  scratch.dUcons_map = build_temporary_map_("dUcons", shape, dUcons_keys,
+                                            passive_keys);
+  return scratch;
+}
+
+//----------------------------------------------------------------------
+
+const EnzoMethodMHDVlct::ReconstructedScratch_&
+EnzoMethodMHDVlct::reconstructed_scratch_
+(const std::array<int,3> &shape) const noexcept
+{
+  ScratchSpace_ &scratch = scratch_spaces_[cello::index_static()];
+
+  auto &cache = scratch.reconstructed;
+  auto search = std::find_if
+    (cache.begin(), cache.end(),
+     [&shape](const std::pair<std::array<int,3>, ReconstructedScratch_> &e)
+     { return e.first == shape; });
+  if (search != cache.end()){
+    // move the entry to the end, so that it's the last to be evicted
+    std::rotate(search, search + 1, cache.end());
+    return cache.back().second;
+  }
+
+  // evict the least recently used entry. The capacity is reserved up front
+  // so that the entries are never reallocated (an uninitialized EFlt3DArray
+  // can't be copied)
+  if (cache.size() >= max_reconstructed_scratch_){
+    cache.erase(cache.begin());
+  }
+  cache.reserve(max_reconstructed_scratch_);
+  cache.emplace_back(shape, ReconstructedScratch_());
+  ReconstructedScratch_ &out = cache.back().second;
+
+  // Prepare temporary fields for priml and primr
+  // As necessary, we pretend that these are centered along:
+  //   - z and have shape (mz-1,  my,  mx)
+  //   - y and have shape (  mz,my-1,  mx)
+  //   - x and have shape (  mz,  my,mx-1)
+  out.priml_map = build_temporary_map_("priml", shape, scratch.primitive_keys,
+                                       scratch.passive_keys);
+  out.primr_map = build_temporary_map_("primr", shape, scratch.primitive_keys,
+                                       scratch.passive_keys);
+
+  // If there are pressure entries in priml_map and primr_map (depends on the
+  // EOS), set pressure_l and pressure_name_r equal to
+  // those field names. Otherwise, reserve/allocate left/right pressure fields
+  if (out.priml_map.contains("pressure")) {
+    out.pressure_l = out.priml_map.at("pressure");
+    out.pressure_r = out.primr_map.at("pressure");
+  } else {
+    out.pressure_l = EFlt3DArray(shape[0], shape[1], shape[2]);
+    out.pressure_r = EFlt3DArray(shape[0], shape[1], shape[2]);
+  }
+
+  // The interface velocity (used to compute the internal energy source
+  // term) is only needed when the dual energy formalism is in use
+  if (scratch.dual_energy){
+    out.interface_velocity = EFlt3DArray(shape[0], shape[1], shape[2]);
   }
+  return out;
 }
 
 //----------------------------------------------------------------------
@@ -626,15 +779,8 @@ void EnzoMethodMHDVlct::setup_arrays_
  EnzoEFltArrayMap &zflux_map, EnzoEFltArrayMap &dUcons_map) noexcept
 {
 
-  // allocate stuff! Make sure to do it in a way such that we don't have to
-  // separately deallocate it!
-
-  // To assist with setting up arrays, let's create a list of ALL primitive
-  // keys (including passive scalars) and all integrable keys. These are the
-  // same thing except the latter excludes quantities (like pressure) that we
-  // don't compute pressure for.
-  std::vector<std::string> combined_key_list = unique_combination_
-    (integrable_field_list_, reconstructable_field_list_);
+  // The temporary arrays are all views of the scratch space that this PE
+  // reuses for every block (so nothing needs to be separately deallocated)
 
   // First, setup conserved_passive_scalar_map
   conserved_passive_scalar_map = conserved_passive_scalar_map_(block);
@@ -644,53 +790,129 @@ void EnzoMethodMHDVlct::setup_arrays_
   std::array<int,3> shape = {primitive_map.at("density").shape(0),
                              primitive_map.at("density").shape(1),
                              primitive_map.at("density").shape(2)};
-  add_temporary_arrays_to_map_(primitive_map, shape, nullptr,
-                               (lazy_passive_list_.get_list()).get());
+
+  std::shared_ptr<const str_vec_t> passive_list = lazy_passive_list_.get_list();
+  const ScratchSpace_ &scratch = scratch_space_(shape, *passive_list);
+
+  // add the temporary arrays used to hold the specific form of the passive
+  // scalars to primitive_map
+  for (const std::string& key : scratch.passive_keys){
+    primitive_map[key] = scratch.specific_passive_map.at(key);
+  }
 
   // Then, setup temp_primitive_map
-  add_temporary_arrays_to_map_(temp_primitive_map, shape, &combined_key_list,
-                               (lazy_passive_list_.get_list()).get());
+  temp_primitive_map = scratch.temp_primitive_map;
 
   // Prepare arrays to hold fluxes (it should include groups for all actively
   // and passively advected quantities)
-  EnzoEFltArrayMap* flux_maps[3] = {&zflux_map, &yflux_map, &xflux_map};
-  for (std::size_t i = 0; i < 3; i++){
-    std::array<int,3> cur_shape = shape; // makes a deep copy
-    cur_shape[i] -= 1;
-    add_temporary_arrays_to_map_(*(flux_maps[i]), cur_shape,
-                                 &combined_key_list,
-                                 (lazy_passive_list_.get_list()).get());
-  }
+  zflux_map = scratch.flux_maps[0];
+  yflux_map = scratch.flux_maps[1];
+  xflux_map = scratch.flux_maps[2];
 
   // Prepare fields used to accumulate all changes to the actively advected and
-  // passively advected quantities. If CT is in use, dUcons_group should not
-  // have storage for magnetic fields since CT independently updates magnetic
-  // fields (this exclusion is implicitly handled integrable_updater_)
-  std::vector<std::string> tmp = integrable_updater_->integrable_keys();
-  add_temporary_arrays_to_map_(dUcons_map, shape, &tmp,
-                               (lazy_passive_list_.get_list()).get());
+  // passively advected quantities.
+  dUcons_map = scratch.dUcons_map;
+
+  // Prepare scratch space for the reconstructed values. When computing the
+  // fluxes in tiles, compute_flux_tiled_ uses (much smaller) scratch space
+  // for the reconstructed values
+  if (tile_size_ == 0){
+    const ReconstructedScratch_ &recon_scratch = reconstructed_scratch_(shape);
+    priml_map = recon_scratch.priml_map;
+    primr_map = recon_scratch.primr_map;
+    pressure_l = recon_scratch.pressure_l;
+    pressure_r = recon_scratch.pressure_r;
+  }
+}
+//----------------------------------------------------------------------
 
-  // Prepare temporary fields for priml and primr
-  // As necessary, we pretend that these are centered along:
-  //   - z and have shape (mz-1,  my,  mx)
-  //   - y and have shape (  mz,my-1,  mx)
-  //   - x and have shape (  mz,  my,mx-1)
-  add_temporary_arrays_to_map_(priml_map, shape, &combined_key_list,
-                               (lazy_passive_list_.get_list()).get());
-  add_temporary_arrays_to_map_(primr_map, shape, &combined_key_list,
-                               (lazy_passive_list_.get_list()).get());
+void EnzoMethodMHDVlct::compute_flux_tiled_
+(int dim, double cur_dt, enzo_float cell_width,
+ EnzoEFltArrayMap &reconstructable_map, EnzoEFltArrayMap &flux_map,
+ EnzoEFltArrayMap &dUcons_map, EnzoReconstructor &reconstructor,
+ EnzoBfieldMethod *bfield_method, int stale_depth,
+ const str_vec_t& passive_list) const noexcept
+{
+  // the tiles are taken along an axis perpendicular to dim. (tile_axis is
+  // the index of an axis of a CelloArray, where 0 corresponds to z)
+  const int tile_axis = (dim == 2) ? 1 : 0;
+
+  // Each tile is padded along tile_axis by the stale depth used after
+  // reconstruction. Consequently, when compute_flux_ is applied to a tile,
+  // the Riemann Fluxes and the accumulated flux divergence are computed for
+  // exactly the unpadded cells of the tile. (The reconstructed values are
+  // also computed in some of the padding cells, but they are discarded)
+  const int pad = stale_depth + reconstructor.immediate_staling_rate();
+
+  EFlt3DArray density = reconstructable_map.at("density");
+  std::array<int,3> shape = {density.shape(0), density.shape(1),
+                             density.shape(2)};
+  const int tile_start = pad;
+  const int tile_stop = shape[tile_axis] - pad;
+  ASSERT("EnzoMethodMHDVlct::compute_flux_tiled_",
+         "The block is too small to be split into tiles",
+         tile_stop > tile_start);
+
+  // retrieve scratch space for a single (padded) tile
+  std::array<int,3> scratch_shape = shape;
+  scratch_shape[tile_axis] = (std::min(tile_size_, tile_stop - tile_start) +
+                              2 * pad);
+
+  const ReconstructedScratch_ &recon_scratch =
+    reconstructed_scratch_(scratch_shape);
+  const EnzoEFltArrayMap &priml_scratch = recon_scratch.priml_map;
+  const EnzoEFltArrayMap &primr_scratch = recon_scratch.primr_map;
+  const EFlt3DArray &pressure_l_scratch = recon_scratch.pressure_l;
+  const EFlt3DArray &pressure_r_scratch = recon_scratch.pressure_r;
+  const EFlt3DArray &interface_velocity_scratch =
+    recon_scratch.interface_velocity;
+
+  const CSlice full_ax(nullptr, nullptr);
+
+  for (int start = tile_start; start < tile_stop; start += tile_size_){
+    int stop = std::min(start + tile_size_, tile_stop);
+
+    // region of the block covered by the current (padded) tile
+    std::array<CSlice,3> region = {full_ax, full_ax, full_ax};
+    region[tile_axis] = CSlice(start - pad, stop + pad);
+
+    // region of the scratch arrays used by the current tile (the final tile
+    // may be smaller than the others)
+    std::array<CSlice,3> scratch_region = {full_ax, full_ax, full_ax};
+    scratch_region[tile_axis] = CSlice(0, stop - start + 2 * pad);
+
+    EnzoEFltArrayMap tile_reconstructable_map =
+      reconstructable_map.subarray_map(region[0], region[1], region[2]);
+    EnzoEFltArrayMap tile_flux_map =
+      flux_map.subarray_map(region[0], region[1], region[2]);
+    EnzoEFltArrayMap tile_dUcons_map =
+      dUcons_map.subarray_map(region[0], region[1], region[2]);
+
+    EnzoEFltArrayMap tile_priml_map = priml_scratch.subarray_map
+      (scratch_region[0], scratch_region[1], scratch_region[2]);
+    EnzoEFltArrayMap tile_primr_map = primr_scratch.subarray_map
+      (scratch_region[0], scratch_region[1], scratch_region[2]);
+    EFlt3DArray tile_pressure_l = pressure_l_scratch.subarray
+      (scratch_region[0], scratch_region[1], scratch_region[2]);
+    EFlt3DArray tile_pressure_r = pressure_r_scratch.subarray
+      (scratch_region[0], scratch_region[1], scratch_region[2]);
+
+    EFlt3DArray tile_interface_velocity, *tile_interface_velocity_ptr;
+    if (eos_->uses_dual_energy_formalism()){
+      tile_interface_velocity = interface_velocity_scratch.subarray
+        (scratch_region[0], scratch_region[1], scratch_region[2]);
+      tile_interface_velocity_ptr = &tile_interface_velocity;
+    } else {
+      tile_interface_velocity_ptr = nullptr;
+    }
 
-  // If there are pressure entries in priml_map and primr_map (depends on the
-  // EOS), set pressure_l and pressure_name_r equal to
-  // those field names. Otherwise, reserve/allocate left/right pressure fields
-  if (priml_map.contains("pressure")) {
-    pressure_l = priml_map.at("pressure");
-    pressure_r = primr_map.at("pressure");
-  } else {
-    pressure_l = EFlt3DArray(shape[0], shape[1], shape[2]);
-    pressure_r = EFlt3DArray(shape[0], shape[1], shape[2]);
+    compute_flux_(dim, cur_dt, cell_width, tile_reconstructable_map,
+                  tile_priml_map, tile_primr_map,
+                  tile_pressure_l, tile_pressure_r,
+                  tile_flux_map, tile_dUcons_map,
+                  tile_interface_velocity_ptr, reconstructor, bfield_method,
+                  stale_depth, passive_list, region);
   }
-
 }
 
 //----------------------------------------------------------------------
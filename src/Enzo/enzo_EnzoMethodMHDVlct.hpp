@@ -71,6 +71,9 @@
 ///          as cell-centered fields (to guarantee that they have enough space).
 ///        - All reconstructable and integrable primitive quantities have
 ///          key-array pairs named for them in maps number 1, 2, 3, and 4.
+///        - When the pipelined mode is enabled (tile_size_ > 0), priml_map
+///          and primr_map only hold enough space for a single tile of the
+///          block (see compute_flux_tiled_)
 
 #ifndef ENZO_ENZO_METHOD_VLCT_HPP
 #define ENZO_ENZO_METHOD_VLCT_HPP
@@ -106,7 +109,8 @@ public: // interface
 		    double pressure_floor,
 		    std::string mhd_choice,
 		    bool dual_energy_formalism,
-		    double dual_energy_formalism_eta);
+		    double dual_energy_formalism_eta,
+		    int tile_size);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodMHDVlct);
@@ -123,7 +127,10 @@ public: // interface
       bfield_method_(nullptr),
       integrable_field_list_(),
       reconstructable_field_list_(),
-      lazy_passive_list_()
+      primitive_keys_(),
+      dUcons_keys_(),
+      lazy_passive_list_(),
+      tile_size_(0)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -135,6 +142,15 @@ public: // interface
   /// Apply the method to advance a block one timestep 
   virtual void compute( Block * block) throw();
 
+  /// The update is not split into compute_interior() and
+  /// compute_boundary(). Other Blocks on the same PE may compute
+  /// between the two calls, but the intermediate state would live in
+  /// per-PE scratch space and in bfield_method_, which holds a single
+  /// target Block at a time. The full timestep also overwrites the
+  /// refreshed fields in place.
+  virtual bool overlap_refresh () const throw()
+  { return false; }
+
   virtual std::string name () throw () 
   { return "mhd_vlct"; }
 
@@ -181,7 +197,7 @@ protected: // methods
   ///     form of the scalars will be stored.
   /// @param[in]  stale_depth The current stale depth
   void compute_specific_passive_scalars_
-  (const str_vec_t &passive_list, EFlt3DArray& density,
+  (const str_vec_t &passive_list, const EFlt3DArray& density,
    EnzoEFltArrayMap& conserved_passive_scalar_map,
    EnzoEFltArrayMap& specific_passive_scalar_map,
    int stale_depth) const noexcept;
@@ -252,6 +268,10 @@ protected: // methods
   /// @param[in]     stale_depth indicates the current stale depth (before
   ///     performing reconstruction)
   /// @param[in]     passive_list A list of keys for passively advected scalars.
+  /// @param[in]     region Slices (ordered z, y, x) specifying the region of
+  ///     the block that all of the maps and arrays correspond to. This is
+  ///     only used by `bfield_method`. When the arrays cover the full block,
+  ///     every slice should be `CSlice(nullptr, nullptr)`.
   ///
   /// @par Note
   /// It might be worth breaking this into 2 functions (where one of them
@@ -266,6 +286,28 @@ protected: // methods
    EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
    EFlt3DArray *interface_velocity_arr_ptr, EnzoReconstructor &reconstructor,
    EnzoBfieldMethod *bfield_method, int stale_depth,
+   const str_vec_t& passive_list,
+   const std::array<CSlice,3> &region) const noexcept;
+
+  /// Pipelined counterpart of `compute_flux_` that is used when `tile_size_`
+  /// is positive.
+  ///
+  /// The block is split into tiles of (up to) `tile_size_` cells along an axis
+  /// perpendicular to `dim` (z if `dim` is 0 or 1, otherwise y). Each tile is
+  /// padded by the current stale depth on both sides along that axis so that
+  /// `compute_flux_` can be applied to views of the tile. Reconstruction, the
+  /// Riemann solver and the accumulation of the flux divergence are
+  /// performed for one tile at a time, while the data is still in cache.
+  ///
+  /// The left/right reconstructed primitives, the reconstructed pressures
+  /// and the interface velocities only need scratch space for a single tile.
+  /// This scratch space is allocated once per call and is reused by every
+  /// tile. The other arguments have the same meaning as in `compute_flux_`.
+  void compute_flux_tiled_
+  (int dim, double cur_dt, enzo_float cell_width,
+   EnzoEFltArrayMap &reconstructable_map, EnzoEFltArrayMap &flux_map,
+   EnzoEFltArrayMap &dUcons_map, EnzoReconstructor &reconstructor,
+   EnzoBfieldMethod *bfield_method, int stale_depth,
    const str_vec_t& passive_list) const noexcept;
 
   /// Setup arrays used throughout `compute`. This includes both arrays that
@@ -300,6 +342,12 @@ protected: // methods
   ///     passively advected scalars. If CT is used, this grouping won't have
   ///     space to store changes in the magnetic fields (that update is handled
   ///     separately).
+  ///
+  /// @note
+  /// All temporary arrays are views of the current PE's scratch space (see
+  /// `ScratchSpace_`). When `tile_size_` is positive, `priml_map`,
+  /// `primr_map`, `pressure_l` and `pressure_r` are left empty
+  /// (`compute_flux_tiled_` uses tile-sized scratch space instead).
   void setup_arrays_
   (Block *block, EnzoEFltArrayMap &primitive_map,
    EnzoEFltArrayMap &temp_primitive_map,
@@ -309,8 +357,79 @@ protected: // methods
    EnzoEFltArrayMap &xflux_map, EnzoEFltArrayMap &yflux_map,
    EnzoEFltArrayMap &zflux_map, EnzoEFltArrayMap &dUcons_map) noexcept;
 
+  /// Holds the scratch arrays used to hold the left/right reconstructed
+  /// primitives, the left/right pressure values and (if the dual energy
+  /// formalism is in use) the interface velocity. Refer to the description
+  /// of the corresponding arguments of `setup_arrays_` for more details.
+  struct ReconstructedScratch_ {
+    EnzoEFltArrayMap priml_map;
+    EnzoEFltArrayMap primr_map;
+    EFlt3DArray pressure_l;
+    EFlt3DArray pressure_r;
+    EFlt3DArray interface_velocity;
+  };
+
+  /// Holds the temporary arrays used by `compute`.
+  ///
+  /// A separate instance is maintained for each PE (see `scratch_spaces_`)
+  /// and it's reused by every block computed on that PE, across cycles. This
+  /// is safe because `compute` always runs to completion for one block
+  /// before another block on the same PE begins. The arrays are only
+  /// reallocated when the shape of the block or the set of keys changes.
+  struct ScratchSpace_ {
+    /// The cell-centered shape and the keys the arrays were allocated for
+    std::array<int,3> shape = {{0,0,0}};
+    std::vector<std::string> primitive_keys;
+    std::vector<std::string> dUcons_keys;
+    str_vec_t passive_keys;
+    bool dual_energy = false;
+
+    /// Holds the specific form of the passive scalars
+    EnzoEFltArrayMap specific_passive_map;
+    EnzoEFltArrayMap temp_primitive_map;
+    /// Holds the z, y, and x flux maps (in that order)
+    EnzoEFltArrayMap flux_maps[3];
+    EnzoEFltArrayMap dUcons_map;
+
+    /// Holds the scratch arrays for the reconstructed values, paired with
+    /// their shape. There is an entry for the full block or, if fluxes are
+    /// computed in tiles, entries for the tile-sized scratch space (the
+    /// shape depends on the direction and the stale depth). At most
+    /// `max_reconstructed_scratch_` entries are kept; the most recently used
+    /// entry is stored last.
+    std::vector<std::pair<std::array<int,3>, ReconstructedScratch_>>
+      reconstructed;
+  };
+
+  /// The maximum number of shapes for which reconstructed scratch arrays are
+  /// retained. This covers the tile-sized scratch arrays used for both
+  /// tiling axes during both half time-steps.
+  static const std::size_t max_reconstructed_scratch_ = 4;
+
+  /// Initializes `primitive_keys_` and `dUcons_keys_` (this must be called
+  /// after the Riemann Solver and the integrable updater are initialized)
+  void set_scratch_keys_() noexcept;
+
+  /// Returns the current PE's scratch space after ensuring that it holds
+  /// arrays allocated for a block with the specified (cell-centered) shape
+  /// and the specified passive scalars
+  ScratchSpace_& scratch_space_(const std::array<int,3> &shape,
+                                const str_vec_t &passive_keys) const noexcept;
+
+  /// Returns the current PE's scratch arrays for holding reconstructed
+  /// values with the specified shape (they are allocated on first use).
+  ///
+  /// This should only be called after `scratch_space_`. The returned
+  /// reference is only valid until the next call (the arrays themselves
+  /// remain valid as long as a view of them is held).
+  const ReconstructedScratch_& reconstructed_scratch_
+  (const std::array<int,3> &shape) const noexcept;
+
 protected: // attributes
 
+  /// Per-PE scratch space (indexed by `cello::index_static()`)
+  static ScratchSpace_ scratch_spaces_[CONFIG_NODE_SIZE];
+
   /// Pointer to the equation of state of the fluid
   EnzoEquationOfState *eos_;
   /// Pointer to the reconstructor used to reconstruct the fluid during the
@@ -338,8 +457,23 @@ protected: // attributes
   /// keys to the mappings of arrays used in the calculation
   std::vector<std::string> reconstructable_field_list_;
 
+  /// Keys of the temporary primitive, flux and reconstructed maps (excluding
+  /// passive scalars). The keys operated upon by the Riemann Solver are
+  /// listed first. This is derived from the other attributes (it's rebuilt
+  /// rather than being serialized)
+  std::vector<std::string> primitive_keys_;
+  /// Keys of the temporary map used to accumulate changes to the integrable
+  /// quantities (excluding passive scalars). This is derived from the other
+  /// attributes (it's rebuilt rather than being serialized)
+  std::vector<std::string> dUcons_keys_;
+
   /// Lazy initializer of the list of fields holding passive scalars
   EnzoLazyPassiveScalarFieldList lazy_passive_list_;
+
+  /// The number of cells per tile when computing fluxes with the pipelined
+  /// `compute_flux_tiled_`. A value of 0 indicates that fluxes are computed
+  /// for the full block at once.
+  int tile_size_;
 };
 
 #endif /* ENZO_ENZO_METHOD_VLCT_HPP */
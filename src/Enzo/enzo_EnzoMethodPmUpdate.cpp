@@ -194,69 +194,91 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
         const int np = particle.num_particles(it,ib);
 
+#ifdef DEBUG_UPDATE
+        // the sums are shared by the chunks
+        const int num_chunks = 1;
+#else
+        const int num_chunks = cello::num_threads();
+#endif
+
         if (rank >= 1) {
 
-	        for (int ip=0; ip<np; ip++) {
+          cello::parallel_for_range
+            (0, np, [&] (int ip_first, int ip_last)
+             {
+               for (int ip=ip_first; ip<ip_last; ip++) {
 
-	          const int ipdv = ip*dv;
-	          const int ipdp = ip*dp;
-	          const int ipda = ip*da;
+                 const int ipdv = ip*dv;
+                 const int ipdp = ip*dp;
+                 const int ipda = ip*da;
 
 #ifdef DEBUG_UPDATE
-      	    v3sum[0]+=std::abs(vx[ipdv]);
-      	    a3sum[0]+=std::abs(ax[ipda]);
-      	    v3sum2[0]+=vx[ipdv]*vx[ipdv];
-      	    a3sum2[0]+=ax[ipda]*ax[ipda];
-      	    CkPrintf ("DEBUG_UPDATE x %g v %g a %g\n",x[ipdp],vx[ipdv],ax[ipda]);
+                 v3sum[0]+=std::abs(vx[ipdv]);
+                 a3sum[0]+=std::abs(ax[ipda]);
+                 v3sum2[0]+=vx[ipdv]*vx[ipdv];
+                 a3sum2[0]+=ax[ipda]*ax[ipda];
+                 CkPrintf ("DEBUG_UPDATE x %g v %g a %g\n",x[ipdp],vx[ipdv],ax[ipda]);
 #endif
-      	    vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
-      	    x [ipdp] += cp*vx[ipdv];
-      	    vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
+                 vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
+                 x [ipdp] += cp*vx[ipdv];
+                 vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
 
-	        } // ip
+               } // ip
+             },
+             num_chunks);
         }
 
         if (rank >= 2) {
 
-	         for (int ip=0; ip<np; ip++) {
+          cello::parallel_for_range
+            (0, np, [&] (int ip_first, int ip_last)
+             {
+               for (int ip=ip_first; ip<ip_last; ip++) {
 
-        	   const int ipdv = ip*dv;
-        	   const int ipdp = ip*dp;
-        	   const int ipda = ip*da;
+                 const int ipdv = ip*dv;
+                 const int ipdp = ip*dp;
+                 const int ipda = ip*da;
 
 #ifdef DEBUG_UPDATE
-      	     v3sum[1]+=std::abs(vy[ipdv]);
-      	     a3sum[1]+=std::abs(ay[ipda]);
-      	     v3sum2[1]+=vy[ipdv]*vy[ipdv];
-      	     a3sum2[1]+=ay[ipda]*ay[ipda];
+                 v3sum[1]+=std::abs(vy[ipdv]);
+                 a3sum[1]+=std::abs(ay[ipda]);
+                 v3sum2[1]+=vy[ipdv]*vy[ipdv];
+                 a3sum2[1]+=ay[ipda]*ay[ipda];
 #endif
-             vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
-             y [ipdp] += cp*vy[ipdv];
-             vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
+                 vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
+                 y [ipdp] += cp*vy[ipdv];
+                 vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
 
-	         } // ip
+               } // ip
+             },
+             num_chunks);
         }
 
         if (rank >= 3) {
 
-	        for (int ip=0; ip<np; ip++) {
+          cello::parallel_for_range
+            (0, np, [&] (int ip_first, int ip_last)
+             {
+               for (int ip=ip_first; ip<ip_last; ip++) {
 
-	          const int ipdv = ip*dv;
-	          const int ipdp = ip*dp;
-	          const int ipda = ip*da;
+                 const int ipdv = ip*dv;
+                 const int ipdp = ip*dp;
+                 const int ipda = ip*da;
 
 #ifdef DEBUG_UPDATE
-      	    v3sum[2]+=std::abs(vz[ipdv]);
-      	    a3sum[2]+=std::abs(az[ipda]);
-      	    v3sum2[2]+=vz[ipdv]*vz[ipdv];
-      	    a3sum2[2]+=az[ipda]*az[ipda];
+                 v3sum[2]+=std::abs(vz[ipdv]);
+                 a3sum[2]+=std::abs(az[ipda]);
+                 v3sum2[2]+=vz[ipdv]*vz[ipdv];
+                 a3sum2[2]+=az[ipda]*az[ipda];
 #endif
 
-      	    vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
-      	    z [ipdp] += cp*vz[ipdv];
-      	    vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
+                 vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
+                 z [ipdp] += cp*vz[ipdv];
+                 vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
 
-	        } // ip
+               } // ip
+             },
+             num_chunks);
         } // rank 3
       } // ib loop
     } // end loop over particle types
@@ -168,59 +168,44 @@ void EnzoMethodTurbulence::compute ( Block * block) throw()
     }
   }
 
-  CkCallback callback (CkIndex_EnzoBlock::p_method_turbulence_end(NULL),
-		       enzo_block->proxy_array());
-  enzo_block->contribute(n*sizeof(double),g,r_method_turbulence_type,callback);
-}
-
-//----------------------------------------------------------------------
-
-CkReduction::reducerType r_method_turbulence_type;
-
-void register_method_turbulence(void)
-{ r_method_turbulence_type = CkReduction::addReducer(r_method_turbulence); }
-
-CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs)
-{
-  double accum[max_turbulence_array];
-  for (int i=0; i<max_turbulence_array; i++) {
-    accum[i] = 0.0;
-  }
-  accum[index_turbulence_mind] = std::numeric_limits<double>::max();
-  accum[index_turbulence_maxd] = - std::numeric_limits<double>::max();
+  // Reduce sums, minimum and maximum over the mesh tree
 
+  long double reduce[n];
+  int op[n];
   for (int i=0; i<n; i++) {
-    double * values = (double *) msgs[i]->getData();
-    for (int ig=0; ig<max_turbulence_array-2; ig++) {
-      accum [ig] += values[ig];
-    }
-    accum [index_turbulence_mind] =
-      std::min(accum[index_turbulence_mind],values[index_turbulence_mind]);
-    accum [index_turbulence_maxd] =
-      std::max(accum[index_turbulence_maxd],values[index_turbulence_maxd]);
+    reduce[i] = g[i];
+    op[i] = reduce_tree_sum;
   }
-  return CkReductionMsg::buildNew(max_turbulence_array*sizeof(double),accum);
+  op[index_turbulence_mind] = reduce_tree_min;
+  op[index_turbulence_maxd] = reduce_tree_max;
+
+  enzo_block->reduce_tree_start
+    (enzo_reduce_id_method_turbulence,
+     CkIndex_EnzoBlock::p_method_turbulence_end(),
+     n, reduce, op, cello::config()->mesh_min_level, true);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::p_method_turbulence_end(CkReductionMsg * msg)
+void EnzoBlock::p_method_turbulence_end()
 {
   TRACE_TURBULENCE;
   performance_start_(perf_compute,__FILE__,__LINE__);
-  method()->compute_resume (this,msg);
+  static_cast<EnzoMethodTurbulence*> (method())->compute_resume (this);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoMethodTurbulence::compute_resume
-(Block * block,
- CkReductionMsg * msg) throw()
+void EnzoMethodTurbulence::compute_resume (Block * block) throw()
 {
   TRACE_TURBULENCE;
 
-  double * g = (double *)msg->getData();
+  const std::vector<long double> & result =
+    block->reduce_tree_result(enzo_reduce_id_method_turbulence);
+
+  double g[max_turbulence_array];
+  std::copy (result.begin(), result.end(), g);
 
   Data * data = block->data();
   Field field = data->field();
@@ -357,10 +342,9 @@ void EnzoMethodTurbulence::compute_resume
   }
 
   if (block->is_leaf()) {
-    compute_resume_(block,msg);
+    compute_resume_(block,g);
   }
 
-  delete msg;
   block->compute_done();
 
 }
@@ -368,7 +352,7 @@ void EnzoMethodTurbulence::compute_resume
 //----------------------------------------------------------------------
 
 void EnzoMethodTurbulence::compute_resume_
-(Block * block, CkReductionMsg * msg) throw()
+(Block * block, const double * g) throw()
 {
 
   TRACE_TURBULENCE;
@@ -385,8 +369,6 @@ void EnzoMethodTurbulence::compute_resume_
 
   int n = nx*ny*nz;
 
-  double * g = (double *)msg->getData();
-
   double dt = block->dt();
 
   double norm = (edot_ != 0.0) ?
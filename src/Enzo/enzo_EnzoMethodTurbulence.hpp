@@ -48,13 +48,12 @@ public: // interface
   virtual std::string name () throw () 
   { return "turbulence"; }
 
-  /// Resume computation after a reduction
-  virtual void compute_resume ( Block * block,
-				CkReductionMsg * msg) throw(); 
+  /// Resume computation after the tree reduction
+  void compute_resume ( Block * block) throw(); 
 
 private: // methods
 
-  void compute_resume_ (Block * block, CkReductionMsg * msg) throw();
+  void compute_resume_ (Block * block, const double * g) throw();
 
 private: // attributes
 
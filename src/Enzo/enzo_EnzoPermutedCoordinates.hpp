@@ -99,4 +99,62 @@ private: // attributes
   int i_axis_;
 };
 
+//----------------------------------------------------------------------
+
+// EnzoSweepSpec is the compile-time analogue of EnzoPermutedCoordinates. It is
+// used to instantiate kernels that perform a directional sweep for a known
+// axis i. With this information the compiler can hoist the offset between
+// neighboring cells along axis i out of the loops (it's a compile-time
+// constant of 1 when axis i is the x-axis).
+//
+// The appropriate instantiation should be selected once (e.g. per block) with
+// enzo_sweep_dispatch rather than inside of loops.
+
+template <int IAxis>
+struct EnzoSweepSpec
+{
+  static_assert(IAxis >= 0 && IAxis < 3, "IAxis must be 0, 1, or 2");
+
+  /// axis id (0 <--> x, 1 <--> y, 2 <--> z) of the Cartesian axis that lies
+  /// along axis i
+  static constexpr int i_axis = IAxis;
+
+  /// Returns the runtime analogue of this type
+  static EnzoPermutedCoordinates coord()
+  { return EnzoPermutedCoordinates(IAxis); }
+
+  /// Returns the separation between the addresses of neighboring elements of
+  /// array along axis i. The array must have at least 2 elements along axis i.
+  static intp i_offset(EFlt3DArray &array)
+  {
+    if (IAxis == 0) { return 1; }
+    return (&array((IAxis == 2) ? 1 : 0, (IAxis == 1) ? 1 : 0, 0) -
+            &array(0, 0, 0));
+  }
+};
+
+//----------------------------------------------------------------------
+
+/// Invokes `Kernel::template apply<EnzoSweepSpec<dim>>(args...)`
+///
+/// @param dim The axis id of the Cartesian axis that lies along axis i
+/// @param args The arguments forwarded to the kernel
+template <class Kernel, typename... Args>
+inline void enzo_sweep_dispatch(int dim, Args&&... args)
+{
+  switch (dim){
+  case 0:
+    Kernel::template apply<EnzoSweepSpec<0>>(std::forward<Args>(args)...);
+    break;
+  case 1:
+    Kernel::template apply<EnzoSweepSpec<1>>(std::forward<Args>(args)...);
+    break;
+  case 2:
+    Kernel::template apply<EnzoSweepSpec<2>>(std::forward<Args>(args)...);
+    break;
+  default:
+    ERROR1("enzo_sweep_dispatch", "dim must be 0, 1, or 2. Not %d.", dim);
+  }
+}
+
 #endif /*ENZO_ENZO_PERMUTED_COORDINATES_HPP*/
@@ -0,0 +1,1650 @@
+// See LICENSE_ENZO file for license and copyright information
+
+/// @file     enzo_EnzoPpmSolver.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Enzo] Implementation of EnzoPpmSolver
+///
+/// The helper methods correspond to the Fortran routines called by
+/// xeuler_sweep.F. Loops over i run along the pencils (with the same index
+/// ranges as the Fortran routines, shifted to be zero-based) and loops over
+/// l run across the pencils of a batch.
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  // The constants are declared with type enzo_float so that expressions are
+  // evaluated with the same precision as in the Fortran routines
+  const enzo_float zero = 0.0, quarter = 0.25, half = 0.5, one = 1.0;
+  const enzo_float two = 2.0, three = 3.0, four = 4.0, six = 6.0;
+
+  /// minimum pressure, density, etc. (tiny in fortran_types.h)
+  const enzo_float ppm_tiny = 1.e-20;
+
+  /// floor of the color fields (COLOR_FLOOR in enzo_defines.hpp)
+  const enzo_float color_floor = 1.e-35;
+
+  /// density floor applied by euler.F (SmallRho in xeuler_sweep.F, which is
+  /// initialized from a single precision literal)
+  const enzo_float small_rho = 1.e-30f;
+
+  /// a constant used in eqns 1.12, 3.3 and 3.5 of Colella & Woodward 1984
+  const enzo_float ft = four/three;
+
+#ifdef CONFIG_PRECISION_SINGLE
+  /// convergence tolerance of the two-shock Riemann solver
+  const enzo_float twoshock_tolerance = 1.0e-7;
+#else
+  const enzo_float twoshock_tolerance = 1.e-14;
+#endif
+
+  /// maximum number of iterations of the two-shock Riemann solver
+  const int twoshock_numiter = 8;
+
+  //--------------------------------------------------
+
+  /// Accesses a field along a batch of pencils: (i,l) refers to cell i of
+  /// pencil l
+  struct FieldPencils_ {
+    FieldPencils_() : p(nullptr), si(0), sj(0) {}
+
+    enzo_float & operator()(int i, int l) const { return p[i*si + l*sj]; }
+
+    /// Access the cell displaced by offset elements from (i,l)
+    enzo_float & at(int i, int l, std::ptrdiff_t offset) const
+    { return p[i*si + l*sj + offset]; }
+
+    enzo_float * p;
+    std::ptrdiff_t si, sj;
+  };
+
+  /// Accesses a temporary array that stores the values of the pencils of a
+  /// batch contiguously
+  struct TmpPencils_ {
+    explicit TmpPencils_(enzo_float * p) : p(p) {}
+
+    enzo_float & operator()(int i, int l) const
+    { return p[i*EnzoPpmSolver::lane_batch + l]; }
+
+    enzo_float * p;
+  };
+
+  /// Indices of the temporary arrays. Each color field uses 3 more arrays
+  /// (see tmp_color_)
+  enum tmp_array_ {
+    tmp_p, tmp_flatten, tmp_diffcoef, tmp_steepen, tmp_d2d,
+    tmp_char1, tmp_char2, tmp_cm, tmp_c0, tmp_cp,
+    // work arrays of intvar_ (also used by compute_dissipation_)
+    tmp_dq, tmp_ql, tmp_qr, tmp_q6,
+    // pressure and velocity profiles (needed for the characteristic
+    // tracing of inteuler.F)
+    tmp_dp, tmp_pl, tmp_pr, tmp_p6,
+    tmp_du, tmp_ul, tmp_ur, tmp_u6,
+    // interface values averaged over the domains of dependence
+    tmp_dla, tmp_dra, tmp_dl0, tmp_dr0,
+    tmp_pla, tmp_pra, tmp_pl0, tmp_pr0,
+    tmp_ula, tmp_ura, tmp_ul0, tmp_ur0,
+    tmp_qla, tmp_qra, tmp_ql0, tmp_qr0,
+    // left and right interface states
+    tmp_dls, tmp_drs, tmp_pls, tmp_prs, tmp_uls, tmp_urs,
+    tmp_vls, tmp_vrs, tmp_wls, tmp_wrs, tmp_gels, tmp_gers,
+    // Riemann solution
+    tmp_pbar, tmp_ubar, tmp_ub,
+    // fluxes (the gas energy source term is stored in tmp_ges)
+    tmp_df, tmp_ef, tmp_uf, tmp_vf, tmp_wf, tmp_gef, tmp_ges,
+    // old values of the transverse velocity along the last pencil of the
+    // previous batch (only lane 0 is used)
+    tmp_prev_lane,
+    num_fixed_tmp_
+  };
+
+  /// Returns the index of a temporary array associated with color field n.
+  /// kind is 0, 1 or 2 for the left state, the right state or the flux
+  inline int tmp_color_(int n, int kind) { return num_fixed_tmp_ + 3*n + kind; }
+
+  //--------------------------------------------------
+
+  /// Quantities used by intvar_
+  struct IntvarParams_ {
+    int i1, i2, num_lanes;
+    enzo_float c1, c2, c3, c4, c5, c6;
+    bool flatten_on;
+    TmpPencils_ steepen, flatten, char1, char2, c0;
+  };
+
+  /// Computes the left and right states at the cell interfaces
+  /// [i1,i2+1] averaged over the domains of dependence of the
+  /// characteristics (qla, qra) and of the Lagrangean cell faces (ql0, qr0).
+  /// On return dq, ql, qr and q6 hold the interpolation profile. This is a
+  /// port of intvar.F.
+  template <class Q>
+  void intvar_(const Q &q, const IntvarParams_ &ip, bool steepen_on,
+               TmpPencils_ dq, TmpPencils_ ql, TmpPencils_ qr, TmpPencils_ q6,
+               TmpPencils_ qla, TmpPencils_ qra,
+               TmpPencils_ ql0, TmpPencils_ qr0)
+  {
+    const int i1 = ip.i1, i2 = ip.i2, nl = ip.num_lanes;
+
+    // Compute average linear slopes (eqn 1.7) and monotonize (eqn 1.8),
+    // using van Leer slopes
+    for (int i = i1-2; i <= i2+2; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float qplus = q(i+1,l) - q(i,l);
+        const enzo_float qmnus = q(i,l) - q(i-1,l);
+        if (qplus*qmnus > zero) {
+          const enzo_float qcent = ip.c1*qplus + ip.c2*qmnus;
+          const enzo_float qvanl = two*qplus*qmnus/(qmnus + qplus);
+          const enzo_float temp1 = std::min(std::min(std::fabs(qcent),
+                                                     std::fabs(qvanl)),
+                                            std::min(two*std::fabs(qmnus),
+                                                     two*std::fabs(qplus)));
+          dq(i,l) = temp1*std::copysign(one, qcent);
+        } else {
+          dq(i,l) = zero;
+        }
+      }
+    }
+
+    // Construct left and right values (eqn 1.6)
+    for (int i = i1-1; i <= i2+2; i++) {
+      for (int l = 0; l < nl; l++) {
+        ql(i,l) = ip.c3*q(i-1,l) + ip.c4*q(i,l) +
+                  ip.c5*dq(i-1,l) + ip.c6*dq(i,l);
+        qr(i-1,l) = ql(i,l);
+      }
+    }
+
+    // Steepen if asked for (use precomputed steepening parameter)
+    if (steepen_on) {
+      for (int i = i1-1; i <= i2+1; i++) {
+        for (int l = 0; l < nl; l++) {
+          const enzo_float s = ip.steepen(i,l);
+          ql(i,l) = (one - s)*ql(i,l) + s*(q(i-1,l) + half*dq(i-1,l));
+          qr(i,l) = (one - s)*qr(i,l) + s*(q(i+1,l) - half*dq(i+1,l));
+        }
+      }
+    }
+
+    // Monotonize again (eqn 1.10)
+    for (int i = i1-1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float qc = q(i,l);
+        const enzo_float temp1 = (qr(i,l) - qc)*(qc - ql(i,l));
+        const enzo_float temp2 = qr(i,l) - ql(i,l);
+        const enzo_float temp3 = six*(qc - half*(qr(i,l) + ql(i,l)));
+        if (temp1 <= zero) {
+          ql(i,l) = qc;
+          qr(i,l) = qc;
+        }
+        const enzo_float temp22 = temp2*temp2;
+        const enzo_float temp23 = temp2*temp3;
+        if (temp22 <  temp23) ql(i,l) = three*qc - two*qr(i,l);
+        if (temp22 < -temp23) qr(i,l) = three*qc - two*ql(i,l);
+      }
+    }
+
+    // If requested, flatten slopes with the flatteners from calcdiss (4.1)
+    if (ip.flatten_on) {
+      for (int i = i1-1; i <= i2+1; i++) {
+        for (int l = 0; l < nl; l++) {
+          const enzo_float f = ip.flatten(i,l);
+          ql(i,l) = q(i,l)*f + ql(i,l)*(one - f);
+          qr(i,l) = q(i,l)*f + qr(i,l)*(one - f);
+        }
+      }
+    }
+
+    // Ensure that the L/R values lie between neighboring cell-centered
+    // values. Then construct the parabola coefficients (eqn 1.5)
+    for (int i = i1-1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float qm = q(i-1,l), qc = q(i,l), qp = q(i+1,l);
+        enzo_float left = ql(i,l), right = qr(i,l);
+        left  = std::max(std::min(qc, qm), left);
+        left  = std::min(std::max(qc, qm), left);
+        right = std::max(std::min(qc, qp), right);
+        right = std::min(std::max(qc, qp), right);
+        ql(i,l) = left;
+        qr(i,l) = right;
+        q6(i,l) = six*(qc - half*(left + right));
+        dq(i,l) = right - left;
+      }
+    }
+
+    // Now construct left and right interface values (eqn 1.12 and 3.3)
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float ch1 = ip.char1(i-1,l), ch2 = ip.char2(i,l);
+        const enzo_float cl0 = ip.c0(i-1,l),    cr0 = ip.c0(i,l);
+        qla(i,l) = qr(i-1,l) - ch1*(dq(i-1,l) - (one - ft*ch1)*q6(i-1,l));
+        qra(i,l) = ql(i,l)   + ch2*(dq(i,l)   + (one - ft*ch2)*q6(i,l));
+        ql0(i,l) = qr(i-1,l) - cl0*(dq(i-1,l) - (one - ft*cl0)*q6(i-1,l));
+        qr0(i,l) = ql(i,l)   - cr0*(dq(i,l)   + (one + ft*cr0)*q6(i,l));
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Describes a batch of neighboring pencils along the sweep axis
+struct EnzoPpmSolver::Batch_ {
+
+  /// number of pencils in the batch
+  int num_lanes;
+
+  /// first and last active cells along the pencils
+  int i1, i2;
+
+  /// timestep and cell width along the sweep axis
+  enzo_float dt, dx;
+
+  /// density, total energy, internal energy, velocity components (u is
+  /// along the sweep axis, followed by v and w, the components along the
+  /// next two axes in cyclic order) and acceleration along the sweep axis
+  FieldPencils_ d, e, ge, u, v, w, gr;
+
+  std::vector<FieldPencils_> colors;
+
+  /// whether the acceleration is used
+  bool gravity;
+
+  /// Quantities used by the diffusion coefficient: v and w (differenced
+  /// along their own axes) are accessed through v and w with the offsets
+  /// stride_v and stride_w. use_v[l] and use_w[l] indicate whether the
+  /// corresponding terms contribute for pencil l
+  std::ptrdiff_t stride_v, stride_w;
+  enzo_float dy, dz;
+  bool use_v[lane_batch], use_w[lane_batch];
+
+  /// Whether v (rather than w) is the velocity component along the axis
+  /// across the pencils of a batch. Like in the Fortran routines, the
+  /// diffusion coefficient uses the values of that component from before
+  /// the current plane was updated (the values of the last pencil of the
+  /// previous batch are saved in tmp_prev_lane)
+  bool lane_is_v;
+
+  /// position of the first pencil of the batch along the lane axis and
+  /// position of the plane along the plane axis
+  int first_lane, plane;
+};
+
+//----------------------------------------------------------------------
+
+EnzoPpmSolver::EnzoPpmSolver(const Parameters &parameters, int rank,
+                             const int ghost_depth[3]) throw()
+  : parameters_(parameters),
+    rank_(rank),
+    scratch_(),
+    reference_flatten_(),
+    negative_cells_(nullptr),
+    num_chunks_(cello::num_threads())
+{
+  ASSERT1("EnzoPpmSolver::EnzoPpmSolver",
+          "PPM flattening type %d is not supported",
+          parameters.flattening,
+          0 <= parameters.flattening && parameters.flattening <= 3);
+  ASSERT1("EnzoPpmSolver::EnzoPpmSolver",
+          "PPM diffusion type %d is not supported (only 0 and 1 are)",
+          parameters.diffusion,
+          parameters.diffusion == 0 || parameters.diffusion == 1);
+  for (int i = 0; i < 3; i++) { ghost_depth_[i] = ghost_depth[i]; }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::solve
+(Fields &fields, enzo_float dt, const enzo_float cell_width[3], int cycle,
+ const FluxStore (*flux_store)[2][num_flux_quantities])
+{
+  const int m[3] = {fields.density.shape(2), fields.density.shape(1),
+                    fields.density.shape(0)};
+
+  // Loop over directions, using a Strang-type splitting
+  const int ixyz = cycle % rank_;
+  for (int n = ixyz; n < ixyz + rank_; n++) {
+    const int axis = n % rank_;
+    if (m[axis] - 2*ghost_depth_[axis] > 1) {
+      sweep(axis, fields, dt, cell_width, flux_store);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Returns a pointer to the first element of array after checking that
+  /// its shape and layout match the specified shape and strides
+  enzo_float * pointer_to_field_(EFlt3DArray &array, const int m[3],
+                                 const std::ptrdiff_t stride[3])
+  {
+    ASSERT("EnzoPpmSolver::sweep", "The arrays must all have the same shape",
+           (array.shape(2) == m[0] && array.shape(1) == m[1] &&
+            array.shape(0) == m[2]));
+    enzo_float * p = &array(0,0,0);
+    ASSERT("EnzoPpmSolver::sweep", "The arrays must all have the same layout",
+           ((m[0] == 1 || &array(0,0,1) - p == stride[0]) &&
+            (m[1] == 1 || &array(0,1,0) - p == stride[1]) &&
+            (m[2] == 1 || &array(1,0,0) - p == stride[2])));
+    return p;
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::sweep
+(int axis, Fields &fields, enzo_float dt, const enzo_float cell_width[3],
+ const FluxStore (*flux_store)[2][num_flux_quantities])
+{
+  EFlt3DArray &density = fields.density;
+  const int m[3] = {density.shape(2), density.shape(1), density.shape(0)};
+  const int * g = ghost_depth_;
+
+  ASSERT2("EnzoPpmSolver::sweep",
+          "The ghost depth along axis %d must be at least 3 (it is %d)",
+          axis, g[axis], g[axis] >= 3);
+
+  const int axis_v = (axis + 1) % 3;
+  const int axis_w = (axis + 2) % 3;
+
+  // the pencils of a batch neighbor each other along lane_axis, and the
+  // planes of pencils are stacked along plane_axis. The Fortran sweeps
+  // update 2D slices spanning the sweep axis and axis_v, one after the
+  // other along axis_w. Batching along axis_v updates the pencils in the
+  // same order, which matters for the diffusion coefficient (it reads the
+  // transverse velocities of neighboring pencils that may already have
+  // been updated). Without diffusion the order doesn't matter, so the y
+  // sweep batches along x to access the fields contiguously.
+  const int lane_axis  = (axis == 1 && !parameters_.diffusion) ? 0 : axis_v;
+  const int plane_axis = 3 - axis - lane_axis;
+
+  std::ptrdiff_t stride[3];
+  stride[0] = 1;
+  stride[1] = (m[1] > 1) ? &density(0,1,0) - &density(0,0,0) : 0;
+  stride[2] = (m[2] > 1) ? &density(1,0,0) - &density(0,0,0) : 0;
+
+  const int num_colors = fields.colors.size();
+  prepare_scratch_(m[axis], num_colors);
+
+  // inteuler.F passes the flattening coefficients of the first pencil of
+  // each slice (the one at the lower edge along axis_v) to intvar.F for
+  // every pencil of the slice. The coefficients of those pencils are saved
+  // here: one pencil per plane when batching along axis_v, otherwise one
+  // pencil per lane (saved while updating the first plane).
+  if (parameters_.flattening != 0 && !parameters_.per_pencil_flattening) {
+    const int num_reference = (lane_axis == axis_v) ? 1 : m[lane_axis];
+    reference_flatten_.resize((std::size_t)num_reference * m[axis]);
+  }
+
+  // base pointers of each field
+  enzo_float * p_d  = pointer_to_field_(density, m, stride);
+  enzo_float * p_e  = pointer_to_field_(fields.total_energy, m, stride);
+  enzo_float * p_ge = (parameters_.dual_energy) ?
+    pointer_to_field_(fields.internal_energy, m, stride) : nullptr;
+  enzo_float * p_u  = pointer_to_field_(fields.velocity[axis],   m, stride);
+  enzo_float * p_v  = pointer_to_field_(fields.velocity[axis_v], m, stride);
+  enzo_float * p_w  = pointer_to_field_(fields.velocity[axis_w], m, stride);
+  const bool gravity = fields.acceleration[axis].size() > 0;
+  enzo_float * p_gr = (gravity) ?
+    pointer_to_field_(fields.acceleration[axis], m, stride) : nullptr;
+  std::vector<enzo_float *> p_colors(num_colors);
+  for (int n = 0; n < num_colors; n++) {
+    p_colors[n] = pointer_to_field_(fields.colors[n], m, stride);
+  }
+
+  // Record cells with negative values (like the x,y,zeuler_sweep.F
+  // routines do when copying the fields into slices)
+  if (negative_cells_ != nullptr) {
+    enzo_float * checked[] = {p_d, p_e, p_ge};
+    for (int n = 0; n < 3; n++) {
+      if (checked[n] == nullptr) continue;
+      for (int iz = 0; iz < m[2]; iz++) {
+        for (int iy = 0; iy < m[1]; iy++) {
+          for (int ix = 0; ix < m[0]; ix++) {
+            if (checked[n][ix + iy*stride[1] + iz*stride[2]] < zero) {
+              negative_cells_->push_back({{ix, iy, iz}});
+            }
+          }
+        }
+      }
+    }
+  }
+
+  Batch_ batch_template;
+  batch_template.i1 = g[axis];
+  batch_template.i2 = m[axis] - g[axis] - 1;
+  batch_template.dt = dt;
+  batch_template.dx = cell_width[axis];
+  batch_template.gravity = gravity;
+  batch_template.colors.resize(num_colors);
+  batch_template.stride_v = stride[axis_v];
+  batch_template.stride_w = stride[axis_w];
+  batch_template.dy = cell_width[axis_v];
+  batch_template.dz = cell_width[axis_w];
+  batch_template.lane_is_v = (axis_v == lane_axis);
+
+  // active extents and index ranges transverse to the sweep
+  const int n_w = m[axis_w] - 2*g[axis_w];
+  const int lane_start  = g[lane_axis];
+  const int lane_stop   = m[lane_axis] - g[lane_axis];
+  const int plane_start = g[plane_axis];
+  const int plane_stop  = m[plane_axis] - g[plane_axis];
+
+  // Update planes [k_begin,k_end) using the temporary arrays of solver
+  auto update_planes = [&] (EnzoPpmSolver & solver, int k_begin, int k_end)
+  {
+    Batch_ batch = batch_template;
+    FieldPencils_ * pencils[] = {&batch.d, &batch.e, &batch.ge, &batch.u,
+                                 &batch.v, &batch.w, &batch.gr};
+    enzo_float * bases[] = {p_d, p_e, p_ge, p_u, p_v, p_w, p_gr};
+    const int num_pencils = sizeof(bases) / sizeof(bases[0]);
+    for (int n = 0; n < num_pencils; n++) {
+      pencils[n]->si = stride[axis];
+      pencils[n]->sj = stride[lane_axis];
+    }
+    for (int n = 0; n < num_colors; n++) {
+      batch.colors[n].si = stride[axis];
+      batch.colors[n].sj = stride[lane_axis];
+    }
+
+    for (int k = k_begin; k < k_end; k++) {
+      for (int j0 = 0; j0 < m[lane_axis]; j0 += lane_batch) {
+
+        const std::ptrdiff_t offset =
+          k*stride[plane_axis] + j0*stride[lane_axis];
+        const int nl = std::min(lane_batch, m[lane_axis] - j0);
+        batch.num_lanes = nl;
+        batch.first_lane = j0;
+        batch.plane = k;
+
+        for (int n = 0; n < num_pencils; n++) {
+          pencils[n]->p =
+            (bases[n] == nullptr) ? nullptr : bases[n] + offset;
+        }
+        for (int n = 0; n < num_colors; n++) {
+          batch.colors[n].p = p_colors[n] + offset;
+        }
+
+        // positions of each pencil along the v and w axes (for diffusion)
+        for (int l = 0; l < nl; l++) {
+          const int pos_v = (axis_v == lane_axis) ? j0 + l : k;
+          const int pos_w = (axis_w == lane_axis) ? j0 + l : k;
+          batch.use_v[l] = (m[axis_v] > 1 &&
+                            0 < pos_v && pos_v < m[axis_v] - 1);
+          batch.use_w[l] = (n_w > 1 &&
+                            0 < pos_w && pos_w < m[axis_w] - 1);
+        }
+
+        solver.compute_batch_(batch, num_colors);
+
+        // Save the fluxes through the faces of the active region
+        if (flux_store == nullptr ||
+            k < plane_start || plane_stop <= k) continue;
+
+        for (int face = 0; face < 2; face++) {
+          const int i_face = (face == 0) ? batch.i1 : batch.i2 + 1;
+          for (int q = 0; q < num_flux_quantities; q++) {
+            const FluxStore & store = flux_store[axis][face][q];
+            if (store.values == nullptr) continue;
+
+            int tmp_index = -1;
+            if (q == flux_density) {
+              tmp_index = tmp_df;
+            } else if (q == flux_total_energy) {
+              tmp_index = tmp_ef;
+            } else if (q == flux_internal_energy) {
+              if (parameters_.dual_energy) tmp_index = tmp_gef;
+            } else {
+              // fluxes of the transverse velocities are only saved when the
+              // problem extends along the velocity's axis
+              const int component = q - flux_velocity_x;
+              const int n_component = m[component] - 2*g[component];
+              if (component == axis) {
+                tmp_index = tmp_uf;
+              } else if (n_component > 1) {
+                tmp_index = (component == axis_v) ? tmp_vf : tmp_wf;
+              }
+            }
+            if (tmp_index < 0) continue;
+
+            TmpPencils_ flux(solver.scratch_[tmp_index]);
+            for (int l = 0; l < nl; l++) {
+              const int j = j0 + l;
+              if (j < lane_start || lane_stop <= j) continue;
+              store.values[(j - lane_start)*store.stride[lane_axis] +
+                           (k - plane_start)*store.stride[plane_axis]] =
+                flux(i_face,l);
+            }
+          }
+        }
+      }
+    }
+  };
+
+  // The planes are divided into chunks that are updated concurrently
+  // (see cello::parallel_for_range()), each chunk with its own copy of
+  // the temporary arrays. With diffusion, a plane reads the transverse
+  // velocity of its neighboring planes, and the results depend on the
+  // order that the planes are updated in, so the planes are updated
+  // serially. The reference flattening coefficients saved by the first
+  // plane (when batching along the other axis) are used by all planes,
+  // so that plane is updated before the others.
+  const int num_planes = m[plane_axis];
+  const bool serial = (num_chunks_ <= 1 ||
+                       (parameters_.diffusion && n_w > 1));
+
+  if (serial) {
+    update_planes(*this, 0, num_planes);
+  } else {
+    const bool first_plane_reference =
+      (parameters_.flattening != 0 && !parameters_.per_pencil_flattening &&
+       lane_axis != axis_v);
+    const int k_start = (first_plane_reference) ? 1 : 0;
+    if (first_plane_reference) update_planes(*this, 0, 1);
+    cello::parallel_for_range
+      (k_start, num_planes,
+       [&] (int k_begin, int k_end)
+       {
+         EnzoPpmSolver chunk_solver(*this);
+         chunk_solver.negative_cells_ = nullptr;
+         update_planes(chunk_solver, k_begin, k_end);
+       },
+       num_chunks_);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::prepare_scratch_(int length, int num_colors) throw()
+{
+  const int num_arrays = tmp_color_(num_colors, 0);
+  const std::size_t size = (std::size_t)num_arrays * length * lane_batch;
+  if (scratch_.data.size() < size) scratch_.data.resize(size);
+  scratch_.length = length;
+  scratch_.num_arrays = num_arrays;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::compute_batch_(const Batch_ &batch, int num_colors)
+{
+  // Compute the pressure on the pencils
+  compute_pressure_(batch);
+
+  // If requested, compute diffusion and slope flattening coefficients
+  if (parameters_.diffusion || parameters_.flattening != 0) {
+    compute_dissipation_(batch);
+  }
+
+  // Like the Fortran routines, flatten every pencil of a slice with the
+  // coefficients of the slice's first pencil (unless told otherwise)
+  if (parameters_.flattening != 0 && !parameters_.per_pencil_flattening) {
+    share_reference_flatten_(batch);
+  }
+
+  // Save the transverse velocity that the next batch's diffusion
+  // coefficient needs, before it is updated
+  if (parameters_.diffusion) {
+    const FieldPencils_ &lane_velocity = (batch.lane_is_v) ? batch.v : batch.w;
+    TmpPencils_ prev_lane(scratch_[tmp_prev_lane]);
+    const int l = batch.num_lanes - 1;
+    for (int i = batch.i1-1; i <= batch.i2+1; i++) {
+      prev_lane(i,0) = lane_velocity(i,l);
+    }
+  }
+
+  // Compute Eulerian left and right states at zone edges via interpolation
+  compute_interface_states_(batch, num_colors);
+
+  // Compute (Lagrangian part of the) Riemann problem at each zone boundary
+  solve_riemann_(batch);
+
+  // Compute the Eulerian fluxes
+  compute_fluxes_(batch, num_colors);
+
+  // Update the zone-centered quantities
+  update_cells_(batch, num_colors);
+
+  // If necessary, recompute the pressure to correctly set ge and e
+  if (parameters_.dual_energy) compute_pressure_(batch);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::share_reference_flatten_(const Batch_ &batch)
+{
+  const int nl = batch.num_lanes;
+  const int lo = batch.i1 - 1;
+  const int hi = batch.i2 + 1;
+  const int length = scratch_.length;
+  TmpPencils_ flatten(scratch_[tmp_flatten]);
+  enzo_float * reference = reference_flatten_.data();
+
+  if (batch.lane_is_v) {
+    // the first pencil of the slice is the first lane of the plane's first
+    // batch
+    if (batch.first_lane == 0) {
+      for (int i = lo; i <= hi; i++) { reference[i] = flatten(i,0); }
+    }
+    for (int i = lo; i <= hi; i++) {
+      for (int l = 0; l < nl; l++) { flatten(i,l) = reference[i]; }
+    }
+  } else {
+    // the first pencil of the slice containing lane l lies in the first
+    // plane
+    for (int l = 0; l < nl; l++) {
+      enzo_float * ref = reference + (std::size_t)(batch.first_lane + l)*length;
+      if (batch.plane == 0) {
+        for (int i = lo; i <= hi; i++) { ref[i] = flatten(i,l); }
+      } else {
+        for (int i = lo; i <= hi; i++) { flatten(i,l) = ref[i]; }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::compute_pressure_(const Batch_ &batch)
+{
+  // port of pgas2d.F and pgas2d_dual.F
+  const int nl = batch.num_lanes;
+  const int lo = batch.i1 - 3;
+  const int hi = batch.i2 + 3;
+  const enzo_float gamma = parameters_.gamma;
+  const enzo_float pmin = ppm_tiny;
+  const FieldPencils_ &d = batch.d, &e = batch.e, &ge = batch.ge;
+  const FieldPencils_ &u = batch.u, &v = batch.v, &w = batch.w;
+  TmpPencils_ p(scratch_[tmp_p]);
+
+  if (!parameters_.dual_energy) {
+    for (int i = lo; i <= hi; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float pressure =
+          (gamma - one)*d(i,l)*(e(i,l) - half*(u(i,l)*u(i,l) +
+                                               v(i,l)*v(i,l) +
+                                               w(i,l)*w(i,l)));
+        p(i,l) = (pressure < pmin) ? pmin : pressure;
+      }
+    }
+    return;
+  }
+
+  // The dual energy formalism modifies e (and ge) in place. The update of
+  // cell i depends on the updated value of cell i-1.
+  const enzo_float eta1 = parameters_.dual_energy_eta_1;
+  const enzo_float eta2 = parameters_.dual_energy_eta_2;
+  for (int i = lo; i <= hi; i++) {
+    const int im1 = std::max(i-1, lo);
+    const int ip1 = std::min(i+1, hi);
+    for (int l = 0; l < nl; l++) {
+      // Compute the specific energy from the total energy
+      const enzo_float ke = half*(u(i,l)*u(i,l) + v(i,l)*v(i,l) +
+                                  w(i,l)*w(i,l));
+      const enzo_float ge1 = e(i,l) - ke;
+      // Find the maximum nearby total energy (not specific)
+      const enzo_float demax = std::max(std::max(d(i,l)*e(i,l),
+                                                 d(im1,l)*e(im1,l)),
+                                        d(ip1,l)*e(ip1,l));
+      // If the ratio of the gas energy to the max nearby total energy is
+      // > eta2 then use the gas energy computed from the total energy
+      if (ge1*d(i,l)/demax > eta2) ge(i,l) = ge1;
+      // If the ratio of the specific gas energy to specific total energy
+      // is < eta1 then use the gas energy to update the specific energy
+      enzo_float ge2 = (ge1/e(i,l) > eta1) ? ge1 : ge(i,l);
+      // If pressure is below the minimum, set it to the minimum
+      ge2 = std::max(ge2, pmin/((gamma - one)*d(i,l)));
+      e(i,l) = e(i,l) - ge1 + ge2;
+      p(i,l) = (gamma - one)*d(i,l)*ge2;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::compute_dissipation_(const Batch_ &batch)
+{
+  // port of calcdiss.F (only the diffusion coefficient of type B, which is
+  // the one selected by Method:ppm:diffusion)
+  const enzo_float epsilon = 0.33,  kappa1 = 2.0,  kappa2 = 0.01;
+  const enzo_float k_param = 0.1,   omega1 = 0.75, omega2 = 10.0;
+  const enzo_float sigma1  = 0.5,   sigma2 = 1.0;
+
+  const int nl = batch.num_lanes;
+  const int i1 = batch.i1, i2 = batch.i2;
+  const enzo_float gamma = parameters_.gamma;
+  const int flattening = parameters_.flattening;
+  const FieldPencils_ &d = batch.d, &e = batch.e, &u = batch.u;
+  TmpPencils_ p(scratch_[tmp_p]);
+  TmpPencils_ flatten(scratch_[tmp_flatten]);
+  TmpPencils_ diffcoef(scratch_[tmp_diffcoef]);
+  // the work arrays of intvar_ are free at this point
+  TmpPencils_ wflag(scratch_[tmp_dq]);
+  TmpPencils_ flattemp(scratch_[tmp_ql]);
+  TmpPencils_ di(scratch_[tmp_qr]);
+
+  // All (well, almost all) routines below need this quantity (CW84, eq. a1)
+  for (int i = i1-2; i <= i2+2; i++) {
+    for (int l = 0; l < nl; l++) {
+      const enzo_float qb = std::fabs(p(i+1,l) - p(i-1,l))
+        / std::min(p(i+1,l), p(i-1,l));
+      wflag(i,l) = (qb > epsilon && u(i-1,l) > u(i+1,l)) ? one : zero;
+    }
+  }
+
+  // (B) Compute diffusion coefficient
+  if (parameters_.diffusion) {
+    const enzo_float dx = batch.dx;
+    const enzo_float qv = quarter*(dx + dx) / (half*(batch.dy + batch.dy)
+                                              + batch.dy);
+    const enzo_float qw = quarter*(dx + dx) / (half*(batch.dz + batch.dz)
+                                              + batch.dz);
+    const std::ptrdiff_t sv = batch.stride_v, sw = batch.stride_w;
+    const FieldPencils_ &v = batch.v, &w = batch.w;
+    TmpPencils_ prev_lane(scratch_[tmp_prev_lane]);
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        // the neighbors of pencil 0 in the previous batch were updated
+        const bool prev_v = (l == 0 &&  batch.lane_is_v);
+        const bool prev_w = (l == 0 && !batch.lane_is_v);
+        diffcoef(i,l) = u(i-1,l) - u(i,l);
+        if (batch.use_v[l]) {
+          const enzo_float vm = (prev_v) ?
+            prev_lane(i,0)   : v.at(i,  l,-sv);
+          const enzo_float vm1 = (prev_v) ?
+            prev_lane(i-1,0) : v.at(i-1,l,-sv);
+          const enzo_float vdiff = (vm + vm1)
+            -                      (v.at(i,l, sv) + v.at(i-1,l, sv));
+          diffcoef(i,l) = diffcoef(i,l) + qv*vdiff;
+        }
+        if (batch.use_w[l]) {
+          const enzo_float wm = (prev_w) ?
+            prev_lane(i,0)   : w.at(i,  l,-sw);
+          const enzo_float wm1 = (prev_w) ?
+            prev_lane(i-1,0) : w.at(i-1,l,-sw);
+          const enzo_float wdiff = (wm + wm1)
+            -                      (w.at(i,l, sw) + w.at(i-1,l, sw));
+          diffcoef(i,l) = diffcoef(i,l) + qw*wdiff;
+        }
+        diffcoef(i,l) = k_param*std::max(zero, diffcoef(i,l));
+      }
+    }
+  }
+
+  if (flattening == 0) return;
+
+  // (E) Construct flattening parameter (eqns A1 and A2)
+  if (flattening == 1) {
+    for (int i = i1-1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        enzo_float qa;
+        if (std::fabs(p(i+2,l) - p(i-2,l)) / std::min(p(i+2,l), p(i-2,l))
+            < epsilon) {
+          qa = one;
+        } else {
+          qa = (p(i+1,l) - p(i-1,l)) / (p(i+2,l) - p(i-2,l));
+        }
+        const enzo_float temp = std::min(one, (qa - omega1)*omega2*wflag(i,l));
+        flattemp(i,l) = std::max(zero, temp);
+      }
+    }
+  } else {
+    for (int i = i1-3; i <= i2+3; i++) {
+      for (int l = 0; l < nl; l++) { di(i,l) = one/d(i,l); }
+    }
+  }
+
+  // (F) Construct second type flattening parameter (eq. A4-A6)
+  if (flattening == 2) {
+    for (int i = i1-1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        const int is = i + (int)std::copysign(two, p(i+1,l) - p(i-1,l));
+        const enzo_float omega = std::max
+          (zero, omega1*(omega2 - (p(i+1,l) - p(i-1,l))
+                                / (p(i+2,l) - p(i-2,l))));
+        const enzo_float z = std::sqrt
+          ((std::max(p(i+2,l), p(i-2,l)) +
+            half*(p(i+2,l) + p(i-2,l))*(gamma - one))
+           / std::max(di(i+2,l), di(i-2,l)));
+        const enzo_float kappa_tilde =
+          (z + std::sqrt(gamma*p(is,l)*d(is,l))) / z;
+        const enzo_float kappa = std::max(zero, (kappa_tilde - kappa1)
+                                          /     (kappa_tilde + kappa2));
+        flattemp(i,l) = std::min(wflag(i,l)*omega, kappa);
+      }
+    }
+  }
+
+  // (G) Construct third type flattening parameter (eq. A7-A9)
+  if (flattening == 3) {
+    for (int i = i1-1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float dp1 = p(i+1,l) - p(i-1,l);
+        const enzo_float dp2 = p(i+2,l) - p(i-2,l);
+        const enzo_float de1 = e(i+1,l) - e(i-1,l);
+        const enzo_float de2 = e(i+2,l) - e(i-2,l);
+        const enzo_float dpp = (dp2 != zero) ? dp1/dp2 : zero;
+        const enzo_float dee = (de2 != zero) ? de1/de2 : zero;
+        const enzo_float omega_tilde = std::max(dpp, dee);
+        const int ism = i + (int)std::copysign(two, dp1); // post-shock
+        const int isp = i - (int)std::copysign(two, dp1); // upstream
+        // i+s is the zone upstream from i
+        const enzo_float s = (dp1 == zero) ? zero : -std::copysign(one, dp1);
+        // strength of a shock near zone i
+        const enzo_float sigma_tilde =
+          wflag(i,l)*std::fabs(dp2)/std::min(p(i+2,l), p(i-2,l));
+        const enzo_float sigma = std::max(zero, (sigma_tilde - sigma1)
+                                          /     (sigma_tilde + sigma2));
+        // steepness of a shock near zone i (as in Prometheus)
+        const enzo_float omega =
+          std::max(zero, omega2*(omega_tilde - omega1));
+        // estimate of the Lagrangean shock speed
+        const enzo_float z = std::sqrt
+          ((std::max(p(i+2,l), p(i-2,l)) +
+            half*(p(i+2,l) + p(i-2,l))*(gamma - one))
+           / std::max(di(i+2,l), di(i-2,l)));
+        const enzo_float ze = s*z/d(ism,l) + u(ism,l) + ppm_tiny;
+        const enzo_float cj2s = std::sqrt(gamma*p(isp,l)/d(isp,l));
+        // the wavelength of the noise
+        const enzo_float kappa_tilde =
+          std::fabs((ze - u(isp,l) + s*cj2s)/ze);
+        const enzo_float kappa = std::max(zero, (kappa_tilde - kappa1)
+                                          /     (kappa_tilde + kappa2));
+        flattemp(i,l) = std::min(std::min(kappa, wflag(i,l)*omega),
+                                 wflag(i,l)*sigma);
+      }
+    }
+  }
+
+  for (int l = 0; l < nl; l++) {
+    flattemp(i1-2,l) = flattemp(i1-1,l);
+    flattemp(i2+2,l) = flattemp(i2+1,l);
+  }
+
+  // Now, choose the maximum (eq. A2, first part; also A.10)
+  for (int i = i1-1; i <= i2+1; i++) {
+    for (int l = 0; l < nl; l++) {
+      if (p(i+1,l) - p(i-1,l) < zero) {
+        flatten(i,l) = std::max(flattemp(i,l), flattemp(i+1,l));
+      } else {
+        flatten(i,l) = std::max(flattemp(i,l), flattemp(i-1,l));
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::compute_interface_states_(const Batch_ &batch,
+                                              int num_colors)
+{
+  // port of inteuler.F (without conservative or positive reconstruction)
+  const int nl = batch.num_lanes;
+  const int i1 = batch.i1, i2 = batch.i2;
+  const enzo_float gamma = parameters_.gamma;
+  const enzo_float dt = batch.dt;
+  const enzo_float dx = batch.dx;
+  const bool dual = parameters_.dual_energy;
+  const FieldPencils_ &d = batch.d, &u = batch.u, &gr = batch.gr;
+  TmpPencils_ p(scratch_[tmp_p]);
+  TmpPencils_ steepen(scratch_[tmp_steepen]), d2d(scratch_[tmp_d2d]);
+  TmpPencils_ char1(scratch_[tmp_char1]), char2(scratch_[tmp_char2]);
+  TmpPencils_ cm(scratch_[tmp_cm]), c0(scratch_[tmp_c0]), cp(scratch_[tmp_cp]);
+
+  // Compute coefficients used in interpolation formulae (from eq. 1.6).
+  // The cell widths are uniform, so the coefficients are the same for
+  // every cell
+  IntvarParams_ ip = {i1, i2, nl, 0, 0, 0, 0, 0, 0,
+                      parameters_.flattening != 0,
+                      steepen, TmpPencils_(scratch_[tmp_flatten]),
+                      char1, char2, c0};
+  enzo_float qa = dx/(dx + dx + dx);
+  ip.c1 = qa*(two*dx + dx)/(dx + dx);
+  ip.c2 = qa*(two*dx + dx)/(dx + dx);
+
+  qa = dx + dx + dx + dx;
+  enzo_float qb = dx/(dx + dx);
+  const enzo_float qc = (dx + dx)/(two*dx + dx);
+  const enzo_float qd = (dx + dx)/(two*dx + dx);
+  qb = qb + two*dx*qb/qa*(qc - qd);
+  ip.c3 = one - qb;
+  ip.c4 = qb;
+  ip.c5 =  dx/qa*qd;
+  ip.c6 = -dx/qa*qc;
+  const enzo_float dx2i = half/dx;
+
+  // Precompute steepening coefficients if needed (eqns 1.14-1.17, plus 3.2)
+  if (parameters_.steepening) {
+    const enzo_float p01 = 0.01, p05 = 0.05, p1 = 0.1, twenty = 20.0;
+    const enzo_float qa3 = dx + dx + dx;
+    const enzo_float dxb = half*(dx + dx);
+    for (int i = i1-2; i <= i2+2; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float t = (d(i+1,l) - d(i,l))/(dx + dx);
+        d2d(i,l) = (t - (d(i,l) - d(i-1,l))/(dx + dx))/qa3;
+      }
+    }
+    for (int i = i1-1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float qc1 = std::fabs(d(i+1,l) - d(i-1,l))
+          - p01*std::min(std::fabs(d(i+1,l)), std::fabs(d(i-1,l)));
+        enzo_float s1 = (d2d(i-1,l) - d2d(i+1,l))*(dxb*dxb*dxb + dxb*dxb*dxb)
+          / ((dxb + dxb)*(d(i+1,l) - d(i-1,l) + ppm_tiny));
+        if (d2d(i+1,l)*d2d(i-1,l) > zero) s1 = zero;
+        if (qc1 <= zero) s1 = zero;
+        const enzo_float s2 = std::max(zero, std::min(twenty*(s1 - p05), one));
+        const enzo_float qa1 = std::fabs(d(i+1,l) - d(i-1,l))
+          / std::min(d(i+1,l), d(i-1,l));
+        const enzo_float qb1 = std::fabs(p(i+1,l) - p(i-1,l))
+          / std::min(p(i+1,l), p(i-1,l));
+        steepen(i,l) = (gamma*p1*qa1 >= qb1) ? s2 : zero;
+      }
+    }
+  }
+
+  // Precompute left and right characteristic distances
+  for (int i = i1-2; i <= i2+2; i++) {
+    for (int l = 0; l < nl; l++) {
+      const enzo_float cs = (parameters_.pressure_free) ?
+        ppm_tiny : std::sqrt(gamma*p(i,l)/d(i,l));
+      char1(i,l) = std::max(zero,  dt*(u(i,l) + cs))*dx2i;
+      char2(i,l) = std::max(zero, -(dt*(u(i,l) - cs)))*dx2i;
+      cm(i,l) = dt*(u(i,l) - cs)*dx2i;
+      c0(i,l) = dt*(u(i,l)     )*dx2i;
+      cp(i,l) = dt*(u(i,l) + cs)*dx2i;
+    }
+  }
+
+  // Compute left and right states for each variable (steepening, if
+  // requested, is only applied to density)
+  TmpPencils_ dq(scratch_[tmp_dq]), ql(scratch_[tmp_ql]);
+  TmpPencils_ qr(scratch_[tmp_qr]), q6(scratch_[tmp_q6]);
+  TmpPencils_ dla(scratch_[tmp_dla]), dra(scratch_[tmp_dra]);
+  TmpPencils_ dl0(scratch_[tmp_dl0]), dr0(scratch_[tmp_dr0]);
+  TmpPencils_ dp(scratch_[tmp_dp]), pl(scratch_[tmp_pl]);
+  TmpPencils_ pr(scratch_[tmp_pr]), p6(scratch_[tmp_p6]);
+  TmpPencils_ pla(scratch_[tmp_pla]), pra(scratch_[tmp_pra]);
+  TmpPencils_ pl0(scratch_[tmp_pl0]), pr0(scratch_[tmp_pr0]);
+  TmpPencils_ du(scratch_[tmp_du]), ul(scratch_[tmp_ul]);
+  TmpPencils_ ur(scratch_[tmp_ur]), u6(scratch_[tmp_u6]);
+  TmpPencils_ ula(scratch_[tmp_ula]), ura(scratch_[tmp_ura]);
+  TmpPencils_ ul0(scratch_[tmp_ul0]), ur0(scratch_[tmp_ur0]);
+  TmpPencils_ qla(scratch_[tmp_qla]), qra(scratch_[tmp_qra]);
+  TmpPencils_ ql0(scratch_[tmp_ql0]), qr0(scratch_[tmp_qr0]);
+
+  intvar_(d, ip, parameters_.steepening, dq, ql, qr, q6, dla, dra, dl0, dr0);
+  intvar_(p, ip, false, dp, pl, pr, p6, pla, pra, pl0, pr0);
+  intvar_(u, ip, false, du, ul, ur, u6, ula, ura, ul0, ur0);
+
+  TmpPencils_ dls(scratch_[tmp_dls]), drs(scratch_[tmp_drs]);
+  TmpPencils_ pls(scratch_[tmp_pls]), prs(scratch_[tmp_prs]);
+  TmpPencils_ uls(scratch_[tmp_uls]), urs(scratch_[tmp_urs]);
+
+  // Correct the initial guess from the linearized gas equations
+  for (int i = i1; i <= i2+1; i++) {
+    for (int l = 0; l < nl; l++) {
+      // First, compute average over characteristic domain of dependence
+      // (3.5)
+      const enzo_float cml = cm(i-1,l), cmr = cm(i,l);
+      const enzo_float cpl = cp(i-1,l), cpr = cp(i,l);
+      const enzo_float plm = pr(i-1,l)
+        - cml*(dp(i-1,l) - (one - ft*cml)*p6(i-1,l));
+      const enzo_float prm = pl(i,l)
+        - cmr*(dp(i,l)   + (one + ft*cmr)*p6(i,l));
+      const enzo_float plp = pr(i-1,l)
+        - cpl*(dp(i-1,l) - (one - ft*cpl)*p6(i-1,l));
+      const enzo_float prp = pl(i,l)
+        - cpr*(dp(i,l)   + (one + ft*cpr)*p6(i,l));
+
+      const enzo_float ulm = ur(i-1,l)
+        - cml*(du(i-1,l) - (one - ft*cml)*u6(i-1,l));
+      const enzo_float urm = ul(i,l)
+        - cmr*(du(i,l)   + (one + ft*cmr)*u6(i,l));
+      const enzo_float ulp = ur(i-1,l)
+        - cpl*(du(i-1,l) - (one - ft*cpl)*u6(i-1,l));
+      const enzo_float urp = ul(i,l)
+        - cpr*(du(i,l)   + (one + ft*cpr)*u6(i,l));
+
+      // Compute correction terms (3.7)
+      const enzo_float cla = std::sqrt(std::max(gamma*pla(i,l)*dla(i,l),
+                                                zero));
+      const enzo_float cra = std::sqrt(std::max(gamma*pra(i,l)*dra(i,l),
+                                                zero));
+
+      // a) left side
+      enzo_float f1 = one/cla;
+      enzo_float betalp = (ula(i,l) - ulp) + (pla(i,l) - plp)*f1;
+      enzo_float betalm = (ula(i,l) - ulm) - (pla(i,l) - plm)*f1;
+      enzo_float betal0 = (pla(i,l) - pl0(i,l))*(f1*f1) + one/dla(i,l)
+        - one/dl0(i,l);
+
+      // b) right side
+      f1 = one/cra;
+      enzo_float betarp = (ura(i,l) - urp) + (pra(i,l) - prp)*f1;
+      enzo_float betarm = (ura(i,l) - urm) - (pra(i,l) - prm)*f1;
+      enzo_float betar0 = (pra(i,l) - pr0(i,l))*(f1*f1) + one/dra(i,l)
+        - one/dr0(i,l);
+
+      // Add gravity component
+      if (batch.gravity) {
+        const enzo_float g = quarter*dt*(gr(i-1,l) + gr(i,l));
+        betalp = betalp - g;
+        betalm = betalm - g;
+        betarp = betarp - g;
+        betarm = betarm - g;
+      }
+
+      f1 = half/cla;
+      betalp = -(betalp*f1);
+      betalm = betalm*f1;
+      if (cpl <= zero)       betalp = zero;
+      if (cml <= zero)       betalm = zero;
+      if (c0(i-1,l) <= zero) betal0 = zero;
+
+      f1 = half/cra;
+      betarp = -(betarp*f1);
+      betarm = betarm*f1;
+      if (cpr >= zero)     betarp = zero;
+      if (cmr >= zero)     betarm = zero;
+      if (c0(i,l) >= zero) betar0 = zero;
+
+      // Finally, combine to create corrected left/right states (eq. 3.6)
+      pls(i,l) = pla(i,l) + (betalp + betalm)*(cla*cla);
+      prs(i,l) = pra(i,l) + (betarp + betarm)*(cra*cra);
+
+      uls(i,l) = ula(i,l) + (betalp - betalm)*cla;
+      urs(i,l) = ura(i,l) + (betarp - betarm)*cra;
+
+      dls(i,l) = one/(one/dla(i,l) - (betal0 + betalp + betalm));
+      drs(i,l) = one/(one/dra(i,l) - (betar0 + betarp + betarm));
+    }
+  }
+
+  // Take the appropriate state from the advected variables
+  const FieldPencils_ * advected[] = {&batch.v, &batch.w, &batch.ge};
+  const int advected_left[]  = {tmp_vls, tmp_wls, tmp_gels};
+  const int advected_right[] = {tmp_vrs, tmp_wrs, tmp_gers};
+  const int num_advected = (dual) ? 3 : 2;
+  for (int n = 0; n < num_advected; n++) {
+    intvar_(*advected[n], ip, false, dq, ql, qr, q6, qla, qra, ql0, qr0);
+    TmpPencils_ qls(scratch_[advected_left[n]]);
+    TmpPencils_ qrs(scratch_[advected_right[n]]);
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        qls(i,l) = (u(i-1,l) <= zero) ? qla(i,l) : ql0(i,l);
+        qrs(i,l) = (u(i,l)   >= zero) ? qra(i,l) : qr0(i,l);
+      }
+    }
+  }
+
+  for (int n = 0; n < num_colors; n++) {
+    intvar_(batch.colors[n], ip, false, dq, ql, qr, q6, qla, qra, ql0, qr0);
+    TmpPencils_ colls(scratch_[tmp_color_(n,0)]);
+    TmpPencils_ colrs(scratch_[tmp_color_(n,1)]);
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        colls(i,l) = (u(i-1,l) <= zero) ?
+          qla(i,l) * dls(i,l)/dla(i,l) : ql0(i,l) * dls(i,l)/dl0(i,l);
+        colrs(i,l) = (u(i,l)   >= zero) ?
+          qra(i,l) * drs(i,l)/dra(i,l) : qr0(i,l) * drs(i,l)/dr0(i,l);
+      }
+    }
+  }
+
+  // Dual energy formalism: if sound speed squared is less than eta2*v^2
+  // then discard the corrections and use pla, ula, dla. This amounts to
+  // assuming that we are outside the shocked region but the flow is
+  // hypersonic so this should be true. This is inserted because the
+  // corrections are inaccurate for hypersonic flows.
+  if (dual) {
+    const enzo_float eta2 = parameters_.dual_energy_eta_2;
+    const enzo_float c_min = 1.0e-3, d_ratio_max = 5.0;
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        if (gamma*pla(i,l)/dla(i,l) < eta2*(ula(i,l)*ula(i,l)) ||
+            std::max(std::max(std::fabs(cm(i-1,l)), std::fabs(c0(i-1,l))),
+                     std::fabs(cp(i-1,l))) < c_min ||
+            dls(i,l)/dla(i,l) > d_ratio_max) {
+          for (int n = 0; n < num_colors; n++) {
+            TmpPencils_ colls(scratch_[tmp_color_(n,0)]);
+            colls(i,l) = colls(i,l) * dla(i,l)/dls(i,l);
+          }
+          pls(i,l) = pla(i,l);
+          uls(i,l) = ula(i,l);
+          dls(i,l) = dla(i,l);
+        }
+        if (gamma*pra(i,l)/dra(i,l) < eta2*(ura(i,l)*ura(i,l)) ||
+            std::max(std::max(std::fabs(cm(i,l)), std::fabs(c0(i,l))),
+                     std::fabs(cp(i,l))) < c_min ||
+            drs(i,l)/dra(i,l) > d_ratio_max) {
+          for (int n = 0; n < num_colors; n++) {
+            TmpPencils_ colrs(scratch_[tmp_color_(n,1)]);
+            colrs(i,l) = colrs(i,l) * dra(i,l)/drs(i,l);
+          }
+          prs(i,l) = pra(i,l);
+          urs(i,l) = ura(i,l);
+          drs(i,l) = dra(i,l);
+        }
+      }
+    }
+  }
+
+  // Enforce minimum values.
+  for (int i = i1; i <= i2+1; i++) {
+    for (int l = 0; l < nl; l++) {
+      pls(i,l) = std::max(pls(i,l), ppm_tiny);
+      prs(i,l) = std::max(prs(i,l), ppm_tiny);
+      dls(i,l) = std::max(dls(i,l), ppm_tiny);
+      drs(i,l) = std::max(drs(i,l), ppm_tiny);
+    }
+  }
+  for (int n = 0; n < num_colors; n++) {
+    TmpPencils_ colls(scratch_[tmp_color_(n,0)]);
+    TmpPencils_ colrs(scratch_[tmp_color_(n,1)]);
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        colls(i,l) = std::max(colls(i,l), color_floor);
+        colrs(i,l) = std::max(colrs(i,l), color_floor);
+      }
+    }
+  }
+
+  // If approximating pressure free conditions, then the density should be
+  // reset to the pre-corrected state.
+  if (parameters_.pressure_free) {
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) {
+        dls(i,l) = dla(i,l);
+        drs(i,l) = dra(i,l);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::solve_riemann_(const Batch_ &batch)
+{
+  // port of twoshock.F
+  const int nl = batch.num_lanes;
+  const int i1 = batch.i1, i2 = batch.i2 + 1;
+  const enzo_float gamma = parameters_.gamma;
+  const enzo_float pmin = ppm_tiny;
+  TmpPencils_ dls(scratch_[tmp_dls]), drs(scratch_[tmp_drs]);
+  TmpPencils_ pls(scratch_[tmp_pls]), prs(scratch_[tmp_prs]);
+  TmpPencils_ uls(scratch_[tmp_uls]), urs(scratch_[tmp_urs]);
+  TmpPencils_ pbar(scratch_[tmp_pbar]), ubar(scratch_[tmp_ubar]);
+
+  // If pressure free conditions are needed, set pbar to zero and ubar to the
+  // average of left and right velocity states.
+  if (parameters_.pressure_free) {
+    for (int i = i1; i <= i2; i++) {
+      for (int l = 0; l < nl; l++) {
+        pbar(i,l) = pmin;
+        ubar(i,l) = half*(uls(i,l) + urs(i,l));
+        pls(i,l)  = pmin;
+        prs(i,l)  = pmin;
+      }
+    }
+    return;
+  }
+
+  const enzo_float qa = (gamma + one)/(two*gamma);
+
+  for (int i = i1; i <= i2; i++) {
+
+    enzo_float cl[lane_batch], cr[lane_batch], ps[lane_batch];
+    enzo_float old_ps[lane_batch];
+    enzo_float ubl[lane_batch], ubr[lane_batch];
+    enzo_float dpdul[lane_batch], dpdur[lane_batch];
+    bool active[lane_batch];
+
+    // First guess at pbar and left- and right-ubar (van Leer 1979, JCP
+    // 32, 101, eq. 60)
+    for (int l = 0; l < nl; l++) {
+      cl[l] = std::sqrt(gamma*pls(i,l)*dls(i,l));
+      cr[l] = std::sqrt(gamma*prs(i,l)*drs(i,l));
+      ps[l] = (cr[l]*pls(i,l) + cl[l]*prs(i,l)
+               + cr[l]*cl[l]*(uls(i,l) - urs(i,l)))/(cr[l] + cl[l]);
+      if (ps[l] < pmin) ps[l] = pmin;
+      old_ps[l] = ps[l];
+      active[l] = true;
+    }
+
+    // Newton iterations to compute succesive guesses for pbar, l and r
+    // ubar. Iterations stop once the relative change of the pressure is
+    // below the tolerance.
+    for (int n = 2; n <= twoshock_numiter; n++) {
+      for (int l = 0; l < nl; l++) {
+        if (!active[l]) continue;
+        const enzo_float zl =
+          cl[l]*std::sqrt((one + qa*(ps[l]/pls(i,l) - one)));
+        const enzo_float zr =
+          cr[l]*std::sqrt((one + qa*(ps[l]/prs(i,l) - one)));
+        ubl[l] = uls(i,l) - (ps[l] - pls(i,l))/zl;
+        ubr[l] = urs(i,l) + (ps[l] - prs(i,l))/zr;
+
+        dpdul[l] = -(four*(zl*zl*zl)/dls(i,l)
+                     /(four*(zl*zl)/dls(i,l)
+                       - (gamma + one)*(ps[l] - pls(i,l))));
+        dpdur[l] =   four*(zr*zr*zr)/drs(i,l)
+                     /(four*(zr*zr)/drs(i,l)
+                       - (gamma + one)*(ps[l] - prs(i,l)));
+        ps[l] = ps[l] + (ubr[l] - ubl[l])*dpdur[l]*dpdul[l]
+                        /(dpdur[l] - dpdul[l]);
+        if (ps[l] < pmin) ps[l] = pmin;
+
+        const enzo_float delta_ps = ps[l] - old_ps[l];
+        old_ps[l] = ps[l];
+        if (std::fabs(delta_ps / ps[l]) < twoshock_tolerance) {
+          active[l] = false;
+        }
+      }
+    }
+
+    // Compute final values of resolved state
+    for (int l = 0; l < nl; l++) {
+      if (ps[l] < pmin) ps[l] = std::min(pls(i,l), prs(i,l));
+      pbar(i,l) = ps[l];
+      ubar(i,l) = ubl[l] + (ubr[l] - ubl[l])*dpdur[l]/(dpdur[l] - dpdul[l]);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::compute_fluxes_(const Batch_ &batch, int num_colors)
+{
+  // port of flux_twoshock.F
+  const int nl = batch.num_lanes;
+  const int i1 = batch.i1, i2 = batch.i2;
+  const enzo_float gamma = parameters_.gamma;
+  const enzo_float dt = batch.dt;
+  const bool dual = parameters_.dual_energy;
+  const bool diffusion = parameters_.diffusion;
+  const FieldPencils_ &d = batch.d, &e = batch.e, &ge = batch.ge;
+  const FieldPencils_ &u = batch.u, &v = batch.v, &w = batch.w;
+  TmpPencils_ dls(scratch_[tmp_dls]), drs(scratch_[tmp_drs]);
+  TmpPencils_ pls(scratch_[tmp_pls]), prs(scratch_[tmp_prs]);
+  TmpPencils_ uls(scratch_[tmp_uls]), urs(scratch_[tmp_urs]);
+  TmpPencils_ vls(scratch_[tmp_vls]), vrs(scratch_[tmp_vrs]);
+  TmpPencils_ wls(scratch_[tmp_wls]), wrs(scratch_[tmp_wrs]);
+  TmpPencils_ gels(scratch_[tmp_gels]), gers(scratch_[tmp_gers]);
+  TmpPencils_ pbar(scratch_[tmp_pbar]), ubar(scratch_[tmp_ubar]);
+  TmpPencils_ diffcoef(scratch_[tmp_diffcoef]);
+  TmpPencils_ ub(scratch_[tmp_ub]);
+  TmpPencils_ df(scratch_[tmp_df]), ef(scratch_[tmp_ef]);
+  TmpPencils_ uf(scratch_[tmp_uf]), vf(scratch_[tmp_vf]);
+  TmpPencils_ wf(scratch_[tmp_wf]), gef(scratch_[tmp_gef]);
+  TmpPencils_ ges(scratch_[tmp_ges]);
+
+  const enzo_float qa = (gamma + one)/(two*gamma);
+  const enzo_float qc = dt/batch.dx;
+
+  for (int i = i1; i <= i2+1; i++) {
+    for (int l = 0; l < nl; l++) {
+      // Evaluate time-averaged quantities (see Colella, Siam J Sci Stat
+      // Comput 1982, 3, 77. Appendix)
+      const enzo_float sn = std::copysign(one, -ubar(i,l));
+
+      // Collect values of interest depending on which way fluid is flowing
+      const bool left = sn < zero;
+      const enzo_float u0 = (left) ? uls(i,l) : urs(i,l);
+      const enzo_float p0 = (left) ? pls(i,l) : prs(i,l);
+      const enzo_float d0 = (left) ? dls(i,l) : drs(i,l);
+      const enzo_float c0 = std::sqrt(std::max(gamma*p0/d0, ppm_tiny));
+      const enzo_float z0 = c0*d0*std::sqrt
+        (std::max(one + qa*(pbar(i,l)/p0 - one), ppm_tiny));
+
+      // Compute equivalent bar (inside shock & rarefaction) values for
+      // density and sound speed
+      const enzo_float dbar = one/(one/d0 - (pbar(i,l) - p0)/
+                                   std::max(z0*z0, ppm_tiny));
+      const enzo_float cbar = std::sqrt(std::max(gamma*pbar(i,l)/dbar,
+                                                 ppm_tiny));
+
+      // Find lambda values for the shock and rarefaction
+      enzo_float l0, lbar;
+      if (pbar(i,l) < p0) {
+        l0   = u0*sn + c0;
+        lbar = sn*ubar(i,l) + cbar;
+      } else {
+        l0   = u0*sn + z0/d0;
+        lbar = l0;
+      }
+
+      // Compute values for inside a rarefaction fan (linear interpolation
+      // between end states, as suggested in PPM ref)
+      enzo_float frac = l0 - lbar;
+      if (frac < ppm_tiny) frac = ppm_tiny;
+      frac = (zero - lbar)/frac;
+      frac = std::min(std::max(frac, zero), one);
+      enzo_float pb = p0*frac + pbar(i,l)*(one - frac);
+      enzo_float db = d0*frac + dbar     *(one - frac);
+      enzo_float u_b = u0*frac + ubar(i,l)*(one - frac);
+
+      // Cull appropriate states depending on where eulerian position is in
+      // solution (lbar >= 0 --> inside post-shock region, l0 < 0 -->
+      // outside shock/rarefaction wave, otherwise --> inside rarefaction
+      // wave).
+      if (lbar >= zero) {
+        pb  = pbar(i,l);
+        db  = dbar;
+        u_b = ubar(i,l);
+      }
+      if (l0 < zero) {
+        pb  = p0;
+        db  = d0;
+        u_b = u0;
+      }
+
+      // Collect values of interest depending on which way fluid is flowing
+      // (uses ub instead of ubar for consistency)
+      const bool from_left = u_b > zero;
+      const enzo_float vb  = (from_left) ? vls(i,l) : vrs(i,l);
+      const enzo_float wb  = (from_left) ? wls(i,l) : wrs(i,l);
+      const enzo_float geb = (!dual) ? zero :
+        ((from_left) ? gels(i,l) : gers(i,l));
+
+      // Calculate total specific energy corresponding to this state
+      const enzo_float eb = pb/((gamma - one)*db) +
+        half*(u_b*u_b + vb*vb + wb*wb);
+
+      // Compute terms in differenced hydro equations (eq. 3.1)
+      const enzo_float upb = pb*u_b;
+      enzo_float dub  = u_b*db;
+      enzo_float duub = dub*u_b;
+      enzo_float duvb = dub*vb;
+      enzo_float duwb = dub*wb;
+      enzo_float dueb = dub*eb;
+      if (diffusion) {
+        const enzo_float dc = diffcoef(i,l);
+        duub = duub + dc*(d(i-1,l)*u(i-1,l) - d(i,l)*u(i,l));
+        duvb = duvb + dc*(d(i-1,l)*v(i-1,l) - d(i,l)*v(i,l));
+        duwb = duwb + dc*(d(i-1,l)*w(i-1,l) - d(i,l)*w(i,l));
+        dueb = dueb + dc*(d(i-1,l)*e(i-1,l) - d(i,l)*e(i,l));
+        // This update must be the last
+        dub  = dub  + dc*(d(i-1,l)          - d(i,l));
+      }
+
+      // Copy into flux pencils
+      ub(i,l) = u_b;
+      df(i,l) = qc*dub;
+      ef(i,l) = qc*(dueb + upb);
+      uf(i,l) = qc*(duub + pb);
+      vf(i,l) = qc*duvb;
+      wf(i,l) = qc*duwb;
+
+      if (dual) {
+        enzo_float dugeb = dub*geb;
+        if (diffusion) {
+          dugeb = dugeb + diffcoef(i,l)*(d(i-1,l)*ge(i-1,l) - d(i,l)*ge(i,l));
+        }
+        gef(i,l) = qc*dugeb;
+      }
+
+      for (int n = 0; n < num_colors; n++) {
+        TmpPencils_ colls(scratch_[tmp_color_(n,0)]);
+        TmpPencils_ colrs(scratch_[tmp_color_(n,1)]);
+        TmpPencils_ colf(scratch_[tmp_color_(n,2)]);
+        const enzo_float colb = (from_left) ?
+          colls(i,l) * db/dls(i,l) : colrs(i,l) * db/drs(i,l);
+        // color (rather than color*density) is conserved
+        colf(i,l) = dt*u_b*colb;
+      }
+    }
+  }
+
+  // Do the same for the gas energy if using the dual energy formalism
+  // (the source term is computed here)
+  if (dual) {
+    for (int i = i1; i <= i2; i++) {
+      for (int l = 0; l < nl; l++) {
+        const enzo_float pcent =
+          std::max((gamma - one)*ge(i,l)*d(i,l), ppm_tiny);
+        ges(i,l) = qc*pcent*(ub(i,l) - ub(i+1,l));
+      }
+    }
+  }
+
+  // Check here for negative densities and energies, and fall back to the
+  // HLL fluxes for the faces of offending cells
+  for (int l = 0; l < nl; l++) {
+    for (int i = i1; i <= i2; i++) {
+      if (d(i,l) + (df(i,l) - df(i+1,l)) <= zero || e(i,l) < zero) {
+        WARNING3("EnzoPpmSolver::compute_fluxes_",
+                 "Negative density or energy in cell %d of pencil %d "
+                 "(e = %g): falling back to the HLL Riemann solver",
+                 i, l, e(i,l));
+        compute_hll_fallback_(batch, num_colors, i, l);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::compute_hll_fallback_(const Batch_ &batch,
+                                          int num_colors, int i, int l)
+{
+  // port of flux_hll.F, for the two faces of a single cell. When called
+  // for a single cell, flux_hll.F also overwrites the gas energy source
+  // term of cell i+1 using wave speeds that it never initialized; here
+  // that term is left unchanged.
+  const enzo_float gamma = parameters_.gamma;
+  const enzo_float gamma1 = gamma - one;
+  const enzo_float gamma1i = one / gamma1;
+  const enzo_float dt = batch.dt;
+  const enzo_float qc = dt/batch.dx;
+  const bool dual = parameters_.dual_energy;
+  const bool diffusion = parameters_.diffusion;
+  const FieldPencils_ &d = batch.d, &e = batch.e, &ge = batch.ge;
+  const FieldPencils_ &u = batch.u, &v = batch.v, &w = batch.w;
+  TmpPencils_ dls(scratch_[tmp_dls]), drs(scratch_[tmp_drs]);
+  TmpPencils_ pls(scratch_[tmp_pls]), prs(scratch_[tmp_prs]);
+  TmpPencils_ uls(scratch_[tmp_uls]), urs(scratch_[tmp_urs]);
+  TmpPencils_ vls(scratch_[tmp_vls]), vrs(scratch_[tmp_vrs]);
+  TmpPencils_ wls(scratch_[tmp_wls]), wrs(scratch_[tmp_wrs]);
+  TmpPencils_ gels(scratch_[tmp_gels]), gers(scratch_[tmp_gers]);
+  TmpPencils_ diffcoef(scratch_[tmp_diffcoef]);
+  TmpPencils_ df(scratch_[tmp_df]), ef(scratch_[tmp_ef]);
+  TmpPencils_ uf(scratch_[tmp_uf]), vf(scratch_[tmp_vf]);
+  TmpPencils_ wf(scratch_[tmp_wf]), gef(scratch_[tmp_gef]);
+  TmpPencils_ ges(scratch_[tmp_ges]);
+
+  // weighted velocities of the left and right states through each face,
+  // used by the gas energy source term
+  enzo_float ges_left[2], ges_right[2];
+
+  for (int f = i; f <= i+1; f++) {
+    // Compute the Roe-averaged data from the left and right states
+    const enzo_float sqrtdl = std::sqrt(dls(f,l));
+    const enzo_float sqrtdr = std::sqrt(drs(f,l));
+    const enzo_float isdlpdr = one / (sqrtdl + sqrtdr);
+    const enzo_float vroe1 = (sqrtdl * uls(f,l) + sqrtdr * urs(f,l))*isdlpdr;
+    const enzo_float vroe2 = (sqrtdl * vls(f,l) + sqrtdr * vrs(f,l))*isdlpdr;
+    const enzo_float vroe3 = (sqrtdl * wls(f,l) + sqrtdr * wrs(f,l))*isdlpdr;
+    const enzo_float v2 = vroe1*vroe1 + vroe2*vroe2 + vroe3*vroe3;
+
+    // The enthalpy H=(E+P)/d is averaged for adiabatic flows, rather than E
+    // or P directly.
+    const enzo_float el = gamma1i * pls(f,l) + half*dls(f,l)*
+      (uls(f,l)*uls(f,l) + vls(f,l)*vls(f,l) + wls(f,l)*wls(f,l));
+    const enzo_float er = gamma1i * prs(f,l) + half*drs(f,l)*
+      (urs(f,l)*urs(f,l) + vrs(f,l)*vrs(f,l) + wrs(f,l)*wrs(f,l));
+    const enzo_float hroe = ((el + pls(f,l))/sqrtdl +
+                             (er + prs(f,l))/sqrtdr) * isdlpdr;
+
+    // Compute characteristics using Roe-averaged values
+    const enzo_float cs = std::sqrt(gamma1*std::max((hroe - half*v2),
+                                                    ppm_tiny));
+    const enzo_float char1 = vroe1 - cs;
+    const enzo_float char2 = vroe1 + cs;
+
+    // Compute the min/max wave speeds
+    const enzo_float csl0 = std::sqrt(gamma*pls(f,l)/dls(f,l));
+    const enzo_float csr0 = std::sqrt(gamma*prs(f,l)/drs(f,l));
+    const enzo_float csl = std::min(uls(f,l) - csl0, char1);
+    const enzo_float csr = std::max(urs(f,l) + csr0, char2);
+    const enzo_float bm = std::min(csl, zero);
+    const enzo_float bp = std::max(csr, zero);
+    const enzo_float bm0 = uls(f,l) - bm;
+    const enzo_float bp0 = urs(f,l) - bp;
+
+    // Weights for different (left, right, star) regions in the cell
+    const enzo_float q1 = (bp + bm) / (bp - bm);
+    const enzo_float sl = half * (one + q1);
+    const enzo_float sr = half * (one - q1);
+
+    // Compute diffusion terms
+    enzo_float diffd = zero, diffuu = zero, diffuv = zero, diffuw = zero;
+    enzo_float diffue = zero, diffuge = zero;
+    if (diffusion) {
+      const enzo_float dc = diffcoef(f,l);
+      diffd  = dc * (d(f-1,l) - d(f,l));
+      diffuu = dc * (d(f-1,l)*u(f-1,l) - d(f,l)*u(f,l));
+      diffuv = dc * (d(f-1,l)*v(f-1,l) - d(f,l)*v(f,l));
+      diffuw = dc * (d(f-1,l)*w(f-1,l) - d(f,l)*w(f,l));
+      diffue = dc * (d(f-1,l)*e(f-1,l) - d(f,l)*e(f,l));
+      if (dual) diffuge = dc * (d(f-1,l)*ge(f-1,l) - d(f,l)*ge(f,l));
+    }
+
+    // Compute the left and right fluxes along the characteristics
+    const enzo_float dubl = dls(f,l) * uls(f,l);
+    const enzo_float dubr = drs(f,l) * urs(f,l);
+    const enzo_float dfl = dls(f,l) * bm0;
+    const enzo_float dfr = drs(f,l) * bp0;
+    const enzo_float ufl = dubl * bm0 + pls(f,l);
+    const enzo_float ufr = dubr * bp0 + prs(f,l);
+    const enzo_float vfl = dls(f,l)*vls(f,l) * bm0;
+    const enzo_float vfr = drs(f,l)*vrs(f,l) * bp0;
+    const enzo_float wfl = dls(f,l)*wls(f,l) * bm0;
+    const enzo_float wfr = drs(f,l)*wrs(f,l) * bp0;
+    const enzo_float efl = el * bm0 + pls(f,l)*uls(f,l);
+    const enzo_float efr = er * bp0 + prs(f,l)*urs(f,l);
+
+    // Compute HLL flux at interface plus diffusion, and absorb dt/dx into
+    // the fluxes. Advected quantities are only multiplied by dt.
+    df(f,l) = qc*(sl*dfl + sr*dfr + diffd);
+    uf(f,l) = qc*(sl*ufl + sr*ufr + diffuu);
+    vf(f,l) = qc*(sl*vfl + sr*vfr + diffuv);
+    wf(f,l) = qc*(sl*wfl + sr*wfr + diffuw);
+    ef(f,l) = qc*(sl*efl + sr*efr + diffue);
+
+    // Gas energy is treated like an advected quantity
+    if (dual) {
+      const enzo_float gefl = bm0 * gels(f,l) * dls(f,l);
+      const enzo_float gefr = bp0 * gers(f,l) * drs(f,l);
+      gef(f,l) = dt/batch.dx*(sl*gefl + sr*gefr + diffuge);
+      ges_left[f-i]  = sl*bm0;
+      ges_right[f-i] = sr*bp0;
+    }
+
+    for (int n = 0; n < num_colors; n++) {
+      TmpPencils_ colls(scratch_[tmp_color_(n,0)]);
+      TmpPencils_ colrs(scratch_[tmp_color_(n,1)]);
+      TmpPencils_ colf(scratch_[tmp_color_(n,2)]);
+      colf(f,l) = dt*(sl*(bm0 * colls(f,l)) + sr*(bp0 * colrs(f,l)));
+    }
+  }
+
+  // Calculate source term for gas energy
+  if (dual) {
+    const enzo_float pcent = std::max((gamma - one)*ge(i,l)*d(i,l), ppm_tiny);
+    ges(i,l) = qc * pcent * (ges_left[0] + ges_right[0] -
+                             ges_left[1] - ges_right[1]);
+  }
+
+  if (d(i,l) + df(i,l) - df(i+1,l) <= zero) {
+    WARNING2("EnzoPpmSolver::compute_hll_fallback_",
+             "Negative density in cell %d of pencil %d even with the HLL "
+             "fluxes", i, l);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPpmSolver::update_cells_(const Batch_ &batch, int num_colors)
+{
+  // port of euler.F
+  const int nl = batch.num_lanes;
+  const int i1 = batch.i1, i2 = batch.i2;
+  const enzo_float dt = batch.dt;
+  const bool dual = parameters_.dual_energy;
+  const FieldPencils_ &d = batch.d, &e = batch.e, &ge = batch.ge;
+  const FieldPencils_ &u = batch.u, &v = batch.v, &w = batch.w;
+  const FieldPencils_ &gr = batch.gr;
+  TmpPencils_ df(scratch_[tmp_df]), ef(scratch_[tmp_ef]);
+  TmpPencils_ uf(scratch_[tmp_uf]), vf(scratch_[tmp_vf]);
+  TmpPencils_ wf(scratch_[tmp_wf]), gef(scratch_[tmp_gef]);
+  TmpPencils_ ges(scratch_[tmp_ges]);
+  // the updated density is only stored after all other quantities have
+  // been updated
+  TmpPencils_ dnu(scratch_[tmp_pbar]);
+
+  const enzo_float p1 = 0.1;
+
+  // Update conservation laws (eq. 3.1)
+  for (int i = i1; i <= i2; i++) {
+    for (int l = 0; l < nl; l++) {
+      enzo_float dn = d(i,l) + (df(i,l) - df(i+1,l));
+      enzo_float dninv = one/dn;
+
+      // Apply density floor and update inv density
+      if (small_rho > zero) {
+        dn    = std::max(dn, small_rho);
+        dninv = one / dn;
+      }
+      dnu(i,l) = dn;
+
+      const enzo_float uold = u(i,l);
+      u(i,l) = (u(i,l)*d(i,l) + (uf(i,l) - uf(i+1,l))) * dninv;
+      v(i,l) = (v(i,l)*d(i,l) + (vf(i,l) - vf(i+1,l))) * dninv;
+      w(i,l) = (w(i,l)*d(i,l) + (wf(i,l) - wf(i+1,l))) * dninv;
+      e(i,l) = std::max(p1*e(i,l),
+                        (e(i,l)*d(i,l) + (ef(i,l) - ef(i+1,l))) * dninv);
+
+      // Conservation law for gas energy, if using the dual energy
+      // formalism (this includes both the flux term and a source term)
+      if (dual) {
+        ge(i,l) = std::max((ge(i,l)*d(i,l) + (gef(i,l) - gef(i+1,l))
+                            + ges(i,l)) * dninv,
+                           half*ge(i,l));
+      }
+
+      // If there is gravity, add the gravity terms here (eq. 3.1 or 3.8).
+      // (Note: the acceleration is already time-centered).
+      if (batch.gravity) {
+        u(i,l) = u(i,l) + dt*gr(i,l)*half*(d(i,l)*dninv + one);
+        e(i,l) = e(i,l) + dt*gr(i,l)*half*(u(i,l) + uold*d(i,l)*dninv);
+        e(i,l) = std::max(e(i,l), ppm_tiny);
+      }
+    }
+  }
+
+  // Color variables (note: colf already multiplied by dt)
+  const enzo_float min_color = 1e-5*ppm_tiny;
+  for (int n = 0; n < num_colors; n++) {
+    const FieldPencils_ &col = batch.colors[n];
+    TmpPencils_ colf(scratch_[tmp_color_(n,2)]);
+    for (int i = i1; i <= i2+1; i++) {
+      for (int l = 0; l < nl; l++) { colf(i,l) = colf(i,l)/batch.dx; }
+    }
+    for (int i = i1; i <= i2; i++) {
+      for (int l = 0; l < nl; l++) {
+        col(i,l) = col(i,l) + (colf(i,l) - colf(i+1,l));
+        col(i,l) = std::max(col(i,l), min_color);
+      }
+    }
+  }
+
+  // Update the new density
+  for (int i = i1; i <= i2; i++) {
+    for (int l = 0; l < nl; l++) { d(i,l) = dnu(i,l); }
+  }
+}
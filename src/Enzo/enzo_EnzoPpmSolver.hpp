@@ -0,0 +1,237 @@
+// See LICENSE_ENZO file for license and copyright information
+
+/// @file     enzo_EnzoPpmSolver.hpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Enzo] Declaration of EnzoPpmSolver, the C++ implementation
+///           of the directionally split PPM solver used by EnzoMethodPpm
+///
+/// This replaces the Fortran routine ppm_de and is a port of the routines
+/// that it called (xeuler_sweep.F,
+/// pgas2d.F, pgas2d_dual.F, calcdiss.F, inteuler.F, intvar.F, twoshock.F,
+/// flux_twoshock.F, flux_hll.F and euler.F). The per-cell arithmetic
+/// follows the Fortran routines operation for operation.
+///
+/// Unlike the Fortran, the solver doesn't copy slices of the fields in and
+/// out of temporary buffers. A sweep along an axis walks over the 2D planes
+/// containing that axis and updates the fields in place. Within a plane,
+/// the pencils are processed in batches of up to `lane_batch` pencils and
+/// the temporary arrays store the values of neighboring pencils
+/// contiguously, so that the innermost loops run across pencils and can be
+/// vectorized. For sweeps along the y and z axes, the pencils in a batch
+/// are adjacent along the x axis (so the fields are also accessed
+/// contiguously), except that with diffusion the y sweep batches along the
+/// z axis so that the pencils are updated in the same order as in
+/// yeuler_sweep.F.
+///
+/// The results are bitwise identical to ppm_de when both are compiled
+/// without value-changing optimizations (e.g. -ffast-math). This includes
+/// a quirk of inteuler.F: every pencil of a 2D slice is flattened with the
+/// coefficients of the first pencil of the slice. Setting
+/// `Parameters::per_pencil_flattening` instead flattens each pencil with
+/// its own coefficients (this changes the results).
+///
+/// All temporary storage is owned by the instance, so separate instances
+/// may be used concurrently. Within a sweep, the planes are divided into
+/// `num_chunks()` chunks that are updated concurrently in SMP builds
+/// (see cello::parallel_for_range()), each with a copy of the temporary
+/// arrays. The planes are updated serially when diffusion couples
+/// neighboring planes.
+
+#ifndef ENZO_ENZO_PPM_SOLVER_HPP
+#define ENZO_ENZO_PPM_SOLVER_HPP
+
+class EnzoPpmSolver {
+
+  /// @class    EnzoPpmSolver
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Solves the Euler equations on a block with the
+  ///           directionally split PPM method
+
+public: // interface
+
+  /// Maximum number of pencils that are processed together
+  static const int lane_batch = 8;
+
+  /// Indices of the quantities whose fluxes through the block faces can be
+  /// saved for flux correction
+  enum flux_quantity {
+    flux_density = 0,
+    flux_total_energy,
+    flux_velocity_x,
+    flux_velocity_y,
+    flux_velocity_z,
+    flux_internal_energy,
+    num_flux_quantities
+  };
+
+  /// Runtime parameters of the solver
+  struct Parameters {
+    /// adiabatic index
+    enzo_float gamma;
+    /// flattening type (0 = off, 1-3 select eqns A1-A2, A4-A6 or A7-A9
+    /// of Colella & Woodward 1984)
+    int flattening;
+    /// whether each pencil is flattened with its own coefficients, rather
+    /// than those of the first pencil of its slice (as in inteuler.F)
+    bool per_pencil_flattening;
+    /// diffusion type (0 = off, 1 = diffusion of type B from calcdiss.F;
+    /// type 2 isn't supported)
+    int diffusion;
+    /// whether to steepen the density
+    bool steepening;
+    /// whether to approximate pressure free conditions
+    bool pressure_free;
+    /// whether to use the dual energy formalism
+    bool dual_energy;
+    enzo_float dual_energy_eta_1;
+    enzo_float dual_energy_eta_2;
+  };
+
+  /// The arrays updated by the solver. Every array has the shape of the
+  /// block (including ghost zones). `velocity` must hold three arrays, even
+  /// for 1D and 2D problems (the solver advects the transverse velocities).
+  /// The accelerations only need to be specified when gravity is used.
+  struct Fields {
+    EFlt3DArray density;
+    EFlt3DArray total_energy;
+    /// only used with the dual energy formalism
+    EFlt3DArray internal_energy;
+    EFlt3DArray velocity[3];
+    EFlt3DArray acceleration[3];
+    /// advected color fields
+    std::vector<EFlt3DArray> colors;
+  };
+
+  /// Location where the fluxes of a quantity through one face of the block
+  /// are saved. The flux through the face adjacent to the active cell with
+  /// transverse indices (ix,iy,iz) (measured from the first active cell) is
+  /// saved at `values[ix*stride[0] + iy*stride[1] + iz*stride[2]]`. Nothing
+  /// is saved when `values` is null.
+  struct FluxStore {
+    FluxStore() : values(nullptr) { stride[0] = stride[1] = stride[2] = 0; }
+    enzo_float * values;
+    int stride[3];
+  };
+
+  /// Create a new EnzoPpmSolver
+  ///
+  /// @param parameters The solver's runtime parameters
+  /// @param rank The dimensionality of the problem
+  /// @param ghost_depth The ghost depth along each axis
+  EnzoPpmSolver(const Parameters &parameters, int rank,
+                const int ghost_depth[3]) throw();
+
+  /// Advance the fields by one timestep, sweeping along each axis with
+  /// Strang-type splitting (the first axis is `cycle % rank`)
+  ///
+  /// @param fields The fields to update
+  /// @param dt The timestep
+  /// @param cell_width The (proper) width of the cells along each axis
+  /// @param cycle The current cycle (selects the order of the sweeps)
+  /// @param flux_store Where to save the fluxes through the lower (index 0)
+  ///     and upper (index 1) faces along each axis. May be null.
+  void solve(Fields &fields, enzo_float dt, const enzo_float cell_width[3],
+             int cycle,
+             const FluxStore (*flux_store)[2][num_flux_quantities] = nullptr);
+
+  /// Update the fields with a single sweep along the specified axis
+  void sweep(int axis, Fields &fields, enzo_float dt,
+             const enzo_float cell_width[3],
+             const FluxStore (*flux_store)[2][num_flux_quantities] = nullptr);
+
+  /// For debugging: at the start of each sweep, append the (ix,iy,iz)
+  /// indices of every cell with a negative density, total energy or (with
+  /// dual energy) internal energy to cells, once per offending quantity.
+  /// Nothing is recorded when cells is null (the default).
+  void record_negative_cells(std::vector< std::array<int,3> > * cells)
+    throw()
+  { negative_cells_ = cells; }
+
+  /// Number of chunks that the planes of a sweep are divided into
+  /// (Performance:num_threads by default)
+  int num_chunks() const throw()
+  { return num_chunks_; }
+
+  void set_num_chunks(int num_chunks) throw()
+  { num_chunks_ = num_chunks; }
+
+private: // helper types
+
+  /// Describes a batch of pencils along the sweep axis
+  struct Batch_;
+
+  /// Temporary arrays of the values along a batch of pencils
+  struct Scratch_ {
+    Scratch_() : length(0), num_arrays(0), data() {}
+
+    /// Returns a pointer to the start of the specified temporary array
+    enzo_float * operator[](int index)
+    { return data.data() + (std::size_t)index * length * lane_batch; }
+
+    /// number of cells along each pencil
+    int length;
+    /// number of temporary arrays
+    int num_arrays;
+    std::vector<enzo_float> data;
+  };
+
+private: // helper methods
+
+  /// Ensures that the scratch space has room for pencils of the given length
+  void prepare_scratch_(int length, int num_colors) throw();
+
+  /// Compute the updated values (and fluxes) for a batch of pencils
+  void compute_batch_(const Batch_ &batch, int num_colors);
+
+  /// Compute the pressure (and apply the dual energy formalism)
+  void compute_pressure_(const Batch_ &batch);
+
+  /// Compute the diffusion and flattening coefficients
+  void compute_dissipation_(const Batch_ &batch);
+
+  /// Replace the flattening coefficients of each pencil with those of the
+  /// first pencil of its slice (as in inteuler.F)
+  void share_reference_flatten_(const Batch_ &batch);
+
+  /// Compute the left and right interface states (from inteuler.F)
+  void compute_interface_states_(const Batch_ &batch, int num_colors);
+
+  /// Solve the Riemann problem at each interface (from twoshock.F)
+  void solve_riemann_(const Batch_ &batch);
+
+  /// Compute the fluxes through each interface (from flux_twoshock.F)
+  void compute_fluxes_(const Batch_ &batch, int num_colors);
+
+  /// Replace the fluxes through both faces of cell i of pencil l with the
+  /// more diffusive HLL fluxes (from flux_hll.F)
+  void compute_hll_fallback_(const Batch_ &batch, int num_colors,
+                             int i, int l);
+
+  /// Apply the fluxes to the cell-centered quantities (from euler.F)
+  void update_cells_(const Batch_ &batch, int num_colors);
+
+private: // attributes
+
+  /// solver parameters
+  Parameters parameters_;
+
+  /// dimensionality of the problem
+  int rank_;
+
+  /// ghost depth along each axis
+  int ghost_depth_[3];
+
+  /// temporary arrays
+  Scratch_ scratch_;
+
+  /// flattening coefficients of the first pencil of each slice
+  std::vector<enzo_float> reference_flatten_;
+
+  /// where cells with negative values are recorded (may be null)
+  std::vector< std::array<int,3> > * negative_cells_;
+
+  /// number of chunks that the planes of a sweep are divided into
+  int num_chunks_;
+};
+
+#endif /* ENZO_ENZO_PPM_SOLVER_HPP */
@@ -361,10 +361,20 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_max_level[index_solver],
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
-       enzo_config->solver_precondition[index_solver]);
+       enzo_config->solver_precondition[index_solver],
+       enzo_config->solver_deflate[index_solver]);
 
   } else if (solver_type == "dd") {
 
+    // Dd restricts the full right-hand side and prolongs the coarse
+    // solution itself, not a residual and a correction, so single
+    // precision messages would limit the accuracy of the solution
+
+    ASSERT1 ("EnzoProblem::create_solver()",
+	     "Solver %s: mixed_precision is not supported by \"dd\" solvers",
+	     enzo_config->solver_list[index_solver].c_str(),
+	     ! enzo_config->solver_mixed_precision[index_solver]);
+
     Restrict * restrict =
       create_restrict_ (enzo_config->solver_restrict[index_solver],config);
     Prolong * prolong =
@@ -399,7 +409,20 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
        enzo_config->solver_precondition[index_solver],
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       enzo_config->solver_expand_residual_dots[index_solver]);
+
+  } else if (solver_type == "chebyshev") {
+
+    solver = new EnzoSolverChebyshev
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_eigen_ratio[index_solver]);
 
   } else if (solver_type == "diagonal") {
 
@@ -411,6 +434,18 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_restart_cycle[index_solver],
        solve_type);
 
+  } else if (solver_type == "fft") {
+
+    solver = new EnzoSolverFft
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver]);
+
   } else if (solver_type == "jacobi") {
 
     solver = new EnzoSolverJacobi
@@ -421,7 +456,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_restart_cycle[index_solver],
        solve_type,
        enzo_config->solver_weight[index_solver],
-       enzo_config->solver_iter_max[index_solver]);
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_sweeps_per_refresh[index_solver]);
 
   } else if (solver_type == "mg0") {
 
@@ -446,7 +482,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_post_smooth[index_solver],
        enzo_config->solver_last_smooth[index_solver],
        restrict,  prolong,
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       enzo_config->solver_mixed_precision[index_solver]);
 
   } else {
     // Not an Enzo Solver--try base class Cello Solver
@@ -569,9 +606,25 @@ Method * EnzoProblem::create_method_
 
   } else if (name == "heat") {
 
+    // optional solver for implicit time integration
+
+    std::string solver_name = enzo_config->method_heat_solver;
+
+    int index_solver = -1;
+    if (solver_name != "") {
+      index_solver = enzo_config->solver_index.at(solver_name);
+      ASSERT1 ("EnzoProblem::create_method_()",
+	       "Cannot find solver \"%s\"",
+	       solver_name.c_str(),
+	       0 <= index_solver && index_solver < enzo_config->num_solvers);
+    }
+
     method = new EnzoMethodHeat
       (enzo_config->method_heat_alpha,
-       config->method_courant[index_method]);
+       config->method_courant[index_method],
+       index_solver,
+       enzo_config->method_heat_theta,
+       enzo_config->method_heat_overlap);
 
 #ifdef CONFIG_USE_GRACKLE
     //--------------------------------------------------
@@ -618,12 +671,34 @@ Method * EnzoProblem::create_method_
 	     solver_name.c_str(),
 	     0 <= index_solver && index_solver < enzo_config->num_solvers);
 
+    // A nonzero initial guess is only used by solvers that keep the X
+    // supplied by the caller, currently "bicgstab" when it reuses the
+    // solution (see Solver::reuse_solution_()).  With restart_cycle
+    // n >= 2 X is discarded every n'th cycle, so require a solver that
+    // keeps X in every cycle
+
+    const std::string initial_guess =
+      enzo_config->method_gravity_initial_guess;
+    const bool keeps_x =
+      (enzo_config->solver_type[index_solver] == "bicgstab") &&
+      ((enzo_config->solver_restart_cycle[index_solver] == 0) ||
+       (enzo_config->solver_solve_type[index_solver] == "tree"));
+
+    if (initial_guess != "zero" && ! keeps_x) {
+      ERROR2 ("EnzoProblem::create_method_()",
+	      "Method:gravity:initial_guess is \"%s\", but solver \"%s\" "
+	      "would not use it in every cycle: use a \"bicgstab\" solver "
+	      "with restart_cycle 0",
+	      initial_guess.c_str(), solver_name.c_str());
+    }
+
   method = new EnzoMethodGravity
       (
        enzo_config->solver_index.at(solver_name),
        enzo_config->method_gravity_grav_const,
        enzo_config->method_gravity_order,
-       enzo_config->method_gravity_accumulate);
+       enzo_config->method_gravity_accumulate,
+       enzo_config->method_gravity_initial_guess);
 
   } else if (name == "mhd_vlct") {
 
@@ -637,7 +712,8 @@ Method * EnzoProblem::create_method_
        enzo_config->method_vlct_pressure_floor,
        enzo_config->method_vlct_mhd_choice,
        enzo_config->method_vlct_dual_energy,
-       enzo_config->method_vlct_dual_energy_eta);
+       enzo_config->method_vlct_dual_energy_eta,
+       enzo_config->method_vlct_tile_size);
 
   } else if (name == "background_acceleration") {
 
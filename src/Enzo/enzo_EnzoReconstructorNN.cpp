@@ -10,38 +10,65 @@
 
 //----------------------------------------------------------------------
 
-void EnzoReconstructorNN::reconstruct_interface
-(EnzoEFltArrayMap &prim_map, EnzoEFltArrayMap &priml_map,
- EnzoEFltArrayMap &primr_map, int dim, EnzoEquationOfState *eos,
- int stale_depth, const str_vec_t& passive_list)
-{
+// Kernel that is specialized on the sweep axis (see enzo_sweep_dispatch)
+struct NNReconstructKernel_{
 
-  // determine components of i unit vector
-  EnzoPermutedCoordinates coord(dim);
-  int i_x, i_y, i_z;
-  coord.i_unit_vector(i_z,i_y,i_x);
+  template<class Sweep>
+  static void apply(int stale_depth, const EnzoEFltArrayMap &prim_map,
+                    const EnzoEFltArrayMap &priml_map,
+                    const EnzoEFltArrayMap &primr_map,
+                    const str_vec_t &active_key_names,
+                    const str_vec_t &passive_list) noexcept
+  {
+    const EnzoPermutedCoordinates coord = Sweep::coord();
 
-  auto fn = [i_x, i_y, i_z, coord, stale_depth,
-             &prim_map, &priml_map, &primr_map](const std::string &key)
+    // The index of key in each map is resolved once, before looping over
+    // the cells
+    auto fn = [coord, stale_depth,
+               &prim_map, &priml_map, &primr_map](const std::string &key)
     {
       // define wc_offset(k,j,i) -> wc(k,j,i+1)
-      EFlt3DArray wc = prim_map.get(key, stale_depth);
+      EFlt3DArray wc = prim_map.get(prim_map.index(key), stale_depth);
       EFlt3DArray wc_offset = coord.left_edge_offset(wc, 0, 0, 1);
 
-      EFlt3DArray wl = priml_map.get(key, stale_depth);
-      EFlt3DArray wr = primr_map.get(key, stale_depth);
+      EFlt3DArray wl = priml_map.get(priml_map.index(key), stale_depth);
+      EFlt3DArray wr = primr_map.get(primr_map.index(key), stale_depth);
+
+      const int nz = wc_offset.shape(0);
+      const int ny = wc_offset.shape(1);
+      const int nx = wc_offset.shape(2);
+      if ((nz == 0) || (ny == 0) || (nx == 0)) { return; }
 
-      // the following could be optimized
-      for (int iz=0; iz<wc.shape(0)-i_z; iz++) {
-	for (int iy=0; iy<wc.shape(1)-i_y; iy++) {
-	  for (int ix=0; ix<wc.shape(2)-i_x; ix++) {
-	      wl(iz,iy,ix) = wc(iz,iy,ix);
-	      wr(iz,iy,ix) = wc_offset(iz,iy,ix);
+      const intp c_offset = Sweep::i_offset(wc);
+
+      for (int iz=0; iz<nz; iz++) {
+	for (int iy=0; iy<ny; iy++) {
+          const enzo_float * const wc_row = &wc(iz,iy,0);
+          const enzo_float * const wc_offset_row = wc_row + c_offset;
+          enzo_float * const wl_row = &wl(iz,iy,0);
+          enzo_float * const wr_row = &wr(iz,iy,0);
+	  for (int ix=0; ix<nx; ix++) {
+	      wl_row[ix] = wc_row[ix];
+	      wr_row[ix] = wc_offset_row[ix];
 	  }
 	}
       }
     };
 
-  for (const std::string &key : active_key_names_){ fn(key); }
-  for (const std::string &key : passive_list){ fn(key); }
+    for (const std::string &key : active_key_names){ fn(key); }
+    for (const std::string &key : passive_list){ fn(key); }
+  }
+};
+
+//----------------------------------------------------------------------
+
+void EnzoReconstructorNN::reconstruct_interface
+(EnzoEFltArrayMap &prim_map, EnzoEFltArrayMap &priml_map,
+ EnzoEFltArrayMap &primr_map, int dim, EnzoEquationOfState *eos,
+ int stale_depth, const str_vec_t& passive_list)
+{
+  // the specialized kernel is selected once for all of the fields
+  enzo_sweep_dispatch<NNReconstructKernel_>(dim, stale_depth,
+                                            prim_map, priml_map, primr_map,
+                                            active_key_names_, passive_list);
 }
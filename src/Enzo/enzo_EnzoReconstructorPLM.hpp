@@ -174,6 +174,10 @@ public: // interface
   int immediate_staling_rate()
   { return 1; }
 
+private:
+  /// Kernel that is specialized on the sweep axis (see enzo_sweep_dispatch)
+  struct ReconstructKernel_;
+
 private:
   // parameter used to adjust some slope limiters
   enzo_float theta_limiter_;
@@ -182,20 +186,31 @@ private:
 //----------------------------------------------------------------------
 
 template <class Limiter>
-void EnzoReconstructorPLM<Limiter>::reconstruct_interface
-(EnzoEFltArrayMap &prim_map, EnzoEFltArrayMap &priml_map,
- EnzoEFltArrayMap &primr_map, int dim, EnzoEquationOfState *eos,
- int stale_depth, const str_vec_t& passive_list)
+struct EnzoReconstructorPLM<Limiter>::ReconstructKernel_
 {
-  EnzoPermutedCoordinates coord(dim);
-  Limiter limiter_func = Limiter();
-  const enzo_float theta_limiter = theta_limiter_;
-
-  auto fn = [coord, limiter_func, theta_limiter, stale_depth,
-             &prim_map, &priml_map, &primr_map](const std::string &key,
-                                                bool use_floor,
-                                                enzo_float prim_floor)
+  template<class Sweep>
+  static void apply(enzo_float theta_limiter, int stale_depth,
+                    enzo_float density_floor, enzo_float pressure_floor,
+                    const EnzoEFltArrayMap &prim_map,
+                    const EnzoEFltArrayMap &priml_map,
+                    const EnzoEFltArrayMap &primr_map,
+                    const str_vec_t &active_key_names,
+                    const str_vec_t &passive_list)
+  {
+    const EnzoPermutedCoordinates coord = Sweep::coord();
+    Limiter limiter_func = Limiter();
+
+    // The index of key in each map is resolved once, before looping over
+    // the cells
+    auto fn = [coord, limiter_func, theta_limiter, stale_depth,
+               &prim_map, &priml_map, &primr_map](const std::string &key,
+                                                  bool use_floor,
+                                                  enzo_float prim_floor)
     {
+      const std::size_t i_prim = prim_map.index(key);
+      const std::size_t i_l = priml_map.index(key);
+      const std::size_t i_r = primr_map.index(key);
+
       // Cast the problem as reconstructing values at:
       //   wl(k, j, i+3/2) and wr(k,j,i+1/2)
 
@@ -203,30 +218,44 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
       // define:   wc_left(k,j,i)   -> w(k,j,i)
       //           wc_center(k,j,i) -> w(k,j,i+1)
       //           wc_right(k,j,i)  -> w(k,j,i+2)
-      EFlt3DArray wc_left = prim_map.get(key, stale_depth);
-      EFlt3DArray wc_center = coord.left_edge_offset(wc_left, 0, 0, 1);
+      // (only wc_right is constructed - the others are accessed through
+      // offsets from a row of wc_left)
+      EFlt3DArray wc_left = prim_map.get(i_prim, stale_depth);
       EFlt3DArray wc_right  = coord.left_edge_offset(wc_left, 0, 0, 2);
 
       // Prepare face-centered arrays
       // define:   wl_offset(k,j,i)-> wl(k,j,i+3/2)
       //           wr(k,j,i)       -> wr(k,j,i+1/2)
-      EFlt3DArray wr = primr_map.get(key,stale_depth);
-      EFlt3DArray wl = priml_map.get(key,stale_depth);
-      EFlt3DArray wl_offset = coord.left_edge_offset(wl, 0, 0, 1);
+      EFlt3DArray wr = primr_map.get(i_r, stale_depth);
+      EFlt3DArray wl = priml_map.get(i_l, stale_depth);
+
+      const int nz = wc_right.shape(0);
+      const int ny = wc_right.shape(1);
+      const int nx = wc_right.shape(2);
+      if ((nz == 0) || (ny == 0) || (nx == 0)) { return; }
+
+      const intp c_offset = Sweep::i_offset(wc_left);
+      const intp l_offset = Sweep::i_offset(wl);
 
       // At the interfaces between the first and second cell (second-to-
       // last and last cell), along a given axis, no need to worry about
       // initializing the left (right) interface value thanks to the adoption
       // of immediate_staling_rate
 
-      for (int iz=0; iz<wc_right.shape(0); iz++) {
-        for (int iy=0; iy<wc_right.shape(1); iy++) {
-          for (int ix=0; ix<wc_right.shape(2); ix++) {
+      for (int iz=0; iz<nz; iz++) {
+        for (int iy=0; iy<ny; iy++) {
+          const enzo_float * const wc_left_row = &wc_left(iz,iy,0);
+          const enzo_float * const wc_center_row = wc_left_row + c_offset;
+          const enzo_float * const wc_right_row = wc_center_row + c_offset;
+          enzo_float * const wr_row = &wr(iz,iy,0);
+          enzo_float * const wl_offset_row = &wl(iz,iy,0) + l_offset;
+
+          for (int ix=0; ix<nx; ix++) {
 
             // compute limited slopes
-            enzo_float val = wc_center(iz,iy,ix);
-            enzo_float dv = limiter_func(wc_left(iz,iy,ix), val,
-                                         wc_right(iz,iy,ix), theta_limiter);
+            enzo_float val = wc_center_row[ix];
+            enzo_float dv = limiter_func(wc_left_row[ix], val,
+                                         wc_right_row[ix], theta_limiter);
             enzo_float half_dv = dv*0.5;
             enzo_float left_val, right_val;
 
@@ -241,27 +270,42 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
             }
 
             // face centered fields: index i corresponds to the value at i-1/2
-            wr(iz,iy,ix) = right_val;
-            wl_offset(iz,iy,ix) = left_val;
+            wr_row[ix] = right_val;
+            wl_offset_row[ix] = left_val;
           }
         }
       }
     };
 
-  for (const std::string &key : active_key_names_){
-    enzo_float prim_floor = 0;
-    bool use_floor = false;
-    if (key == "density"){
-      prim_floor = eos->get_density_floor();
-      use_floor=true;
-    } else if (key == "pressure"){
-      prim_floor = eos->get_pressure_floor();
-      use_floor=true;
+    for (const std::string &key : active_key_names){
+      if (key == "density"){
+        fn(key, true, density_floor);
+      } else if (key == "pressure"){
+        fn(key, true, pressure_floor);
+      } else {
+        fn(key, false, 0.);
+      }
     }
-    fn(key, use_floor, prim_floor);
+
+    for (const std::string &key : passive_list){ fn(key, false, 0.); }
   }
+};
 
-  for (const std::string &key : passive_list){ fn(key, false, 0.); }
+//----------------------------------------------------------------------
+
+template <class Limiter>
+void EnzoReconstructorPLM<Limiter>::reconstruct_interface
+(EnzoEFltArrayMap &prim_map, EnzoEFltArrayMap &priml_map,
+ EnzoEFltArrayMap &primr_map, int dim, EnzoEquationOfState *eos,
+ int stale_depth, const str_vec_t& passive_list)
+{
+  // the specialized kernel is selected once for all of the fields
+  enzo_sweep_dispatch<ReconstructKernel_>(dim, theta_limiter_,
+                                          stale_depth,
+                                          eos->get_density_floor(),
+                                          eos->get_pressure_floor(),
+                                          prim_map, priml_map, primr_map,
+                                          active_key_names_, passive_list);
 }
 
 //----------------------------------------------------------------------
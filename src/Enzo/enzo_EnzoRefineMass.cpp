@@ -146,15 +146,25 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 		name_.c_str(),mass_min_refine);
 #endif      
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho4[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
+    {
+      // (members of an anonymous union can't be captured by a lambda)
+      const float * rho = rho4;
+      evaluate_planes_
+        (gz, mz-gz, [&] (int iz_first, int iz_last,
+                         bool * any_refine, bool * all_coarsen)
+         {
+           for (int iz=iz_first; iz<iz_last; iz++) {
+             for (int iy=gy; iy<my-gy; iy++) {
+               for (int ix=gx; ix<mx-gx; ix++) {
+                 int i = ix + mx*(iy + my*iz);
+                 double mass = vol*rho[i];
+                 if (mass > mass_min_refine)  *any_refine  = true;
+                 if (mass > mass_max_coarsen) *all_coarsen = false;
+               }
+             }
+           }
+         },
+         &any_refine, &all_coarsen);
     }
     break;
   case precision_double:
@@ -175,15 +185,24 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 	}
       }
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho8[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
+    {
+      const double * rho = rho8;
+      evaluate_planes_
+        (gz, mz-gz, [&] (int iz_first, int iz_last,
+                         bool * any_refine, bool * all_coarsen)
+         {
+           for (int iz=iz_first; iz<iz_last; iz++) {
+             for (int iy=gy; iy<my-gy; iy++) {
+               for (int ix=gx; ix<mx-gx; ix++) {
+                 int i = ix + mx*(iy + my*iz);
+                 double mass = vol*rho[i];
+                 if (mass > mass_min_refine)  *any_refine  = true;
+                 if (mass > mass_max_coarsen) *all_coarsen = false;
+               }
+             }
+           }
+         },
+         &any_refine, &all_coarsen);
     }
     break;
   case precision_quadruple:
@@ -200,15 +219,24 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 	}
       }
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  long double mass = vol*rho16[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
+    {
+      const long double * rho = rho16;
+      evaluate_planes_
+        (gz, mz-gz, [&] (int iz_first, int iz_last,
+                         bool * any_refine, bool * all_coarsen)
+         {
+           for (int iz=iz_first; iz<iz_last; iz++) {
+             for (int iy=gy; iy<my-gy; iy++) {
+               for (int ix=gx; ix<mx-gx; ix++) {
+                 int i = ix + mx*(iy + my*iz);
+                 long double mass = vol*rho[i];
+                 if (mass > mass_min_refine)  *any_refine  = true;
+                 if (mass > mass_max_coarsen) *all_coarsen = false;
+               }
+             }
+           }
+         },
+         &any_refine, &all_coarsen);
     }
     break;
   default:
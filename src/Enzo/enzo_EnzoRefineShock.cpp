@@ -129,55 +129,67 @@ void EnzoRefineShock::evaluate_block_
   enzo_float dp_max = -std::numeric_limits<enzo_float>::max();
   enzo_float er_min = std::numeric_limits<enzo_float>::max();
   enzo_float er_max = -std::numeric_limits<enzo_float>::max();
+  // the limits are shared by the chunks
+  const int num_chunks = 1;
+#else
+  const int num_chunks = cello::num_threads();
 #endif
-  
-  for (int axis=0; axis<rank; axis++) {
 
-    for (int iz=gz; iz<nz+gz; iz++) {
-      for (int iy=gy; iy<ny+gy; iy++) {
-	for (int ix=gx; ix<nx+gx; ix++) {
+  // The axes are looped over inside the cell loops so that the chunks of
+  // z planes are independent. The output of each cell is still updated
+  // in order of increasing axis.
+  evaluate_planes_
+    (gz, nz+gz, [&] (int iz_first, int iz_last,
+                     bool * any_refine, bool * all_coarsen)
+     {
+       for (int iz=iz_first; iz<iz_last; iz++) {
+         for (int iy=gy; iy<ny+gy; iy++) {
+           for (int ix=gx; ix<nx+gx; ix++) {
+             for (int axis=0; axis<rank; axis++) {
 
-	  int i = ix + ndx*(iy + ndy*iz);
-	  int id = d3[axis];
+               int i = ix + ndx*(iy + ndy*iz);
+               int id = d3[axis];
 
-	  enzo_float dp = fabs    (p[i+id] - p[i-id]) 
-	    / (std::min(p[i+id] , p[i-id])) ;
+               enzo_float dp = fabs    (p[i+id] - p[i-id])
+                 / (std::min(p[i+id] , p[i-id])) ;
 
-	  enzo_float dv = v3[axis][i+id] - v3[axis][i-id];
+               enzo_float dv = v3[axis][i+id] - v3[axis][i-id];
 
-	  enzo_float e = p[i]/(gamma_ - 1.0);
+               enzo_float e = p[i]/(gamma_ - 1.0);
 
-	  enzo_float ep = te[i+id]*de[i+id];
-	  enzo_float e0 = te[i]   *de[i];
-	  enzo_float em = te[i-id]*de[i-id];
+               enzo_float ep = te[i+id]*de[i+id];
+               enzo_float e0 = te[i]   *de[i];
+               enzo_float em = te[i-id]*de[i-id];
 
-	  enzo_float er = e / std::max (std::max(em,e0),ep);
+               enzo_float er = e / std::max (std::max(em,e0),ep);
 
-	  bool l_refine = (dv < 0.0) && 
-	    (dp > pressure_min_refine_) &&
-	    (er > energy_ratio_min_refine_);
+               bool l_refine = (dv < 0.0) &&
+                 (dp > pressure_min_refine_) &&
+                 (er > energy_ratio_min_refine_);
 
-	  bool l_same = (dv < 0.0) &&
-	    (dp > pressure_max_coarsen_) &&
-	    (er > energy_ratio_max_coarsen_);
+               bool l_same = (dv < 0.0) &&
+                 (dp > pressure_max_coarsen_) &&
+                 (er > energy_ratio_max_coarsen_);
 
 #ifdef DEBUG_ENZO_REFINE_SHOCK
-	  dp_min = std::min(dp_min,dp);
-	  dp_max = std::max(dp_max,dp);
-	  er_min = std::min(er_min,er);
-	  er_max = std::max(er_max,er);
+               dp_min = std::min(dp_min,dp);
+               dp_max = std::max(dp_max,dp);
+               er_min = std::min(er_min,er);
+               er_max = std::max(er_max,er);
 #endif
-	  if (l_refine)  *any_refine = true;
-	  if (l_same)    *all_coarsen = false;
-
-	  if (output) {
-	    if (l_same)   output[i] =  0;
-	    if (l_refine) output[i] = +1;
-	  }
-	}
-      }
-    }
-  }
+               if (l_refine)  *any_refine = true;
+               if (l_same)    *all_coarsen = false;
+
+               if (output) {
+                 if (l_same)   output[i] =  0;
+                 if (l_refine) output[i] = +1;
+               }
+             }
+           }
+         }
+       }
+     },
+     any_refine, all_coarsen, num_chunks);
 #ifdef DEBUG_ENZO_REFINE_SHOCK
   CkPrintf ("%s dp limits %lf %lf  dp min/max %lf %lf\n",
 	    pressure_max_coarsen_,pressure_min_refine_,
@@ -89,6 +89,16 @@ public: // interface
    int stale_depth, const str_vec_t &passive_list,
    EFlt3DArray *interface_velocity) const = 0;
 
+  /// Returns the keys of the actively advected integrable quantities that the
+  /// solver operates on, ordered to match the indices of its internal lookup
+  /// table. The i, j, and k components of vector quantities are listed as the
+  /// x, y, and z components.
+  ///
+  /// If the leading keys of a frozen EnzoEFltArrayMap follow this ordering,
+  /// then the map's arrays can be walked in the same order as the lookup
+  /// table (with the quantities stored as a single strided array).
+  virtual std::vector<std::string> lut_ordered_keys() const noexcept = 0;
+
 };
 
 #endif /* ENZO_ENZO_RIEMANN_HPP */
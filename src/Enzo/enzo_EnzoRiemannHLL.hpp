@@ -40,11 +40,35 @@ struct EinfeldtWavespeed
 
   using LUT = EnzoRiemannLUT<inputLUT>;
 
-  inline void operator()(const lutarray<LUT> wl, const lutarray<LUT> wr,
-                  const lutarray<LUT> Ul, const lutarray<LUT> Ur,
-                  enzo_float pressure_l, enzo_float pressure_r,
-                  const enzo_float gamma,
-                  enzo_float *bp, enzo_float *bm) const noexcept
+  /// Computes the wavespeeds for every lane of a batch of interfaces. The
+  /// body of the loop over lanes is free of branches so that the compiler
+  /// can vectorize it.
+  template <std::size_t W>
+  inline void operator()(const lutbatch<LUT,W> &wl_batch,
+                         const lutbatch<LUT,W> &wr_batch,
+                         const lutbatch<LUT,W> &Ul_batch,
+                         const lutbatch<LUT,W> &Ur_batch,
+                         const std::array<enzo_float,W> &pressure_l,
+                         const std::array<enzo_float,W> &pressure_r,
+                         const enzo_float gamma,
+                         std::array<enzo_float,W> &bp,
+                         std::array<enzo_float,W> &bm) const noexcept
+  {
+    for (std::size_t lane = 0; lane < W; lane++){
+      const lutbatch_lane<LUT,W> wl(wl_batch, lane), wr(wr_batch, lane);
+      const lutbatch_lane<LUT,W> Ul(Ul_batch, lane), Ur(Ur_batch, lane);
+      lane_wavespeeds_(wl, wr, Ul, Ur, pressure_l[lane], pressure_r[lane],
+                       gamma, bp[lane], bm[lane]);
+    }
+  }
+
+  /// Computes the wavespeeds at a single interface
+  template <class Arr>
+  inline void lane_wavespeeds_(const Arr &wl, const Arr &wr,
+                               const Arr &Ul, const Arr &Ur,
+                               enzo_float pressure_l, enzo_float pressure_r,
+                               const enzo_float gamma,
+                               enzo_float &bp, enzo_float &bm) const noexcept
   {
     // Calculate wavespeeds as specified by S4.3.1 of Stone+08
     // if LM and L0 are max/min eigenvalues of Roe's matrix:
@@ -107,8 +131,8 @@ struct EinfeldtWavespeed
       c_roe = roe_cs_(v_roe2, h_roe, gamma);
     }
 
-    *bp = std::fmax(vi_roe + c_roe, right_speed);
-    *bm = std::fmin(vi_roe - c_roe, left_speed);
+    bp = std::fmax(vi_roe + c_roe, right_speed);
+    bm = std::fmin(vi_roe - c_roe, left_speed);
   }
 
   /// Return the sound speed needed to get the max and min eigenvalues for
@@ -127,7 +151,8 @@ struct EinfeldtWavespeed
 
   /// Return the fast magnetosonic speed needed to get the max and min
   /// eigenvalues for Roe's matrix for adiabatic Magnetohydrodynamics
-  inline enzo_float roe_cfast_(const lutarray<LUT> wl, const lutarray<LUT> wr,
+  template <class Arr>
+  inline enzo_float roe_cfast_(const Arr &wl, const Arr &wr,
                         const enzo_float sqrtrho_l, const enzo_float sqrtrho_r,
                         const enzo_float inv_sqrtrho_tot,
                         const enzo_float v_roe2, const enzo_float h_roe,
@@ -182,31 +207,43 @@ public:
 
   using LUT = EnzoRiemannLUT<inputLUT>;
 
-  void operator()(const lutarray<LUT> wl, const lutarray<LUT> wr,
-                  const lutarray<LUT> Ul, const lutarray<LUT> Ur,
-                  enzo_float pressure_l, enzo_float pressure_r,
+  template <std::size_t W>
+  void operator()(const lutbatch<LUT,W> &wl_batch,
+                  const lutbatch<LUT,W> &wr_batch,
+                  const lutbatch<LUT,W> &Ul_batch,
+                  const lutbatch<LUT,W> &Ur_batch,
+                  const std::array<enzo_float,W> &pressure_l,
+                  const std::array<enzo_float,W> &pressure_r,
                   const enzo_float gamma,
-                  enzo_float *bp, enzo_float *bm) const noexcept
+                  std::array<enzo_float,W> &bp,
+                  std::array<enzo_float,W> &bm) const noexcept
   {
     // Should be relatively easy to adapt and make compatible with barotropic
     // eos
     ERROR("EnzoHLLEWavespeed","This hasn't been tested yet");
 
-    // compute left and right fast magnetosonic speed assuming that cos2 = 1
-    // not sure why cos2 = 1 was chosen, (cos2 = 0, would yield faster speeds)
-    using enzo_riemann_utils::fast_magnetosonic_speed;
-    enzo_float c_l = fast_magnetosonic_speed<LUT>(wl, pressure_l, gamma, 1);
-    enzo_float c_r = fast_magnetosonic_speed<LUT>(wr, pressure_r, gamma, 1);
-
-    enzo_float lp_l = wl[LUT::velocity_i] + c_l;
-    enzo_float lm_l = wl[LUT::velocity_i] - c_l;
-    enzo_float lp_r = wr[LUT::velocity_i] + c_r;
-    enzo_float lm_r = wr[LUT::velocity_i] - c_r;
-
-    // The following is equivalent to the enzo version except bm has been
-    // multiplied by -1
-    *bp = std::fmax(lp_l, lp_r);
-    *bm = std::fmin(lm_l, lm_r);
+    for (std::size_t lane = 0; lane < W; lane++){
+      const lutbatch_lane<LUT,W> wl(wl_batch, lane), wr(wr_batch, lane);
+
+      // compute left and right fast magnetosonic speed assuming that cos2 = 1
+      // not sure why cos2 = 1 was chosen, (cos2 = 0, would yield faster
+      // speeds)
+      using enzo_riemann_utils::fast_magnetosonic_speed;
+      enzo_float c_l = fast_magnetosonic_speed<LUT>(wl, pressure_l[lane],
+                                                    gamma, 1);
+      enzo_float c_r = fast_magnetosonic_speed<LUT>(wr, pressure_r[lane],
+                                                    gamma, 1);
+
+      enzo_float lp_l = wl[LUT::velocity_i] + c_l;
+      enzo_float lm_l = wl[LUT::velocity_i] - c_l;
+      enzo_float lp_r = wr[LUT::velocity_i] + c_r;
+      enzo_float lm_r = wr[LUT::velocity_i] - c_r;
+
+      // The following is equivalent to the enzo version except bm has been
+      // multiplied by -1
+      bp[lane] = std::fmax(lp_l, lp_r);
+      bm[lane] = std::fmin(lm_l, lm_r);
+    }
   }
 };
 
@@ -222,32 +259,38 @@ public:
 
   using LUT = typename WaveSpeedFunctor::LUT;
 
-  lutarray<LUT> operator()
-  (const lutarray<LUT> flux_l, const lutarray<LUT> flux_r,
-   const lutarray<LUT> prim_l, const lutarray<LUT> prim_r,
-   const lutarray<LUT> cons_l, const lutarray<LUT> cons_r,
-   enzo_float pressure_l, enzo_float pressure_r,
+  template <std::size_t W>
+  void operator()
+  (const lutbatch<LUT,W> &flux_l, const lutbatch<LUT,W> &flux_r,
+   const lutbatch<LUT,W> &prim_l, const lutbatch<LUT,W> &prim_r,
+   const lutbatch<LUT,W> &cons_l, const lutbatch<LUT,W> &cons_r,
+   const std::array<enzo_float,W> &pressure_l,
+   const std::array<enzo_float,W> &pressure_r,
    bool barotropic_eos, enzo_float gamma, enzo_float isothermal_cs,
-   enzo_float &vi_bar) const noexcept
+   lutbatch<LUT,W> &fluxes, std::array<enzo_float,W> &vi_bar) const noexcept
   { 
     // there is no scratch_space
     WaveSpeedFunctor wave_speeds;
-    enzo_float bp, bm;
+    std::array<enzo_float,W> bp, bm, inv_speed_diff;
 
     // Compute wave speeds
     wave_speeds(prim_l, prim_r, cons_l, cons_r, pressure_l, pressure_r, gamma,
-                &bp, &bm);
-    bp = std::fmax(bp,0.0);
-    bm = std::fmin(bm,0.0);
-    enzo_float inv_speed_diff = 1./(bp - bm);
+                bp, bm);
+    for (std::size_t lane = 0; lane < W; lane++){
+      bp[lane] = std::fmax(bp[lane],0.0);
+      bm[lane] = std::fmin(bm[lane],0.0);
+      inv_speed_diff[lane] = 1./(bp[lane] - bm[lane]);
+    }
 
     // Compute the actual riemann fluxes (value of dual_energy_formalism is
     // irrelevant)
-    lutarray<LUT> fluxes;
     for (std::size_t field = 0; field < LUT::NEQ; field++){
-      fluxes[field] = ((bp*flux_l[field] - bm*flux_r[field] +
-                        (cons_r[field] - cons_l[field])*bp*bm)
-                       * inv_speed_diff);
+      for (std::size_t lane = 0; lane < W; lane++){
+        fluxes[field][lane] =
+          ((bp[lane]*flux_l[field][lane] - bm[lane]*flux_r[field][lane] +
+            (cons_r[field][lane] - cons_l[field][lane])*bp[lane]*bm[lane])
+           * inv_speed_diff[lane]);
+      }
     }
 
     // Estimate the value of the vi (ith component of velocity) which is used
@@ -258,13 +301,15 @@ public:
     //   - otherwise linearly interpolate between vi_L and vi_R. Let the cell
     //     interface be at x=0. At some time t, the velocity is vi_L at x=t*bm
     //     and vi_R at x=t*bp. The factors of t cancel.
-    vi_bar = (bp*prim_l[LUT::velocity_i]
-              - bm*prim_r[LUT::velocity_i]) * inv_speed_diff;
+    for (std::size_t lane = 0; lane < W; lane++){
+      vi_bar[lane] = (bp[lane]*prim_l[LUT::velocity_i][lane]
+                      - bm[lane]*prim_r[LUT::velocity_i][lane])
+        * inv_speed_diff[lane];
+    }
     // Alternatively, if vi is assumed to be constant in the intermediate zone
     // (which is an underlying assumption of HLLC & HLLD), it can be estimated
     // using equations for the values of rho and rho*vi in the intermediate
     // zone. This yields the equation for the contact wave speed in HLLC & HLLD
-    return fluxes;
   }
 };
 
@@ -27,10 +27,40 @@ public:
 
   using LUT = EnzoRiemannLUT<MHDLUT>;
 
-  lutarray<LUT> operator()
-  (const lutarray<LUT> flux_l, const lutarray<LUT> flux_r,
-   const lutarray<LUT> prim_l, const lutarray<LUT> prim_r,
-   const lutarray<LUT> cons_l, const lutarray<LUT> cons_r,
+  /// Computes the fluxes for a batch of interfaces. Unlike the HLL and HLLC
+  /// solvers, the HLLD calculation is highly branched (with early exits), so
+  /// the lanes are simply processed one at a time by lane_fluxes_
+  template <std::size_t W>
+  void operator()
+  (const lutbatch<LUT,W> &flux_l, const lutbatch<LUT,W> &flux_r,
+   const lutbatch<LUT,W> &prim_l, const lutbatch<LUT,W> &prim_r,
+   const lutbatch<LUT,W> &cons_l, const lutbatch<LUT,W> &cons_r,
+   const std::array<enzo_float,W> &pressure_l,
+   const std::array<enzo_float,W> &pressure_r,
+   bool barotropic_eos, enzo_float gamma, enzo_float isothermal_cs,
+   lutbatch<LUT,W> &fluxes, std::array<enzo_float,W> &vi_bar) const noexcept
+  {
+    for (std::size_t lane = 0; lane < W; lane++){
+      const lutbatch_lane<LUT,W> Fl(flux_l, lane), Fr(flux_r, lane);
+      const lutbatch_lane<LUT,W> wl(prim_l, lane), wr(prim_r, lane);
+      const lutbatch_lane<LUT,W> Ul(cons_l, lane), Ur(cons_r, lane);
+      lutarray<LUT> lane_fluxes = lane_fluxes_(Fl, Fr, wl, wr, Ul, Ur,
+                                               pressure_l[lane],
+                                               pressure_r[lane],
+                                               barotropic_eos, gamma,
+                                               isothermal_cs, vi_bar[lane]);
+      for (std::size_t field = 0; field < LUT::NEQ; field++){
+        fluxes[field][lane] = lane_fluxes[field];
+      }
+    }
+  }
+
+  /// Computes the fluxes at a single interface
+  template <class Arr>
+  lutarray<LUT> lane_fluxes_
+  (const Arr &flux_l, const Arr &flux_r,
+   const Arr &prim_l, const Arr &prim_r,
+   const Arr &cons_l, const Arr &cons_r,
    enzo_float pressure_l, enzo_float pressure_r,
    bool barotropic_eos, enzo_float gamma, enzo_float isothermal_cs,
    enzo_float &vi_bar) const noexcept
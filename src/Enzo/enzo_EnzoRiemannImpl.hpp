@@ -61,18 +61,25 @@ struct MHDLUT{
 /// An `ImplFunctor`'s `operator()` method should be declared as:
 ///
 /// @code
-///     lutarray<LUT> operator()
-///       (const lutarray<LUT> flux_l, const lutarray<LUT> flux_r,
-///        const lutarray<LUT> prim_l, const lutarray<LUT> prim_r,
-///        const lutarray<LUT> cons_l, const lutarray<LUT> cons_r,
-///        enzo_float pressure_l, enzo_float pressure_r, bool barotropic_eos,
-///        enzo_float gamma, enzo_float isothermal_cs, enzo_float &vi_bar)
+///     template <std::size_t W>
+///     void operator()
+///       (const lutbatch<LUT,W> &flux_l, const lutbatch<LUT,W> &flux_r,
+///        const lutbatch<LUT,W> &prim_l, const lutbatch<LUT,W> &prim_r,
+///        const lutbatch<LUT,W> &cons_l, const lutbatch<LUT,W> &cons_r,
+///        const std::array<enzo_float,W> &pressure_l,
+///        const std::array<enzo_float,W> &pressure_r, bool barotropic_eos,
+///        enzo_float gamma, enzo_float isothermal_cs,
+///        lutbatch<LUT,W> &fluxes, std::array<enzo_float,W> &vi_bar)
 /// @endcode
 ///
-/// This function should computes the Riemann Flux at a given cell-interface
-/// for the set of actively advected quantities designated by the `LUT` type
-/// publicly defined within the scope of `ImplFunctor` (that can be acessed with
-/// `ImplFunctor::LUT`).
+/// This function should computes the Riemann Flux at each of the `W`
+/// cell-interfaces of a batch (each interface occupies a "lane" of the
+/// batch) for the set of actively advected quantities designated by the `LUT`
+/// type publicly defined within the scope of `ImplFunctor` (that can be
+/// acessed with `ImplFunctor::LUT`). Functors should perform the calculation
+/// in loops over the lanes of the batch that the compiler can vectorize
+/// (i.e. without branches). `lutbatch_lane` can be used to access the values
+/// of a single lane with the lutarray interface.
 ///
 /// The arguments, `flux_l`, `flux_r`, `prim_l`, `prim_r`, `cons_l`, and
 /// `cons_r` are constant arrays that store values associated with each
@@ -88,19 +95,20 @@ struct MHDLUT{
 /// and `pressure_r`. `barotropic_eos` indicates whether the fluid equation of
 /// state is barotropic. If `true`, then `isothermal_cs` is expected to be
 /// non-zero and if `false`, then `gamma` is expected to be positive. `vi_bar`
-/// is the estimate of `velocity_i` at the cell-interface to be used in the
-/// internal energy source term (for the dual energy formalism).
+/// is used to store the estimate of `velocity_i` at each cell-interface to be
+/// used in the internal energy source term (for the dual energy formalism).
 ///
-/// The function is expected to return the computed fluxes for each actively
-/// advected quantity in an array with mapping set by `ImplFunctor::LUT`
-template<class LUT>
+/// The function is expected to store the computed fluxes for each actively
+/// advected quantity in `fluxes`, with a mapping set by `ImplFunctor::LUT`
+template<class LUT, std::size_t W>
 using riemann_function_call_signature =
-  lutarray<LUT>(*)(const lutarray<LUT> flux_l, const lutarray<LUT> flux_r,
-                   const lutarray<LUT> prim_l, const lutarray<LUT> prim_r,
-                   const lutarray<LUT> cons_l, const lutarray<LUT> cons_r,
-                   enzo_float pressure_l, enzo_float pressure_r,
-                   bool barotropic_eos, enzo_float gamma,
-                   enzo_float isothermal_cs, enzo_float &vi_bar);
+  void(*)(const lutbatch<LUT,W> flux_l, const lutbatch<LUT,W> flux_r,
+          const lutbatch<LUT,W> prim_l, const lutbatch<LUT,W> prim_r,
+          const lutbatch<LUT,W> cons_l, const lutbatch<LUT,W> cons_r,
+          const std::array<enzo_float,W> pressure_l,
+          const std::array<enzo_float,W> pressure_r,
+          bool barotropic_eos, enzo_float gamma, enzo_float isothermal_cs,
+          lutbatch<LUT,W> &fluxes, std::array<enzo_float,W> &vi_bar);
 
 //----------------------------------------------------------------------
 
@@ -140,13 +148,23 @@ class EnzoRiemannImpl : public EnzoRiemann
   static_assert(std::is_default_constructible<ImplFunctor>::value,
 		"ImplFunctor is not default constructable");
 
+  /// The number of neighboring cell interfaces along the x-axis (the
+  /// contiguous axis of all arrays) that are processed together as a batch by
+  /// `solve`. The gathering of values, the calculation of the conserved
+  /// quantities, the calculation of the interface fluxes of the left and
+  /// right states and the calculation of the Riemann fluxes are all performed
+  /// in structure-of-arrays form for every interface in the batch.
+  static const std::size_t batch_width_ = 8;
+
   // Check whether ImplFunctor's operator() method has the expected signature
   // and raise an error message if it doesn't:
   //   - first, define a struct (has_expected_functor_sig_) to check if
   //     ImplFunctor's operator() method has the expected signature. This needs
   //     to happen in the current scope because the signature depends on LUT
+  using expected_functor_sig_ =
+    riemann_function_call_signature<LUT, batch_width_>;
   DEFINE_HAS_INSTANCE_METHOD(has_expected_functor_sig_, operator(),
-                             riemann_function_call_signature<LUT>);
+                             expected_functor_sig_);
   static_assert(has_expected_functor_sig_<ImplFunctor>::value,
 		"ImplFunctor's operator() method doesn't have the correct "
 		"function signature");
@@ -160,6 +178,17 @@ class EnzoRiemannImpl : public EnzoRiemann
   /// Note: This is unrelated to Riemann Solver Fallback. 
   static const std::vector<std::string> PassiveFallbackAdvectionQuantities;
 
+  /// Holds pointers to the start of a single row (with fixed iz and iy) of
+  /// each array used by `solve`. Indexing one of these pointers with ix is
+  /// equivalent to indexing the corresponding array with (iz,iy,ix).
+  struct RowPtrs_ {
+    std::array<const enzo_float*, LUT::NEQ> wl, wr;
+    std::array<enzo_float*, LUT::NEQ> flux;
+    const enzo_float *pressure_l, *pressure_r;
+    /// This is a nullptr when the interface velocity isn't stored
+    enzo_float *vi_bar;
+  };
+
 public: // interface
 
   /// Constructor
@@ -191,8 +220,23 @@ public: // interface
               int stale_depth, const str_vec_t &passive_list,
               EFlt3DArray *interface_velocity) const;
 
+  std::vector<std::string> lut_ordered_keys() const noexcept
+  { return enzo_riemann_utils::lut_ordered_keys<LUT>(0); }
+
 protected : //methods
-  
+
+  /// Computes the Riemann Fluxes for a batch of `W` neighboring cell
+  /// interfaces along a single row, starting at index `ix`.
+  ///
+  /// The values of the left and right states are gathered into instances of
+  /// `lutbatch<LUT,W>`, and their conserved forms, their fluxes and the
+  /// Riemann fluxes are computed for all lanes at once. The scalar remainder
+  /// of a row is handled by using `W=1`.
+  template <std::size_t W>
+  void solve_batch_(const ImplFunctor &func, const RowPtrs_ &row, int ix,
+                    bool barotropic, enzo_float gamma,
+                    enzo_float isothermal_cs) const noexcept;
+
   /// Computes the fluxes for the passively advected quantites.
   void solve_passive_advection_(EnzoEFltArrayMap &prim_map_l,
                                 EnzoEFltArrayMap &prim_map_r,
@@ -328,50 +372,45 @@ void EnzoRiemannImpl<ImplFunctor>::solve
   wr_arrays = load_array_of_fields<LUT>(prim_map_r, dim);
   flux_arrays = load_array_of_fields<LUT>(flux_map, dim);
 
+  // pressure_array_l and pressure_array_r are passed by const reference. We
+  // make shallow copies so that we can directly access their data
+  EFlt3DArray pressure_arr_l = pressure_array_l;
+  EFlt3DArray pressure_arr_r = pressure_array_r;
+
   ImplFunctor func;
 
-  // compute the flux at all non-stale cell interfaces
+  // compute the flux at all non-stale cell interfaces. Along the x-axis, the
+  // interfaces are processed in batches of batch_width_. The interfaces at the
+  // end of a row that don't fill a full batch are handled one at a time.
   const int sd = stale_depth;
+  const int ix_start = sd;
+  const int ix_stop = flux_arrays[0].shape(2) - sd;
+  const int nbatch = (int)batch_width_;
+
+  RowPtrs_ row;
   for (int iz = sd; iz < flux_arrays[0].shape(0) - sd; iz++) {
     for (int iy = sd; iy < flux_arrays[0].shape(1) - sd; iy++) {
-      for (int ix = sd; ix < flux_arrays[0].shape(2) - sd; ix++) {
-
-	lutarray<LUT> wl, wr;
-	// get the fluid fields
-	for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
-	  wl[field_ind] = wl_arrays[field_ind](iz,iy,ix);
-	  wr[field_ind] = wr_arrays[field_ind](iz,iy,ix);
-	}
-
-	// get the left/right pressure
-	enzo_float pressure_l = pressure_array_l(iz,iy,ix);
-	enzo_float pressure_r = pressure_array_r(iz,iy,ix);
-
-	// get the conserved quantities
-	lutarray<LUT> Ul = enzo_riemann_utils::compute_conserved<LUT>(wl);
-	lutarray<LUT> Ur = enzo_riemann_utils::compute_conserved<LUT>(wr);
-
-	// compute the interface fluxes
-	lutarray<LUT> Fl = enzo_riemann_utils::active_fluxes<LUT>(wl, Ul,
-                                                                  pressure_l);
-	lutarray<LUT> Fr = enzo_riemann_utils::active_fluxes<LUT>(wr, Ur,
-                                                                  pressure_r);
-
-	enzo_float interface_velocity_i;
-	// Now compute the Riemann Fluxes
-        lutarray<LUT> fluxes = func(Fl, Fr, wl, wr, Ul, Ur, pressure_l,
-                                    pressure_r, barotropic, gamma,
-                                    isothermal_cs, interface_velocity_i);
-
-	// record the Riemann Fluxes
-	for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
-	  flux_arrays[field_ind](iz,iy,ix) = fluxes[field_ind];
-	}
-
-	if (store_interface_vel){
-	  velocity_i_bar_array(iz,iy,ix) = interface_velocity_i;
-	}
+
+      // all arrays have unit stride along the x-axis
+      for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
+        row.wl[field_ind] = &(wl_arrays[field_ind](iz,iy,0));
+        row.wr[field_ind] = &(wr_arrays[field_ind](iz,iy,0));
+        row.flux[field_ind] = &(flux_arrays[field_ind](iz,iy,0));
+      }
+      row.pressure_l = &(pressure_arr_l(iz,iy,0));
+      row.pressure_r = &(pressure_arr_r(iz,iy,0));
+      row.vi_bar = (store_interface_vel) ? &(velocity_i_bar_array(iz,iy,0))
+                                         : nullptr;
+
+      int ix = ix_start;
+      for (; ix + nbatch <= ix_stop; ix += nbatch) {
+        solve_batch_<batch_width_>(func, row, ix, barotropic, gamma,
+                                   isothermal_cs);
       }
+      for (; ix < ix_stop; ix++) {
+        solve_batch_<1>(func, row, ix, barotropic, gamma, isothermal_cs);
+      }
+
     }
   }
 
@@ -389,44 +428,125 @@ void EnzoRiemannImpl<ImplFunctor>::solve
 
 //----------------------------------------------------------------------
 
-inline void passive_advection_helper_
-(const str_vec_t &passive_keys,
- EnzoEFltArrayMap& prim_map_l, EnzoEFltArrayMap& prim_map_r,
- EnzoEFltArrayMap& flux_map, const EFlt3DArray &density_flux,
- int stale_depth) noexcept
+template <class ImplFunctor>
+template <std::size_t W>
+void EnzoRiemannImpl<ImplFunctor>::solve_batch_
+(const ImplFunctor &func, const RowPtrs_ &row, int ix, bool barotropic,
+ enzo_float gamma, enzo_float isothermal_cs) const noexcept
 {
-  std::size_t num_keys = passive_keys.size();
-  if (num_keys == 0) {return;}
-
-  // This was essentially transcribed from hydro_rk in Enzo:
+  lutbatch<LUT,W> wl, wr, Ul, Ur, Fl, Fr;
+  std::array<enzo_float,W> pressure_l, pressure_r;
+
+  // get the fluid fields and the left/right pressure
+  for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
+    const enzo_float* wl_ptr = row.wl[field_ind] + ix;
+    const enzo_float* wr_ptr = row.wr[field_ind] + ix;
+    for (std::size_t lane = 0; lane < W; lane++){
+      wl[field_ind][lane] = wl_ptr[lane];
+      wr[field_ind][lane] = wr_ptr[lane];
+    }
+  }
+  for (std::size_t lane = 0; lane < W; lane++){
+    pressure_l[lane] = row.pressure_l[ix + lane];
+    pressure_r[lane] = row.pressure_r[ix + lane];
+  }
 
-  // load array of fields
-  EFlt3DArray *wl_arrays = new EFlt3DArray[num_keys];
-  EFlt3DArray *wr_arrays = new EFlt3DArray[num_keys];
-  EFlt3DArray *flux_arrays = new EFlt3DArray[num_keys];
+  // get the conserved quantities
+  enzo_riemann_utils::compute_conserved_batch<LUT,W>(wl, Ul);
+  enzo_riemann_utils::compute_conserved_batch<LUT,W>(wr, Ur);
+
+  // compute the interface fluxes
+  enzo_riemann_utils::active_fluxes_batch<LUT,W>(wl, Ul, pressure_l, Fl);
+  enzo_riemann_utils::active_fluxes_batch<LUT,W>(wr, Ur, pressure_r, Fr);
+
+  // Now compute the Riemann Fluxes of each lane
+  lutbatch<LUT,W> fluxes;
+  std::array<enzo_float,W> interface_velocity_i;
+  func(Fl, Fr, wl, wr, Ul, Ur, pressure_l, pressure_r, barotropic, gamma,
+       isothermal_cs, fluxes, interface_velocity_i);
+
+  // record the Riemann Fluxes
+  for (std::size_t field_ind=0; field_ind<LUT::NEQ; field_ind++){
+    enzo_float* flux_ptr = row.flux[field_ind] + ix;
+    for (std::size_t lane = 0; lane < W; lane++){
+      flux_ptr[lane] = fluxes[field_ind][lane];
+    }
+  }
 
-  for (std::size_t ind=0; ind<num_keys; ind++){
-    wl_arrays[ind] = prim_map_l.at(passive_keys[ind]);
-    wr_arrays[ind] = prim_map_r.at(passive_keys[ind]);
-    flux_arrays[ind] = flux_map.at(passive_keys[ind]);
+  if (row.vi_bar != nullptr){
+    for (std::size_t lane = 0; lane < W; lane++){
+      row.vi_bar[ix + lane] = interface_velocity_i[lane];
+    }
   }
+}
+
+//----------------------------------------------------------------------
+
+/// Computes the upwind fluxes for a batch of `num_keys` passively advected
+/// quantities in a single sweep over the interfaces.
+///
+/// Each row of `density_flux` is loaded once and is reused (from cache) to
+/// compute the fluxes of every quantity in the batch. For a given quantity,
+/// the loop over the x-axis is free of branches and indirection (the upwind
+/// value is selected with a conditional expression) so that it can be
+/// vectorized.
+inline void passive_advection_batch_
+(EFlt3DArray wl_arrays[], EFlt3DArray wr_arrays[], EFlt3DArray flux_arrays[],
+ std::size_t num_keys, EFlt3DArray density_flux, int stale_depth) noexcept
+{
+  // This was essentially transcribed from hydro_rk in Enzo:
   const int sd = stale_depth;
+  const int ix_stop = density_flux.shape(2) - sd;
   for (int iz = sd; iz < density_flux.shape(0) - sd; iz++) {
     for (int iy = sd; iy < density_flux.shape(1) - sd; iy++) {
 
-      for (int key_ind=0; key_ind<num_keys; key_ind++){
-        for (int ix = sd; ix < density_flux.shape(2) - sd; ix++) {
-          enzo_float dens_flux = density_flux(iz,iy,ix);
-          enzo_float wl = wl_arrays[key_ind](iz,iy,ix);
-          enzo_float wr = wr_arrays[key_ind](iz,iy,ix);
-          enzo_float w_upwind = (dens_flux>0) ? wl : wr;
-          flux_arrays[key_ind](iz,iy,ix) = w_upwind * dens_flux;
-	}
+      // all arrays have unit stride along the x-axis
+      const enzo_float* dens_flux = &(density_flux(iz,iy,0));
+
+      for (std::size_t key_ind=0; key_ind<num_keys; key_ind++){
+        const enzo_float* wl = &(wl_arrays[key_ind](iz,iy,0));
+        const enzo_float* wr = &(wr_arrays[key_ind](iz,iy,0));
+        enzo_float* flux = &(flux_arrays[key_ind](iz,iy,0));
+        for (int ix = sd; ix < ix_stop; ix++) {
+          enzo_float w_upwind = (dens_flux[ix] > 0) ? wl[ix] : wr[ix];
+          flux[ix] = w_upwind * dens_flux[ix];
+        }
       }
 
     }
   }
-  delete[] wl_arrays; delete[] wr_arrays; delete[] flux_arrays;
+}
+
+//----------------------------------------------------------------------
+
+inline void passive_advection_helper_
+(const str_vec_t &passive_keys,
+ EnzoEFltArrayMap& prim_map_l, EnzoEFltArrayMap& prim_map_r,
+ EnzoEFltArrayMap& flux_map, const EFlt3DArray &density_flux,
+ int stale_depth) noexcept
+{
+  std::size_t num_keys = passive_keys.size();
+  if (num_keys == 0) {return;}
+
+  // The quantities are processed in batches of (up to) max_batch_size. The
+  // (shallow copies of the) arrays of each batch are held in fixed-size
+  // arrays on the stack, so that nothing needs to be allocated on the heap
+  const std::size_t max_batch_size = 16;
+  EFlt3DArray wl_arrays[max_batch_size];
+  EFlt3DArray wr_arrays[max_batch_size];
+  EFlt3DArray flux_arrays[max_batch_size];
+
+  for (std::size_t start = 0; start < num_keys; start += max_batch_size){
+    std::size_t batch_size = std::min(max_batch_size, num_keys - start);
+    for (std::size_t ind=0; ind<batch_size; ind++){
+      const std::string &key = passive_keys[start + ind];
+      wl_arrays[ind] = prim_map_l.at(prim_map_l.index(key));
+      wr_arrays[ind] = prim_map_r.at(prim_map_r.index(key));
+      flux_arrays[ind] = flux_map.at(flux_map.index(key));
+    }
+    passive_advection_batch_(wl_arrays, wr_arrays, flux_arrays, batch_size,
+                             density_flux, stale_depth);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -18,6 +18,45 @@ using lutarray = std::array<enzo_float, LUT::NEQ>;
 
 //----------------------------------------------------------------------
 
+/// @typedef lutbatch
+/// @brief   Structure-of-arrays counterpart to lutarray that holds the
+///          enzo_floats associated with lookup tables for a batch of `W`
+///          neighboring cell interfaces (used with Riemann solvers)
+///
+/// The value of quantity `LUT::density` at the interface occupying position
+/// `lane` of a batch, `batch`, is accessed with `batch[LUT::density][lane]`.
+/// Because the values of a single quantity are stored contiguously, loops over
+/// the lanes of a batch can be vectorized by the compiler.
+template<class LUT, std::size_t W>
+using lutbatch = std::array<std::array<enzo_float, W>, LUT::NEQ>;
+
+//----------------------------------------------------------------------
+
+template<class LUT, std::size_t W>
+class lutbatch_lane{
+  /// @class    lutbatch_lane
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Provides read-only, lutarray-like access to the
+  ///           values held by a single lane of a lutbatch
+  ///
+  /// This lets functions written against the lutarray interface (namely the
+  /// functors used by EnzoRiemannImpl) operate on values stored within a
+  /// lutbatch without first copying them into a lutarray.
+public:
+  lutbatch_lane(const lutbatch<LUT,W> &batch, std::size_t lane) noexcept
+    : batch_(batch), lane_(lane)
+  { }
+
+  inline enzo_float operator[](std::size_t i) const noexcept
+  { return batch_[i][lane_]; }
+
+private:
+  const lutbatch<LUT,W> &batch_;
+  const std::size_t lane_;
+};
+
+//----------------------------------------------------------------------
+
 // Yields a combined token
 #define COMBINE(prefix, suffix) prefix##suffix
 #define COMBINE3(first, second, third) first##second##third
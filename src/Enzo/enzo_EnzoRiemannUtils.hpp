@@ -50,8 +50,8 @@ namespace enzo_riemann_utils{
 
   //----------------------------------------------------------------------
 
-  template <class LUT>
-  inline enzo_float mag_pressure(const lutarray<LUT> prim) noexcept
+  template <class LUT, class Arr = lutarray<LUT>>
+  inline enzo_float mag_pressure(const Arr &prim) noexcept
   {
     enzo_float bi = (LUT::bfield_i >= 0) ? prim[LUT::bfield_i] : 0;
     enzo_float bj = (LUT::bfield_j >= 0) ? prim[LUT::bfield_j] : 0;
@@ -61,15 +61,15 @@ namespace enzo_riemann_utils{
 
   //----------------------------------------------------------------------
 
-  template <class LUT>
-  inline enzo_float sound_speed(const lutarray<LUT> prim_vals,
+  template <class LUT, class Arr = lutarray<LUT>>
+  inline enzo_float sound_speed(const Arr &prim_vals,
                                 enzo_float pressure, enzo_float gamma) noexcept
   { return std::sqrt(gamma * pressure / prim_vals[LUT::density]); }
 
   //----------------------------------------------------------------------
 
-  template <class LUT>
-  inline enzo_float fast_magnetosonic_speed(const lutarray<LUT> prim_vals,
+  template <class LUT, class Arr = lutarray<LUT>>
+  inline enzo_float fast_magnetosonic_speed(const Arr &prim_vals,
                                             enzo_float pressure,
                                             enzo_float gamma) noexcept
   {
@@ -80,24 +80,24 @@ namespace enzo_riemann_utils{
     // TODO: optimize calc of cs2 to omit sqrt and pow
     //       can also skip the calculation of B2 by checking if
     //       LUT::bfield_i, LUT::bfield_j, LUT::bfield_k are all negative
-    enzo_float cs2 = std::pow(sound_speed<LUT>(prim_vals, pressure, gamma),2);
+    enzo_float cs2 = std::pow(sound_speed<LUT,Arr>(prim_vals, pressure, gamma),2);
     enzo_float B2 = (bi*bi + bj*bj + bk *bk);
-    if (B2 == 0){
-      return std::sqrt(cs2);
-    }
     enzo_float va2 = B2/prim_vals[LUT::density];
     // TODO: replace va2 * cos2 with va2_cos2 = bi*bi/prim_vals[LUT::density]
     enzo_float cos2 = bi*bi / B2;
-    return std::sqrt(0.5*(va2+cs2+std::sqrt(std::pow(cs2+va2,2) -
-                                            4.*cs2*va2*cos2)));
+    // the result is selected (rather than returning early when B2 is 0) so
+    // that loops over the lanes of a batch that call this can be vectorized
+    return (B2 == 0) ? std::sqrt(cs2)
+                     : std::sqrt(0.5*(va2+cs2+std::sqrt(std::pow(cs2+va2,2) -
+                                                        4.*cs2*va2*cos2)));
   }
 
   //----------------------------------------------------------------------
 
   /// This function should be called when we to fix cos2 to some predetermined
   /// value
-  template <class LUT>
-  inline enzo_float fast_magnetosonic_speed(const lutarray<LUT> prim_vals,
+  template <class LUT, class Arr = lutarray<LUT>>
+  inline enzo_float fast_magnetosonic_speed(const Arr &prim_vals,
                                             enzo_float pressure,
                                             enzo_float gamma,
                                             enzo_float cos2) noexcept
@@ -109,14 +109,12 @@ namespace enzo_riemann_utils{
     // TODO: optimize calc of cs2 to omit sqrt and pow
     //       can also skip the calculation of B2 by checking if
     //       LUT::bfield_i, LUT::bfield_j, LUT::bfield_k are all negative
-    enzo_float cs2 = std::pow(sound_speed<LUT>(prim_vals, pressure, gamma),2);
+    enzo_float cs2 = std::pow(sound_speed<LUT,Arr>(prim_vals, pressure, gamma),2);
     enzo_float B2 = (bi*bi + bj*bj + bk *bk);
-    if (B2 == 0){
-      return std::sqrt(cs2);
-    }
     enzo_float va2 = B2/prim_vals[LUT::density];
-    return std::sqrt(0.5*(va2+cs2+std::sqrt(std::pow(cs2+va2,2) -
-                                            4.*cs2*va2*cos2)));
+    return (B2 == 0) ? std::sqrt(cs2)
+                     : std::sqrt(0.5*(va2+cs2+std::sqrt(std::pow(cs2+va2,2) -
+                                                        4.*cs2*va2*cos2)));
   }
 
   //----------------------------------------------------------------------
@@ -166,6 +164,75 @@ namespace enzo_riemann_utils{
 
   //----------------------------------------------------------------------
 
+  /// Batched counterpart of compute_conserved. This computes the conserved
+  /// counterparts of the integrable primitives for every lane of a batch of
+  /// cell interfaces. The innermost loops run over the lanes of the batch so
+  /// that they can be vectorized.
+  template <class LUT, std::size_t W>
+  inline void compute_conserved_batch(const lutbatch<LUT,W> &prim,
+                                      lutbatch<LUT,W> &cons) noexcept
+  {
+    for (std::size_t i = 0; i < LUT::specific_start; i++) {
+      for (std::size_t lane = 0; lane < W; lane++){
+        cons[i][lane] = prim[i][lane];
+      }
+    }
+
+    for (std::size_t i = LUT::specific_start; i < LUT::NEQ; i++) {
+      for (std::size_t lane = 0; lane < W; lane++){
+        cons[i][lane] = prim[i][lane] * prim[LUT::density][lane];
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Batched counterpart of active_fluxes. This computes fluxes for the basic
+  /// mhd conserved quantities for every lane of a batch of cell interfaces.
+  /// The arithmetic is identical to that of active_fluxes.
+  template <class LUT, std::size_t W>
+  inline void active_fluxes_batch(const lutbatch<LUT,W> &prim,
+                                  const lutbatch<LUT,W> &cons,
+                                  const std::array<enzo_float,W> &pressure,
+                                  lutbatch<LUT,W> &fluxes) noexcept
+  {
+    for (std::size_t lane = 0; lane < W; lane++){
+      enzo_float vi, vj, vk, p, Bi, Bj, Bk, etot, magnetic_pressure;
+      vi = prim[LUT::velocity_i][lane];
+      vj = prim[LUT::velocity_j][lane];
+      vk = prim[LUT::velocity_k][lane];
+
+      Bi = (LUT::bfield_i >= 0) ? prim[LUT::bfield_i][lane] : 0;
+      Bj = (LUT::bfield_j >= 0) ? prim[LUT::bfield_j][lane] : 0;
+      Bk = (LUT::bfield_k >= 0) ? prim[LUT::bfield_k][lane] : 0;
+      etot = (LUT::total_energy >= 0) ? cons[LUT::total_energy][lane] : 0;
+
+      p = pressure[lane];
+
+      magnetic_pressure = 0.5 * (Bi*Bi + Bj*Bj + Bk *Bk);
+
+      // Compute Fluxes
+      enzo_float mom_i = cons[LUT::velocity_i][lane];
+      fluxes[LUT::density][lane] = mom_i;
+
+      // Fluxes for Mx, My, Mz
+      fluxes[LUT::velocity_i][lane] = mom_i*vi - Bi*Bi + p + magnetic_pressure;
+      fluxes[LUT::velocity_j][lane] = mom_i*vj - Bj*Bi;
+      fluxes[LUT::velocity_k][lane] = mom_i*vk - Bk*Bi;
+
+      // Flux for etot
+      fluxes[LUT::total_energy][lane] = ((etot + p + magnetic_pressure)*vi
+                                         - (Bi*vi + Bj*vj + Bk*vk)*Bi);
+
+      // Fluxes for Bi,Bj,Bk
+      if (LUT::bfield_i >= 0) { fluxes[LUT::bfield_i][lane] = 0; }
+      if (LUT::bfield_j >= 0) { fluxes[LUT::bfield_j][lane] = Bj*vi - Bi*vj; }
+      if (LUT::bfield_k >= 0) { fluxes[LUT::bfield_k][lane] = Bk*vi - Bi*vk; }
+    }
+  }
+
+  //----------------------------------------------------------------------
+
   inline std::string parse_mem_name_(std::string member_name,
                                      EnzoPermutedCoordinates coord)
   {
@@ -194,6 +261,29 @@ namespace enzo_riemann_utils{
 
   //----------------------------------------------------------------------
 
+  /// Returns the keys of the quantities included in the LUT, ordered by their
+  /// indices in the LUT
+  ///
+  /// @param dim Specifies which dimension is the ith direction. This has the
+  ///   same meaning as the corresponding argument of `load_array_of_fields`.
+  template<class LUT>
+  inline std::vector<std::string> lut_ordered_keys(int dim) noexcept
+  {
+    std::vector<std::string> keys(LUT::NEQ);
+    EnzoPermutedCoordinates coord( (dim == -1) ? 0 : dim);
+
+    auto fn = [coord, &keys](std::string name, int index)
+      {
+        if (index != -1){ keys[index] = parse_mem_name_(name, coord); }
+      };
+
+    LUT::for_each_entry(fn);
+
+    return keys;
+  }
+
+  //----------------------------------------------------------------------
+
   /// Constructs an array of instances of EFlt3DArray that is organized
   /// according to the LUT
   ///
@@ -219,7 +309,9 @@ namespace enzo_riemann_utils{
     //                            2. the associated index
     auto fn = [coord, &arr, &map](std::string name, int index)
       {
-        if (index != -1){ arr[index] = map.at(parse_mem_name_(name, coord)); }
+        if (index != -1){
+          arr[index] = map.at(map.index(parse_mem_name_(name, coord)));
+        }
       };
 
     LUT::for_each_entry(fn);
@@ -28,6 +28,27 @@
 /// LINE 15:     beta = (R*R0) / beta_n * (alpha/omega)
 /// LINE 16:     P = R + beta * (P - omega * V)
 /// LINE 17:  end for
+///
+/// Each iteration normally requires three global reductions: one for
+/// LINE 07, one for LINE 12, and one for R*R (the residual norm) and
+/// R*R0 (LINE 15).  If expand_residual_dots_ is set, the last reduction is
+/// combined with the one for LINE 12: since R = Q - omega * U,
+///
+///     R*R  = Q*Q - 2 * omega * (U*Q) + omega^2 * (U*U)
+///     R*R0 = Q*R0 - omega * (U*R0)
+///
+/// so Q*Q, Q*R0 and U*R0 are reduced together with U*Q and U*U.  These
+/// expansions lose accuracy as R becomes small relative to Q, so once
+/// they indicate convergence R*R and R*R0 are reduced explicitly, and
+/// the solver only stops if the true residual satisfies the tolerance.
+///
+/// This only removes one of the three reductions; it is not a pipelined
+/// BiCgStab.  The remaining reductions (LINE 07 and LINE 12) still block,
+/// and are not overlapped with the matrix-vector products or refreshes:
+/// alpha is needed to form Q, and omega to update X and R.  Pipelined
+/// variants avoid this by applying the recurrences to preconditioned
+/// vectors, which requires M to be a linear operator, but here M is an
+/// iterative solver.
 
 #include "cello.hpp"
 #include "charm_simulation.hpp"
@@ -191,7 +212,8 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
  int min_level, int max_level,
  int iter_max, double res_tol,
  int index_precon,
- int coarse_level
+ int coarse_level,
+ bool expand_residual_dots
  ) 
   : Solver(name,
 	   field_x,
@@ -210,6 +232,7 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
     m_(0), mx_(0), my_(0), mz_(0),
     gx_(0), gy_(0), gz_(0),
     coarse_level_(coarse_level),
+    expand_residual_dots_(expand_residual_dots),
     ir_loop_3_(-1),
     ir_loop_9_(-1)
 {
@@ -242,18 +265,13 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   is_vs_ =     scalar_descr_quad->new_value("solver_bicgstab_vs");
   is_us_ =     scalar_descr_quad->new_value("solver_bicgstab_us");
   is_qs_ =     scalar_descr_quad->new_value("solver_bicgstab_qs");
+  is_qq_ =     scalar_descr_quad->new_value("solver_bicgstab_qq");
+  is_qr0_ =    scalar_descr_quad->new_value("solver_bicgstab_qr0");
+  is_ur0_ =    scalar_descr_quad->new_value("solver_bicgstab_ur0");
 
-  if (solve_type == solve_tree) {
-   
-    ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
-    is_dot_sync_ = scalar_descr_sync->new_value("solver_bicgstab_dot_sync");
-
-  } else {
-    is_dot_sync_ = -1;
-  }
-  
   ScalarDescr * scalar_descr_int = cello::scalar_descr_int();
   is_iter_ = scalar_descr_int->new_value("solver_bicgstab_iter");
+  is_function_ = scalar_descr_int->new_value("solver_bicgstab_function");
 
   FieldDescr * field_descr = cello::field_descr();
 
@@ -302,8 +320,11 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | is_vs_;
     p | is_us_;
     p | is_qs_;
-    p | is_dot_sync_;
+    p | is_function_;
     p | is_iter_;
+    p | is_qq_;
+    p | is_qr0_;
+    p | is_ur0_;
 
     p | res_tol_;
     p | index_precon_;
@@ -327,6 +348,7 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | gz_;
 
     p | coarse_level_;
+    p | expand_residual_dots_;
     p | ir_loop_3_;
     p | ir_loop_9_;
   }
@@ -354,10 +376,6 @@ void EnzoSolverBiCgStab::apply
     
   } else {
 
-    if (solve_type_ == solve_tree) {
-      s_dot_sync_(enzo_block) = cello::num_children();
-    }
-  
     A_ = A;
 
     Field field = block->data()->field();
@@ -405,36 +423,17 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
   enzo_float* U   = (enzo_float*) field.values(iu_);
 
   COPY_FIELD(block,ib_,"B0_bcg");
-  for (int i=0; i<m_; i++) {
-    X[i] = R[i] = R0[i] = P[i] = 0.0;
-    Y[i] = V[i] = Q[i] =  U[i] = 0.0;
-  }
-
-  if (is_finest_(block)) {
-
-    const bool reuse_x = reuse_solution_ (block->cycle());
-#ifdef TRACE_SOLVER_BCG      
-    if (CkMyPe()==0) {
-      CkPrintf ("DEBUG_SOLVER_BCG reusing solution X <- X_copy \n");
-      fflush(stdout);
-    }
-#endif    
-    if ( reuse_x ) {
-#ifdef TRACE_SOLVER_BCG      
-
-      if (CkMyPe()==0) {
-        CkPrintf ("DEBUG_SOLVER_BCG reusing solution X <- X_copy \n");
-        fflush(stdout);
-      }
-#endif      
 
-      enzo_float* X_copy  = (enzo_float*) field.values("X_copy");
+  /// if reusing the solution, keep the initial guess X supplied by
+  /// the caller (e.g. the previous or extrapolated potential); the
+  /// residual is computed from X in start_2()
 
-      for (int i=0; i<m_; i++) X[i] = X_copy[i];
+  const bool reuse_x = is_finest_(block) && reuse_solution_ (block->cycle());
 
-      A_->residual (ir_, ib_, ix_, block);
-      
-    }
+  for (int i=0; i<m_; i++) {
+    if (! reuse_x) X[i] = 0.0;
+    R[i] = R0[i] = P[i] = 0.0;
+    Y[i] = V[i] = Q[i] =  U[i] = 0.0;
   }
 
   /// for singular Poisson problems, N(A) is not empty, so project B
@@ -470,15 +469,6 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
     /// and count over all blocks, and continue with
     /// r_solver_bicgstab_start_1()
     
-    std::vector<int> is_array;
-
-    if (solve_type_ == solve_tree) {
-      is_array.resize(3);
-      is_array[0] = is_c_;
-      is_array[1] = is_bs_;
-      is_array[2] = is_xs_;
-    }
-
     CkCallback callback
       (CkIndex_EnzoBlock::r_solver_bicgstab_start_1(NULL),
        block->proxy_array());
@@ -490,7 +480,7 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
 #endif    
 
     TRACE_DOT(block,"start",0);
-    inner_product_(block,3,&reduce[0],is_array,callback,bcg_start_2);
+    inner_product_(block,3,&reduce[0],callback,bcg_start_2);
 
   } else {
 
@@ -595,14 +585,6 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
   /// initiate callback for r_solver_bicgstab_start_3, compute reductions
   /// over all blocks, and continue with r_solver_bicgstab_start_3()
 
-  std::vector<int> is_array;
-  if (solve_type_ == solve_tree) {
-    is_array.resize(3);
-    is_array[0] = is_beta_n_;
-    is_array[1] = is_bnorm_;
-    is_array[2] = is_r0s_;
-  }
-
   CkCallback callback (CkIndex_EnzoBlock::r_solver_bicgstab_start_3(NULL), 
 		       block->proxy_array());
 #ifdef DEBUG_CALLBACK    
@@ -613,7 +595,7 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
 
 
   TRACE_DOT(block,"start",1);
-  inner_product_(block,3,&reduce[0],is_array,callback,bcg_loop_0a);
+  inner_product_(block,3,&reduce[0],callback,bcg_loop_0a);
 
 }
 
@@ -992,14 +974,6 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   /// contribute to global sums over blocks, and return
   /// r_solver_bicgstab_loop_5()
 
-  std::vector<int> is_array;
-  if (solve_type_ == solve_tree) {
-    is_array.resize(3);
-    is_array[0] = is_vr0_;
-    is_array[1] = is_ys_;
-    is_array[2] = is_vs_;
-  }
-
   CkCallback callback = CkCallback
     (CkIndex_EnzoBlock::r_solver_bicgstab_loop_5(NULL), 
      block->proxy_array());
@@ -1010,7 +984,7 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
     fflush(stdout);
 #endif    
   TRACE_DOT(block,"start",2);
-  inner_product_(block,3,&reduce[0],is_array,callback,bcg_loop_6);
+  inner_product_(block,3,&reduce[0],callback,bcg_loop_6);
 }
 
 //----------------------------------------------------------------------
@@ -1248,10 +1222,12 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 
   COPY_FIELD(block,iu_,"U");
 
+  const int n = expand_residual_dots_ ? 8 : 5;
+
   std::vector<long double> reduce;
-  reduce.resize(5+1);
+  reduce.resize(n+1);
   reduce.clear();
-  reduce[0] = 5;
+  reduce[0] = n;
   
   if (is_finest_(block)) {
     
@@ -1270,6 +1246,26 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 	}
       }
     }
+
+    if (expand_residual_dots_) {
+
+      enzo_float* R0 = (enzo_float*) field.values(ir0_);
+
+      /// qq  = DOT(Q, Q)
+      /// qr0 = DOT(Q, R0)
+      /// ur0 = DOT(U, R0)
+
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    reduce[6] += Q[i]*Q[i];
+	    reduce[7] += Q[i]*R0[i];
+	    reduce[8] += U[i]*R0[i];
+	  }
+	}
+      }
+    }
   
     /// for singular Poisson problems, project both Y and U into R(A)
 
@@ -1296,16 +1292,6 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
   
   /// compute sums over Blocks and continue with r_solver_bicgstab_loop_11()
 
-  std::vector<int> is_array;
-  if (solve_type_ == solve_tree) {
-    is_array.resize(5);
-    is_array[0] = is_omega_n_;
-    is_array[1] = is_omega_d_;
-    is_array[2] = is_ys_;
-    is_array[3] = is_us_;
-    is_array[4] = is_qs_;
-  }
-
 #ifdef DEBUG_REDUCE  
   CkPrintf ("DEBUG_REDUCE %s %s:%d %Lg %Lg %Lg %Lg %Lg\n",
 	    block->name().c_str(),__FILE__,__LINE__,
@@ -1324,7 +1310,7 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 #endif    
 
   TRACE_DOT(block,"start",3);
-  inner_product_(block,5,&reduce[0],is_array,callback,bcg_loop_12);
+  inner_product_(block,n,&reduce[0],callback,bcg_loop_12);
     
 }
 
@@ -1348,14 +1334,20 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 
   if (solve_type_ != solve_tree && msg != NULL) {
     long double* data = (long double*) msg->getData();
-    ASSERT1("EnzoSolverBiCgStab::loop_12",
-	    "Expecting (data[0] = %Lg) == 5",
-	    data[0],(data[0] == 5));
+    const int n = expand_residual_dots_ ? 8 : 5;
+    ASSERT2("EnzoSolverBiCgStab::loop_12",
+	    "Expecting (data[0] = %Lg) == %d",
+	    data[0],n,(data[0] == n));
     S(omega_n) = data[1];
     S(omega_d) = data[2];
     S(ys)      = data[3];
     S(us)      = data[4];
     S(qs)      = data[5];
+    if (expand_residual_dots_) {
+      S(qq)    = data[6];
+      S(qr0)   = data[7];
+      S(ur0)   = data[8];
+    }
   }
 
   delete msg;
@@ -1381,6 +1373,7 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 
     S(omega_n) -= us*qs/ S(c);
     S(omega_d) -= us*us/ S(c);
+    // (R0 is already in R(A), so shifting U leaves DOT(U,R0) unchanged)
 
     if (is_finest_(block)) {
       enzo_float* Y = (enzo_float*) field.values(iy_);
@@ -1394,6 +1387,11 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
     }
   }
   
+  /// inner products of the (projected) U used to expand DOT(R,R)
+
+  const long double uq = S(omega_n);
+  const long double uu = S(omega_d);
+
   /// avoid division by 0.0
   
   if (S(omega_d) == 0.0)  S(omega_d) = 1.0;
@@ -1446,6 +1444,31 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   /// Update previous beta value (beta_d_) to current value (beta_n_)
   
   S(beta_d) = S(beta_n);
+
+  if (expand_residual_dots_) {
+
+    /// rr_     = DOT(Q - omega*U, Q - omega*U)
+    /// beta_n = DOT(Q - omega*U, R0)
+
+    const long double omega = S(omega);
+    const long double rr =
+      S(qq) - 2.0*omega*uq + omega*omega*uu;
+    const long double beta_n = S(qr0) - omega*S(ur0);
+
+    /// reduce DOT(R,R) explicitly if the expansion indicates
+    /// convergence, since it may be inaccurate for small residuals
+    
+    const bool is_converged = (rr <= 0.0) ||
+      (sqrt(rr) / S(rho0) < res_tol_);
+
+    if (! is_converged) {
+      S(rr)     = rr;
+      S(beta_n) = beta_n;
+      TRACE_DOT(block,"expanded",4);
+      loop_14(block,nullptr);
+      return;
+    }
+  }
   
   /// rr_     = DOT(R, R)
   /// beta_n = DOT(R, R0)
@@ -1473,13 +1496,6 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 
   /// sum over blocks and continue with r_solver_bicgstab_loop_13()
   
-  std::vector<int> is_array;
-  if (solve_type_ == solve_tree) {
-    is_array.resize(2);
-    is_array[0] = is_rr_;
-    is_array[1] = is_beta_n_;
-  }
-
   CkCallback callback = CkCallback
     (CkIndex_EnzoBlock::r_solver_bicgstab_loop_13(NULL), 
      block->proxy_array());
@@ -1491,7 +1507,7 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 #endif    
 
   TRACE_DOT(block,"start",4);
-  inner_product_(block,2,&reduce[0],is_array,callback,bcg_loop_14);
+  inner_product_(block,2,&reduce[0],callback,bcg_loop_14);
     
 }
 
@@ -1609,13 +1625,18 @@ void EnzoSolverBiCgStab::end (EnzoBlock* block, int retval) throw () {
 
 void EnzoSolverBiCgStab::inner_product_
 (EnzoBlock * block, int n, long double * reduce,
- const std::vector<int> & is_array,
  CkCallback callback,
  int i_function)
 {
   if (solve_type_ == solve_tree) {
     TRACE_BCG(block,this,"inner_product_A");
-    dot_compute_tree_(block,n,reduce+1,is_array,i_function,s_iter_(block));
+    // reduce over the subtree rooted at coarse_level_, then continue
+    // with i_function in dot_done()
+    s_function_(block) = i_function;
+    block->reduce_tree_start
+      (enzo_reduce_id_solver_bicgstab,
+       CkIndex_EnzoBlock::p_solver_bicgstab_dot_done(),
+       n, reduce+1, reduce_tree_sum, coarse_level_, false);
   } else {
     TRACE_BCG(block,this,"inner_product_B");
     block->contribute((n+1)*sizeof(long double), reduce, 
@@ -1625,208 +1646,34 @@ void EnzoSolverBiCgStab::inner_product_
 
 //----------------------------------------------------------------------
 
-void EnzoSolverBiCgStab::dot_compute_tree_(EnzoBlock * block,
-					   int n,
-					   long double * dot_local,
-					   const std::vector<int> & is_array,
-					   int i_function,
-                                           int iter)
-{
-  TRACE_DOT(block,"dot_compute_tree",i_function);
-  dot_clear_(block,n,is_array);
-
-  const int level = block->level();
-  if (level < coarse_level_) {
-    dot_done_(block,i_function,__FILE__,__LINE__);
-  } else if (is_finest_(block)) {
-    if (level > coarse_level_) {
-      dot_send_parent_(block,n,dot_local,is_array,i_function,iter);
-    } else {
-      s_iter_(block)=iter;
-      dot_save_(block,n, dot_local, is_array);
-      dot_done_(block,i_function,__FILE__,__LINE__);
-    }
-  }
-}
-
-//----------------------------------------------------------------------
-
-void EnzoSolverBiCgStab::dot_send_parent_(EnzoBlock * block,
-					  int n,
-					  long double * dot_block,
-					  const std::vector<int> & is_array,
-					  int i_function, int iter)
+void EnzoBlock::p_solver_bicgstab_dot_done()
 {
-  TRACE_DOT(block,"dot_send_parent",i_function);
-  ASSERT2("EnzoSolverBiCgStab::dot_send_parent()",
-	  "level %d must be > coarse_level = %d",
-	  block->level(), coarse_level_,
-	  (block->level() > coarse_level_));
-
-  Index index_parent = block->index().index_parent(min_level_);
-
-  enzo::block_array()[index_parent].p_dot_recv_parent
-    (n,dot_block, is_array,i_function, iter);
-
-}
-
-//----------------------------------------------------------------------
-
-void EnzoBlock::p_dot_recv_parent(int n, long double * dot_block,
-				  std::vector<int> is_array,
-				  int i_function, int iter)
-{
-  auto solver = static_cast<EnzoSolverBiCgStab*> (this->solver());
-
-  solver->dot_recv_parent(this,n,dot_block,is_array,i_function, iter);
-}
-
-//----------------------------------------------------------------------
-
-void EnzoSolverBiCgStab::dot_recv_parent(EnzoBlock * block,
-					 int n,
-					 long double * dot_block,
-					 const std::vector<int> & is_array,
-					 int i_function, int iter)
-{
-  
-  TRACE_DOT(block,"dot_recv_parent",i_function);
-  dot_increment_(block,n,is_array,dot_block);
-  
-  Sync & sync = s_dot_sync_(block);
-  if (sync.next()) {
-    dot_load_(block,n, dot_block, is_array);
-    if (block->level() > coarse_level_) {
-      //      dot_clear_(block,n,is_array);
-      dot_send_parent_(block,n,dot_block,is_array,i_function, iter);
-    } else {
-      s_iter_(block)=iter;
-      dot_send_children_(block,n,dot_block,is_array,i_function);
-      dot_done_(block,i_function,__FILE__,__LINE__);
-    }
-  }
-}
-
-//----------------------------------------------------------------------
-
-void EnzoSolverBiCgStab::dot_send_children_(EnzoBlock * block,
-					    int n,
-					    long double * dot_local,
-					    const std::vector<int> & is_array,
-					    int i_function)
-{
-  TRACE_DOT(block,"dot_send_children",i_function);
-  ItChild it_child(cello::rank());
-  int ic3[3];
-  while (it_child.next(ic3)) {
-
-    Index index_child = block->index().index_child(ic3,min_level_);
-
-    enzo::block_array()[index_child].p_dot_recv_children
-      (n,dot_local,is_array,i_function);
-
-  }
-}
-
-//----------------------------------------------------------------------
-
-void EnzoBlock::p_dot_recv_children(int n, long double * dot_block,
-				    std::vector<int> is_array,
-				    int i_function)
-{
-  auto solver = static_cast<EnzoSolverBiCgStab*> (this->solver());
-  solver->dot_recv_children(this,n,dot_block,is_array,i_function);
-}
-
-//----------------------------------------------------------------------
-
-void EnzoSolverBiCgStab::dot_recv_children(EnzoBlock * block,
-					   int n,
-					   long double * dot_local,
-					   const std::vector<int> & is_array,
-					   int i_function)
-{
-  TRACE_DOT(block,"dot_recv_children",i_function);
-  dot_save_(block,n, dot_local, is_array);
-  if (!is_finest_(block)) {
-    dot_send_children_(block,n,dot_local,is_array,i_function);
-  }
-  dot_done_(block,i_function,__FILE__,__LINE__);
-}
+  performance_start_(perf_compute,__FILE__,__LINE__);
 
-//----------------------------------------------------------------------
+  static_cast<EnzoSolverBiCgStab*> (solver())->dot_done(this);
 
-void EnzoSolverBiCgStab::dot_save_
-(EnzoBlock * block,int n, long double * data, const std::vector<int> & is_array)
-{
-  TRACE_DOT(block,"dot_save",-1);
-  Scalar<long double> scalar =
-    block->data()->scalar_long_double();
-  
-  for (int i=0; i<n; i++) {
-    *(scalar.value(is_array[i])) = data[i];
-  }
+  performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoSolverBiCgStab::dot_load_
-(EnzoBlock * block,int n, long double * data, const std::vector<int> & is_array)
+void EnzoSolverBiCgStab::dot_done(EnzoBlock * block)
 {
-  TRACE_DOT(block,"dot_load",-1);
-  Scalar<long double> scalar =
-    block->data()->scalar_long_double();
-  
-  for (int i=0; i<n; i++) {
-    data[i] = *(scalar.value(is_array[i]));
-  }
-}
+  const int i_function = s_function_(block);
 
-//----------------------------------------------------------------------
+  TRACE_DOT(block,"dot_done",i_function);
 
-void EnzoSolverBiCgStab::dot_clear_
-(EnzoBlock * block,int n, const std::vector<int> & is_array)
-{
-  Scalar<long double> scalar =
-    block->data()->scalar_long_double();
-  
-  for (int i=0; i<n; i++) {
-    *(scalar.value(is_array[i])) = 0.0;
-  }
-}
+  // save reduced values in the corresponding ScalarData
 
-//----------------------------------------------------------------------
+  const std::vector<long double> & result =
+    block->reduce_tree_result(enzo_reduce_id_solver_bicgstab);
 
-void EnzoSolverBiCgStab::dot_clear_
-(EnzoBlock * block,int n, long double * array)
-{
-  for (int i=0; i<n; i++) array[i] = 0.0;
-}
+  const std::vector<int> is_array = dot_scalars_(i_function);
 
-//----------------------------------------------------------------------
-
-void EnzoSolverBiCgStab::dot_increment_
-(EnzoBlock * block,
- int n,
- const std::vector<int> & is_array,
- long double * dot_block)
-{
-  TRACE_DOT(block,"dot_increment",-1);
-  Scalar<long double> scalar =
-    block->data()->scalar_long_double();
-  
-  for (int i=0; i<n; i++) {
-    *(scalar.value(is_array[i])) += dot_block[i];
+  for (size_t i=0; i<is_array.size(); i++) {
+    scalar_(block,is_array[i]) = result[i];
   }
-}
 
-//----------------------------------------------------------------------
-
-void EnzoSolverBiCgStab::dot_done_(EnzoBlock * block,
-				   int i_function,
-				   const char * file, int line)
-{
-  TRACE_DOT(block,"dot_done",i_function);
   switch (i_function) {
   case bcg_start_2: start_2 (block,nullptr); break;
   case bcg_loop_0a: loop_0a (block,nullptr); break;
@@ -1842,6 +1689,27 @@ void EnzoSolverBiCgStab::dot_done_(EnzoBlock * block,
 
 //----------------------------------------------------------------------
 
+std::vector<int> EnzoSolverBiCgStab::dot_scalars_(int i_function) const
+{
+  switch (i_function) {
+  case bcg_start_2: return {is_c_, is_bs_, is_xs_};
+  case bcg_loop_0a: return {is_beta_n_, is_bnorm_, is_r0s_};
+  case bcg_loop_6:  return {is_vr0_, is_ys_, is_vs_};
+  case bcg_loop_12:
+    if (expand_residual_dots_) {
+      return {is_omega_n_, is_omega_d_, is_ys_, is_us_, is_qs_,
+	      is_qq_, is_qr0_, is_ur0_};
+    } else {
+      return {is_omega_n_, is_omega_d_, is_ys_, is_us_, is_qs_};
+    }
+  case bcg_loop_14: return {is_rr_, is_beta_n_};
+  default:
+    return {};
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoSolverBiCgStab::new_register_refresh_()
 {
   Refresh * refresh_post = cello::refresh(ir_post_);
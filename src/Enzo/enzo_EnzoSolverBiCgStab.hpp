@@ -48,7 +48,8 @@ public: // interface
 		     int iter_max, 
 		     double res_tol,
 		     int index_precon,
-		     int coarse_level);
+		     int coarse_level,
+		     bool expand_residual_dots = false);
 
   /// default constructor
   EnzoSolverBiCgStab()
@@ -59,7 +60,8 @@ public: // interface
       is_omega_(-1),  is_omega_n_(-1), is_omega_d_(-1),  is_rr_(-1),     
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
-      is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_us_(-1),     is_qs_(-1),      is_function_(-1), is_iter_(-1),
+      is_qq_(-1),     is_qr0_(-1),     is_ur0_(-1),
       res_tol_(0),
       index_precon_(-1),
       iter_max_(-1),
@@ -74,6 +76,7 @@ public: // interface
       mx_(0), my_(0), mz_(0),
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
+      expand_residual_dots_(false),
       ir_loop_3_(-1),
       ir_loop_9_(-1)
   {};
@@ -90,7 +93,8 @@ public: // interface
       is_omega_(-1),  is_omega_n_(-1), is_omega_d_(-1),  is_rr_(-1),     
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
-      is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_us_(-1),     is_qs_(-1),      is_function_(-1), is_iter_(-1),
+      is_qq_(-1),     is_qr0_(-1),     is_ur0_(-1),
       res_tol_(0.0),
       index_precon_(-1),
       iter_max_(0), 
@@ -99,6 +103,7 @@ public: // interface
       m_(0), mx_(0), my_(0), mz_(0),
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
+      expand_residual_dots_(false),
       ir_loop_3_(-1),
       ir_loop_9_(-1)
           
@@ -144,11 +149,13 @@ public: // interface
   void loop_85(EnzoBlock* enzo_block) throw();
 
   /// Second matrix-vector product, begins DOT(U,U), DOT(U,Q) and
-  /// projection of Y and U
+  /// projection of Y and U (and DOT(Q,Q), DOT(Q,R0) and DOT(U,R0) if
+  /// expand_residual_dots_)
   void loop_10(EnzoBlock* enzo_block) throw();
 
   /// Shifts Y and U, second vector updates, begins DOT(R,R) and
-  /// DOT(R,R0)
+  /// DOT(R,R0) (unless expand_residual_dots_, in which case they are
+  /// computed from the preceding reduction while not yet converged)
   void loop_12(EnzoBlock* enzo_block, CkReductionMsg * ) throw();
 
   /// Updates search direction, begins update on iteration counter
@@ -157,12 +164,8 @@ public: // interface
   /// End the solve
   void end(EnzoBlock* enzo_block, int retval) throw();
 
-  void dot_recv_parent   (EnzoBlock *, int, long double *,
-			  const std::vector<int> & is_array,
-			  int i_function, int iter);
-  void dot_recv_children   (EnzoBlock *, int, long double *,
-			  const std::vector<int> & is_array,
-			  int i_function);
+  /// Save the results of a tree reduction and continue
+  void dot_done(EnzoBlock * enzo_block);
 
   protected: // methods
 
@@ -198,30 +201,11 @@ public: // interface
   // Inner product methods
 
   void inner_product_    (EnzoBlock *, int, long double *,
-			  const std::vector<int> & isa,
 			  CkCallback callback,
 			  int i_function);
-  void dot_compute_tree_ (EnzoBlock *, int, long double *,
-			  const std::vector<int> & is_array,
-			  int i_function, int iter);
-  void dot_send_parent_  (EnzoBlock *, int, long double *,
-			  const std::vector<int> & is_array,
-			  int i_function, int iter);
-  void dot_send_children_(EnzoBlock *, int, long double *,
-			  const std::vector<int> & is_array,
-			  int i_function);
-  void dot_save_         (EnzoBlock *, int, long double *,
-			  const std::vector<int> & is_array);
-  void dot_load_         (EnzoBlock *, int, long double *,
-			  const std::vector<int> & is_array);
-  void dot_clear_        (EnzoBlock *, int, const std::vector<int> & is_array);
-  void dot_clear_        (EnzoBlock *, int, long double *);
-  void dot_done_         (EnzoBlock *, int i_function,
-			  const char * file, int line);
-  void dot_increment_    (EnzoBlock *,
-			  int,
-			  const std::vector<int> & is_array,
-			  long double * dot_block);
+
+  /// ScalarData id's of values reduced before continuing with i_function
+  std::vector<int> dot_scalars_ (int i_function) const;
 protected:
   
   inline long double & scalar_ (Block *block, int i_scalar)
@@ -236,8 +220,8 @@ protected:
   bool is_singular_()
   { return (A_->is_singular() && solve_type_ != solve_tree);}
   
-  Sync & s_dot_sync_(EnzoBlock * block)
-  { return *block->data()->scalar_sync().value(is_dot_sync_); }
+  int & s_function_(EnzoBlock * block)
+  { return *block->data()->scalar_int().value(is_function_); }
 
   int & s_iter_(EnzoBlock * block)
   { return *block->data()->scalar_int().value(is_iter_); }
@@ -275,8 +259,11 @@ protected: // attributes
   int is_vs_;
   int is_us_;
   int is_qs_;
-  int is_dot_sync_;
+  int is_function_;
   int is_iter_;
+  int is_qq_;
+  int is_qr0_;
+  int is_ur0_;
 
   typedef void (EnzoSolverBiCgStab::*enzo_solver_bicgstab_member)(EnzoBlock *, CkReductionMsg *) ;
   
@@ -306,6 +293,12 @@ protected: // attributes
   /// The level of the tree solve if solve_type == solve_tree
   int coarse_level_;
 
+  /// Whether to compute DOT(R,R) and DOT(R,R0) from the inner products
+  /// of the preceding reduction, saving one of the three global
+  /// reductions of most iterations. They are still reduced explicitly
+  /// to confirm convergence.
+  bool expand_residual_dots_;
+
   /// Refresh id's
   int ir_loop_3_;
   int ir_loop_9_;
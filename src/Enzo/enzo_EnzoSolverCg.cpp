@@ -19,7 +19,8 @@ EnzoSolverCg::EnzoSolverCg
  int solve_type,
  int min_level, int max_level,
  int iter_max, double res_tol,
- int index_precon
+ int index_precon,
+ bool deflate
  )
   : Solver(name,
 	   field_x,
@@ -44,15 +45,29 @@ EnzoSolverCg::EnzoSolverCg
     bc_(0.0),
     local_(solve_type==solve_block),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
-    
+    ir_loop_2_(-1),
+    deflate_(deflate && solve_type != solve_block),
+    ic_(-1),
+    nb_(0),
+    coarse_matrix_(),
+    coarse_count_(),
+    coarse_b_(),
+    coarse_mu_(),
+    coarse_key_(-2)
 {
+  for (int axis=0; axis<3; axis++) {
+    nb3_[axis] = 1;
+    periodic_[axis] = false;
+  }
+
+
   FieldDescr * field_descr = cello::field_descr();
 
   id_ = field_descr->insert_temporary();
   ir_ = field_descr->insert_temporary();
   iy_ = field_descr->insert_temporary();
   iz_ = field_descr->insert_temporary();
+  if (deflate_) ic_ = field_descr->insert_temporary();
 
   /// Initialize default Refresh
 
@@ -148,7 +163,17 @@ void EnzoSolverCg::pup (PUP::er &p)
 
   p | ir_matvec_;
   p | ir_loop_2_;
-  
+
+  p | deflate_;
+  p | ic_;
+  p | nb_;
+  PUParray(p,nb3_,3);
+  PUParray(p,periodic_,3);
+  p | coarse_matrix_;
+  p | coarse_count_;
+  p | coarse_b_;
+  p | coarse_mu_;
+  p | coarse_key_;
 }
 
 //======================================================================
@@ -169,6 +194,13 @@ void EnzoSolverCg::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
 
   EnzoBlock * enzo_block = enzo::block(block);
 
+  if (deflate_) {
+    cello::hierarchy()->root_blocks(&nb3_[0],&nb3_[1],&nb3_[2]);
+    block->periodicity(periodic_);
+    nb_ = nb3_[0]*nb3_[1]*nb3_[2];
+    coarse_key_ = -2;
+  }
+
   // assumes all fields involved in calculation have same precision
   // int precision = field.precision(ib_);
 
@@ -205,6 +237,15 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
   enzo_float * D = (enzo_float*) field.values(id_);
   enzo_float * Z = (enzo_float*) field.values(iz_);
 
+  // If deflating, also reduce W^T B, the cell count in each coarse
+  // unknown, and the coarse matrix E
+
+  std::vector<long double> reduce ((deflate_ ? 3 + 9*nb_ : 3), 0.0);
+
+  if (deflate_ && is_finest_(enzo_block)) {
+    deflate_begin_(enzo_block,reduce.data() + 3);
+  }
+
   if (is_finest_(enzo_block)) {
 
     for (int i=0; i<mx_*my_*mz_; i++) {
@@ -215,8 +256,6 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
     }
   }
 
-  long double reduce[3] = {0.0};
-
   if (is_finest_(enzo_block)) {
 
     enzo_float * B = (enzo_float*) field.values(ib_);
@@ -234,17 +273,13 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
     reduce[2] = nx_*ny_*nz_;
   }
 
-  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_loop_0a(NULL), 
-		      enzo_block->proxy_array());
-	  
-  enzo_block->contribute (3*sizeof(long double), &reduce, 
-			  sum_long_double_3_type, 
-			  callback);
+  reduce_(enzo_block,CkIndex_EnzoBlock::p_solver_cg_loop_0a(),
+	  reduce.size(),reduce.data(),reduce_tree_sum);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::r_solver_cg_loop_0a (CkReductionMsg * msg)
+void EnzoBlock::p_solver_cg_loop_0a ()
 /// - EnzoBlock accumulate global contribution to DOT(R,R)
 /// ==> refresh P for AP = MATVEC (A,P)
 {
@@ -253,23 +288,26 @@ void EnzoBlock::r_solver_cg_loop_0a (CkReductionMsg * msg)
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
-  solver->loop_0a(this,msg);
+  solver->loop_0a(this);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoSolverCg::loop_0a
-(EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
+void EnzoSolverCg::loop_0a (EnzoBlock * enzo_block) throw ()
 {
-
-  long double * data = (long double *) msg->getData();
+  const std::vector<long double> & data =
+    enzo_block->reduce_tree_result(enzo_reduce_id_solver_cg);
 
   rr_ = data[0];
   bs_ = data[1];
   bc_ = data[2];
 
-  delete msg;
+  if (deflate_) {
+    coarse_b_.    assign(data.begin()+3,       data.begin()+3+nb_);
+    coarse_count_.assign(data.begin()+3+nb_,   data.begin()+3+2*nb_);
+    coarse_matrix_.assign(data.begin()+3+2*nb_,data.begin()+3+9*nb_);
+  }
 
 // Refresh field faces then call p_solver_cg_matvec
 
@@ -283,7 +321,7 @@ void EnzoSolverCg::loop_0a
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::r_solver_cg_loop_0b (CkReductionMsg * msg)
+void EnzoBlock::p_solver_cg_loop_0b ()
 /// ==> refresh P for AP = MATVEC (A,P)
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
@@ -291,19 +329,16 @@ void EnzoBlock::r_solver_cg_loop_0b (CkReductionMsg * msg)
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
-  solver->loop_0b(this,msg);
+  solver->loop_0b(this);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoSolverCg::loop_0b
-(EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
+void EnzoSolverCg::loop_0b (EnzoBlock * enzo_block) throw ()
 {
-
-  set_iter ( ((int*)msg->getData())[0] );
-
-  delete msg;
+  set_iter
+    ( enzo_block->reduce_tree_result(enzo_reduce_id_solver_cg)[0] );
   
   // Refresh field faces then call solver_matvec
 
@@ -369,6 +404,31 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
       cello::check(bs_,"CG::bs_",__FILE__,__LINE__);
       cello::check(bc_,"CG::bc_",__FILE__,__LINE__);
     } 
+
+    if (iter_ == 0 && deflate_) {
+
+      // initial guess X = W E^-1 W^T B so that W^T R = 0, using the
+      // shifted B if singular
+
+      const long double shift = A_->is_singular() ? -bs_ / bc_ : 0.0;
+      std::vector<long double> coarse_b (nb_);
+      for (int k=0; k<nb_; k++) {
+	coarse_b[k] = coarse_b_[k] + shift*coarse_count_[k];
+      }
+
+      coarse_correct_(enzo_block, coarse_solve_(coarse_b.data(),-1));
+
+      enzo_float * X = (enzo_float*) field.values(ix_);
+      enzo_float * D = (enzo_float*) field.values(id_);
+      enzo_float * Z = (enzo_float*) field.values(iz_);
+      enzo_float * C = (enzo_float*) field.values(ic_);
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	X[i] += C[i];
+	R[i] -= Z[i];
+	D[i] = R[i];
+	Z[i] = R[i];
+      }
+    }
   }
 
   long double reduce = 0;
@@ -388,26 +448,20 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
     }
   } 
 
-  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_shift_1(NULL), 
-		      enzo_block->proxy_array());
-
-  enzo_block->contribute (sizeof(long double), &reduce, 
-			  sum_long_double_type, 
-			  callback);
+  reduce_(enzo_block,CkIndex_EnzoBlock::p_solver_cg_shift_1(),
+	  1,&reduce,reduce_tree_sum);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::r_solver_cg_shift_1 (CkReductionMsg * msg)
+void EnzoBlock::p_solver_cg_shift_1 ()
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
-  solver->set_rr( ((long double*)msg->getData())[0] );
-
-  delete msg;
+  solver->set_rr( reduce_tree_result(enzo_reduce_id_solver_cg)[0] );
 
   solver -> loop_2a(this);
 
@@ -478,7 +532,9 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 
     }
 
-    long double reduce[3] = {0.0, 0.0, 0.0};
+    // If deflating, also reduce W^T Y
+
+    std::vector<long double> reduce ((deflate_ ? 3 + nb_ : 3), 0.0);
 
     if (is_finest_(enzo_block)) {
 
@@ -497,33 +553,41 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 	  }
 	}
       }
-    }
 
-    CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_loop_3(NULL), 
-			enzo_block->proxy_array());
+      if (deflate_) {
+	const int zero3[3] = {0,0,0};
+	const int k = coarse_index_(enzo_block,zero3);
+	for (int iz=gz_; iz<mz_-gz_; iz++) {
+	  for (int iy=gy_; iy<my_-gy_; iy++) {
+	    for (int ix=gx_; ix<mx_-gx_; ix++) {
+	      int i = ix + mx_*(iy + my_*iz);
+	      reduce[3+k] += Y[i];
+	    }
+	  }
+	}
+      }
+    }
 
-    enzo_block->contribute (3*sizeof(long double), &reduce, 
-			    sum_long_double_3_type,
-			    callback);
+    reduce_(enzo_block,CkIndex_EnzoBlock::p_solver_cg_loop_3(),
+	    reduce.size(),reduce.data(),reduce_tree_sum);
   }
 }
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::r_solver_cg_loop_3 (CkReductionMsg * msg)
+void EnzoBlock::p_solver_cg_loop_3 ()
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
 
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
-  long double * data = (long double *) msg->getData();
+  const std::vector<long double> & data =
+    reduce_tree_result(enzo_reduce_id_solver_cg);
 
   solver->set_rr(data[0]);
   solver->set_rz(data[1]);
   solver->set_dy(data[2]);
-  
-  delete msg;
 
   solver -> loop_4(this);
 
@@ -542,6 +606,10 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
 //  b = rz2 / rz;
 //  D = Z + b*D;
 //  rz = rz2;
+//
+//  If deflating, Y = A*D is replaced by P*A*D = Y - A*W*mu and the
+//  update to X by D - W*mu, where E*mu = W^T Y, so that X remains
+//  W E^-1 W^T B + P^T (X~) for the iterate X~ of CG applied to P*A
 {
 
   if (is_finest_(enzo_block)) cello::check(rr_,"CG::rr_",__FILE__,__LINE__);
@@ -558,15 +626,43 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
     enzo_float * R = (enzo_float*) field.values(ir_);
     enzo_float * Y = (enzo_float*) field.values(iy_);
 
-    enzo_float a = rz_ / dy_;
+    if (deflate_) {
 
-    cello::check(a,"CG::a",__FILE__,__LINE__);
+      const std::vector<long double> & data =
+	enzo_block->reduce_tree_result(enzo_reduce_id_solver_cg);
 
-    //    field.axpy (ix_,  a ,id_, ix_);
-    //    field.axpy (ir_, -a, iy_, ir_);
-    for (int i=0; i<mx_*my_*mz_; i++) {
-      X[i] += a * D[i];
-      R[i] -= a * Y[i];
+      const std::vector<double> & mu = coarse_solve_(data.data()+3,iter_);
+
+      // (D,P*A*D) = (D,A*D) - (W^T A*D, mu)
+      long double dy = dy_;
+      for (int k=0; k<nb_; k++) dy -= data[3+k]*mu[k];
+
+      coarse_correct_(enzo_block,mu);
+
+      enzo_float * C = (enzo_float*) field.values(ic_);
+      enzo_float * Z = (enzo_float*) field.values(iz_);
+
+      enzo_float a = rz_ / dy;
+
+      cello::check(a,"CG::a",__FILE__,__LINE__);
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	X[i] += a * (D[i] - C[i]);
+	R[i] -= a * (Y[i] - Z[i]);
+      }
+
+    } else {
+
+      enzo_float a = rz_ / dy_;
+
+      cello::check(a,"CG::a",__FILE__,__LINE__);
+
+      //    field.axpy (ix_,  a ,id_, ix_);
+      //    field.axpy (ir_, -a, iy_, ir_);
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	X[i] += a * D[i];
+	R[i] -= a * Y[i];
+      }
     }
 
     enzo_float * Z = (enzo_float*) field.values(iz_);
@@ -601,17 +697,13 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
     }
   }
 
-  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_loop_5(NULL), 
-		      enzo_block->proxy_array());
-
-  enzo_block->contribute (3*sizeof(long double), &reduce, 
-			  sum_long_double_3_type, 
-			  callback);
+  reduce_(enzo_block,CkIndex_EnzoBlock::p_solver_cg_loop_5(),
+	  3,reduce,reduce_tree_sum);
 }
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::r_solver_cg_loop_5 (CkReductionMsg * msg)
+void EnzoBlock::p_solver_cg_loop_5 ()
 /// - EnzoBlock accumulate global contribution to DOT(R,R)
 /// ==> solver_cg_loop_6
 {
@@ -620,14 +712,13 @@ void EnzoBlock::r_solver_cg_loop_5 (CkReductionMsg * msg)
   EnzoSolverCg * solver = 
     static_cast<EnzoSolverCg*> (this->solver());
 
-  long double * data = (long double *) msg->getData();
+  const std::vector<long double> & data =
+    reduce_tree_result(enzo_reduce_id_solver_cg);
 
   solver->set_rz2(data[0]);
   solver->set_rs (data[1]);
   solver->set_xs (data[2]);
 
-  delete msg;
-
   solver -> loop_6(this);
 
   performance_stop_(perf_compute,__FILE__,__LINE__);
@@ -687,13 +778,288 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
     }
   }
 
-  int iter = iter_ + 1;
+  long double iter = iter_ + 1;
+
+  reduce_(enzo_block,CkIndex_EnzoBlock::p_solver_cg_loop_0b(),
+	  1,&iter,reduce_tree_max);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::reduce_
+(EnzoBlock * enzo_block, int entry_point,
+ int n, long double * reduce, int op) throw()
+{
+  // Reduce over the mesh tree rather than the entire Block array
+
+  enzo_block->reduce_tree_start
+    (enzo_reduce_id_solver_cg, entry_point, n, reduce, op,
+     cello::config()->mesh_min_level, true);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::deflate_begin_
+(EnzoBlock * enzo_block, long double * reduce)
+{
+  ASSERT1 ("EnzoSolverCg::deflate_begin_()",
+	   "Deflation requires finest level %d >= 0",
+	   enzo_block->level(), (enzo_block->level() >= 0));
+
+  Field field = enzo_block->data()->field();
+
+  enzo_float * B = (enzo_float*) field.values(ib_);
+  enzo_float * X = (enzo_float*) field.values(ix_);
+  enzo_float * Y = (enzo_float*) field.values(iy_);
+
+  long double * coarse_b     = reduce;
+  long double * coarse_count = reduce + nb_;
+  long double * coarse_matrix = reduce + 2*nb_;
+
+  const int zero3[3] = {0,0,0};
+  const int k = coarse_index_(enzo_block,zero3);
+
+  for (int iz=gz_; iz<mz_-gz_; iz++) {
+    for (int iy=gy_; iy<my_-gy_; iy++) {
+      for (int ix=gx_; ix<mx_-gx_; ix++) {
+	int i = ix + mx_*(iy + my_*iz);
+	coarse_b[k] += B[i];
+      }
+    }
+  }
+  coarse_count[k] += nx_*ny_*nz_;
+
+  // Row k of E = W^T A W: apply A to the indicator function of the
+  // Block interior and of each face ghost zone layer, and sum over
+  // the interior.  X and Y are used as temporaries since they are
+  // initialized afterwards.  Assumes A only couples cells across
+  // faces, as for EnzoMatrixLaplace.
+
+  const int m3[3] = {mx_,my_,mz_};
+  const int g3[3] = {gx_,gy_,gz_};
+  const int rank = cello::rank();
+
+  for (int index_face=0; index_face<1+2*rank; index_face++) {
+
+    int of3[3] = {0,0,0};
+    int im3[3] = {gx_,gy_,gz_};
+    int ip3[3] = {mx_-gx_,my_-gy_,mz_-gz_};
+
+    if (index_face > 0) {
+      const int axis = (index_face-1) / 2;
+      const int face = (index_face-1) % 2;
+      of3[axis] = 2*face - 1;
+      im3[axis] = face ? m3[axis]-g3[axis] : 0;
+      ip3[axis] = face ? m3[axis]          : g3[axis];
+    }
+
+    const int k_face = coarse_index_(enzo_block,of3);
+
+    // skip non-periodic domain boundaries
+
+    if (k_face < 0) continue;
+
+    std::fill_n(X,mx_*my_*mz_,0.0);
+    for (int iz=im3[2]; iz<ip3[2]; iz++) {
+      for (int iy=im3[1]; iy<ip3[1]; iy++) {
+	for (int ix=im3[0]; ix<ip3[0]; ix++) {
+	  X[ix + mx_*(iy + my_*iz)] = 1.0;
+	}
+      }
+    }
+
+    A_->matvec(iy_,ix_,enzo_block);
+
+    long double sum = 0.0;
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  sum += Y[ix + mx_*(iy + my_*iz)];
+	}
+      }
+    }
+
+    // neighbors in the same coarse unknown contribute to the diagonal
+
+    const int index_coef = (k_face == k) ? 0 : index_face;
+    coarse_matrix[7*k + index_coef] += sum;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int EnzoSolverCg::coarse_index_
+(EnzoBlock * enzo_block, const int of3[3]) const
+{
+  int i3[3], n3[3];
+  enzo_block->index_global(&i3[0],&i3[1],&i3[2],&n3[0],&n3[1],&n3[2]);
+
+  const int level = enzo_block->level();
+
+  int r3[3];
+  for (int axis=0; axis<3; axis++) {
+    int i = i3[axis] + of3[axis];
+    if (i < 0 || i >= n3[axis]) {
+      if (! periodic_[axis]) return -1;
+      i = (i + n3[axis]) % n3[axis];
+    }
+    r3[axis] = (i >> level);
+  }
+  return r3[0] + nb3_[0]*(r3[1] + nb3_[1]*r3[2]);
+}
+
+//----------------------------------------------------------------------
+
+int EnzoSolverCg::coarse_neighbor_ (int k, int axis, int face) const
+{
+  int r3[3] = { k % nb3_[0],
+		(k / nb3_[0]) % nb3_[1],
+		k / (nb3_[0]*nb3_[1]) };
+
+  r3[axis] += face;
+  if (r3[axis] < 0 || r3[axis] >= nb3_[axis]) {
+    if (! periodic_[axis]) return -1;
+    r3[axis] = (r3[axis] + nb3_[axis]) % nb3_[axis];
+  }
+  return r3[0] + nb3_[0]*(r3[1] + nb3_[1]*r3[2]);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::coarse_matvec_
+(const std::vector<double> & x, std::vector<double> & y) const
+{
+  const int rank = cello::rank();
+  for (int k=0; k<nb_; k++) {
+    y[k] = coarse_matrix_[7*k]*x[k];
+    for (int axis=0; axis<rank; axis++) {
+      for (int face=0; face<2; face++) {
+	const double c = coarse_matrix_[7*k + 1 + 2*axis + face];
+	const int k_face = coarse_neighbor_(k,axis,2*face-1);
+	if (c != 0.0 && k_face >= 0) y[k] += c*x[k_face];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+const std::vector<double> & EnzoSolverCg::coarse_solve_
+(const long double * b, int key)
+{
+  // All Blocks on this process receive the same reduced values, so
+  // only the first Block to call with a given key solves
+
+  if (key == coarse_key_) return coarse_mu_;
+
+  coarse_key_ = key;
+
+  // Serial CG on the small coarse system, ignoring coarse unknowns
+  // without finest-level cells.  If A is singular, so is E, with the
+  // constant vector as its null space, so project it out of R
+
+  const bool is_singular = A_->is_singular();
+
+  std::vector<double> r (nb_,0.0);
+  std::vector<double> p (nb_,0.0);
+  std::vector<double> q (nb_,0.0);
+
+  coarse_mu_.assign(nb_,0.0);
+
+  int count = 0;
+  for (int k=0; k<nb_; k++) {
+    if (coarse_count_[k] > 0.0) {
+      r[k] = b[k];
+      ++count;
+    }
+  }
+
+  auto project = [&] (std::vector<double> & v) {
+    if (! is_singular || count == 0) return;
+    long double sum = 0.0;
+    for (int k=0; k<nb_; k++) if (coarse_count_[k] > 0.0) sum += v[k];
+    for (int k=0; k<nb_; k++) if (coarse_count_[k] > 0.0) v[k] -= sum/count;
+  };
+
+  project(r);
+
+  long double rr = 0.0;
+  for (int k=0; k<nb_; k++) rr += r[k]*r[k];
+
+  const long double rr0 = rr;
+  const double coarse_tol = 1e-24;
+
+  p = r;
+
+  for (int iter=0; iter<2*nb_+10 && rr > coarse_tol*rr0; iter++) {
+
+    coarse_matvec_(p,q);
+
+    long double pq = 0.0;
+    for (int k=0; k<nb_; k++) pq += p[k]*q[k];
+
+    if (! (pq > 0.0)) break;
 
-  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_loop_0b(NULL), 
-		      enzo_block->proxy_array());
+    const double a = rr / pq;
+    for (int k=0; k<nb_; k++) {
+      coarse_mu_[k] += a*p[k];
+      r[k]          -= a*q[k];
+    }
+    project(r);
+
+    long double rr_new = 0.0;
+    for (int k=0; k<nb_; k++) rr_new += r[k]*r[k];
+
+    const double beta = rr_new / rr;
+    for (int k=0; k<nb_; k++) p[k] = r[k] + beta*p[k];
+    rr = rr_new;
+  }
+
+  project(coarse_mu_);
+
+  return coarse_mu_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::coarse_correct_
+(EnzoBlock * enzo_block, const std::vector<double> & mu)
+{
+  Field field = enzo_block->data()->field();
+
+  enzo_float * C = (enzo_float*) field.values(ic_);
+
+  // C = W*mu is constant in each Block, with ghost zones taking the
+  // value of the coarse unknown containing them
+
+  const int m3[3] = {mx_,my_,mz_};
+  const int g3[3] = {gx_,gy_,gz_};
+
+  int of3[3];
+  for (of3[2]=-1; of3[2]<=1; of3[2]++) {
+    for (of3[1]=-1; of3[1]<=1; of3[1]++) {
+      for (of3[0]=-1; of3[0]<=1; of3[0]++) {
+	int im3[3],ip3[3];
+	for (int axis=0; axis<3; axis++) {
+	  im3[axis] = (of3[axis] == -1) ? 0 :
+	    (of3[axis] == 0) ? g3[axis] : m3[axis]-g3[axis];
+	  ip3[axis] = (of3[axis] == -1) ? g3[axis] :
+	    (of3[axis] == 0) ? m3[axis]-g3[axis] : m3[axis];
+	}
+	const int k = coarse_index_(enzo_block,of3);
+	const enzo_float value = (k >= 0) ? mu[k] : 0.0;
+	for (int iz=im3[2]; iz<ip3[2]; iz++) {
+	  for (int iy=im3[1]; iy<ip3[1]; iy++) {
+	    for (int ix=im3[0]; ix<ip3[0]; ix++) {
+	      C[ix + mx_*(iy + my_*iz)] = value;
+	    }
+	  }
+	}
+      }
+    }
+  }
 
-  enzo_block->contribute (sizeof(int), &iter, 
-			  CkReduction::max_int, callback);
+  A_->matvec(iz_,ic_,enzo_block);
 }
 
 //----------------------------------------------------------------------
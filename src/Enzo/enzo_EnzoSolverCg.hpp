@@ -12,7 +12,14 @@ class EnzoSolverCg : public Solver {
 
   /// @class    EnzoSolverCg
   /// @ingroup  Enzo
-  /// @brief    [\ref Enzo] 
+  /// @brief    [\ref Enzo] Conjugate gradient linear solver
+  ///
+  /// If deflate is true, the low modes are removed by deflation with
+  /// a coarse space having one unknown per root-level Block (the
+  /// aggregate of its finest-level descendents).  The small coarse
+  /// system E = W^T A W is assembled once per solve and replicated
+  /// on every process using the same tree reductions as the inner
+  /// products, so deflation adds no reductions per iteration.
 
 public: // interface
 
@@ -26,7 +33,8 @@ public: // interface
 		int max_level,
 		int iter_max, 
 		double res_tol,
-		int index_precon);
+		int index_precon,
+		bool deflate = false);
 
   /// Constructor
   EnzoSolverCg() throw()
@@ -46,9 +54,21 @@ public: // interface
     bc_(0.0),
     local_(false),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
-    
-  {};
+    ir_loop_2_(-1),
+    deflate_(false),
+    ic_(-1),
+    nb_(0),
+    coarse_matrix_(),
+    coarse_count_(),
+    coarse_b_(),
+    coarse_mu_(),
+    coarse_key_(-2)
+  {
+    for (int axis=0; axis<3; axis++) {
+      nb3_[axis] = 1;
+      periodic_[axis] = false;
+    }
+  };
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoSolverCg);
@@ -71,9 +91,21 @@ public: // interface
       bc_(0.0),
       local_(false),
       ir_matvec_(-1),
-      ir_loop_2_(-1)
-      
-  {}
+      ir_loop_2_(-1),
+      deflate_(false),
+      ic_(-1),
+      nb_(0),
+      coarse_matrix_(),
+      coarse_count_(),
+      coarse_b_(),
+      coarse_mu_(),
+      coarse_key_(-2)
+  {
+    for (int axis=0; axis<3; axis++) {
+      nb3_[axis] = 1;
+      periodic_[axis] = false;
+    }
+  }
 
   /// Assignment operator
   EnzoSolverCg & operator= (const EnzoSolverCg & EnzoSolverCg) throw();
@@ -99,10 +131,10 @@ public: // virtual functions
   void shift_1(EnzoBlock * enzo_block) throw();
 
   /// Continuation after global reduction
-  void loop_0a(EnzoBlock * enzo_block, CkReductionMsg *) throw();
+  void loop_0a(EnzoBlock * enzo_block) throw();
 
     /// Continuation after global reduction
-  void loop_0b(EnzoBlock * enzo_block, CkReductionMsg *) throw();
+  void loop_0b(EnzoBlock * enzo_block) throw();
 
   /// Continuation after global reduction
   void loop_2a(EnzoBlock * enzo_block) throw();
@@ -156,6 +188,7 @@ protected: // methods
     field.allocate_temporary(ir_);
     field.allocate_temporary(iy_);
     field.allocate_temporary(iz_);
+    if (deflate_) field.allocate_temporary(ic_);
   }
 
   /// Dellocate temporary Fields
@@ -165,11 +198,16 @@ protected: // methods
     field.deallocate_temporary(ir_);
     field.deallocate_temporary(iy_);
     field.deallocate_temporary(iz_);
+    if (deflate_) field.deallocate_temporary(ic_);
   }
 
   /// Serial CG solver if local_ == true
   void local_cg_ (EnzoBlock * enzo_block);
 
+  /// Begin a tree reduction of n values, continuing with entry_point
+  void reduce_ (EnzoBlock * enzo_block, int entry_point,
+		int n, long double * reduce, int op) throw();
+
   /// Apply boundary conditions for the Field on the local block
   void refresh_local_(int ix, EnzoBlock * enzo_block);
 
@@ -177,6 +215,35 @@ protected: // methods
   void shift_local_(int ix, EnzoBlock * enzo_block);
   
   void monitor_output_(EnzoBlock *);
+
+  /// Initialize the coarse space for deflation, and add the local
+  /// contributions to W^T B, the aggregate cell counts, and E = W^T
+  /// A W to the reduction array
+  void deflate_begin_ (EnzoBlock * enzo_block, long double * reduce);
+
+  /// Return the coarse unknown index of the root-level Block
+  /// containing the finest-level Block offset by of3 (-1, 0, or 1
+  /// along each axis), or -1 if outside a non-periodic domain
+  int coarse_index_ (EnzoBlock * enzo_block, const int of3[3]) const;
+
+  /// Return the coarse unknown index adjacent to coarse unknown k
+  /// across the given face (-1 or 1) along the given axis, or -1 if
+  /// outside a non-periodic domain
+  int coarse_neighbor_ (int k, int axis, int face) const;
+
+  /// Solve the replicated coarse system E*mu = b, reusing the last
+  /// solution if called by another Block with the same key
+  const std::vector<double> & coarse_solve_
+  (const long double * b, int key);
+
+  /// Compute Y = E*X for the coarse system
+  void coarse_matvec_
+  (const std::vector<double> & x, std::vector<double> & y) const;
+
+  /// Fill the coarse correction Field C = W*mu, including ghost
+  /// zones, and compute Z = A*C on the finest-level Block
+  void coarse_correct_ (EnzoBlock * enzo_block,
+			const std::vector<double> & mu);
   
 protected: // attributes
 
@@ -245,6 +312,37 @@ protected: // attributes
   int ir_matvec_;
   int ir_loop_2_;
 
+  /// Whether to deflate using the root-level Block coarse space
+  bool deflate_;
+
+  /// Coarse correction vector id
+  int ic_;
+
+  /// Number of coarse unknowns (root-level Blocks)
+  int nb_;
+
+  /// Root-level Block array size
+  int nb3_[3];
+
+  /// Domain periodicity along each axis
+  bool periodic_[3];
+
+  /// Coarse matrix E = W^T A W, stored as 7 coefficients per coarse
+  /// unknown: diagonal, then -x,+x,-y,+y,-z,+z neighbors
+  std::vector<double> coarse_matrix_;
+
+  /// Number of finest-level cells in each coarse unknown
+  std::vector<double> coarse_count_;
+
+  /// W^T B
+  std::vector<double> coarse_b_;
+
+  /// Last coarse solution computed on this process
+  std::vector<double> coarse_mu_;
+
+  /// Key identifying coarse_mu_ (-1 for the initial guess, else iter_)
+  int coarse_key_;
+
 };
 
 #endif /* ENZO_ENZO_SOLVER_CG_HPP */
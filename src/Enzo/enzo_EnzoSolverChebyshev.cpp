@@ -0,0 +1,297 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverChebyshev.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Implements the EnzoSolverChebyshev class
+///
+/// The smoother uses the three-term Chebyshev recurrence (Saad,
+/// "Iterative Methods for Sparse Linear Systems", Algorithm 12.1)
+/// applied to the diagonally preconditioned system:
+///
+///     theta = (lmax + lmin)/2,  delta = (lmax - lmin)/2,  sigma = theta/delta
+///     rho_0 = 1/sigma,  P_0 = D^-1 R_0 / theta
+///     X_k+1 = X_k + P_k
+///     rho_k+1 = 1 / (2 sigma - rho_k)
+///     P_k+1 = rho_k+1 rho_k P_k + (2 rho_k+1 / delta) D^-1 R_k+1
+///
+/// where R_k = B - A X_k is recomputed after each refresh of X.
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+// #define DEBUG_TRACE
+// #define DEBUG_TRACE_CYCLE 0
+
+#ifdef DEBUG_TRACE
+#  define TRACE_CHEBYSHEV(BLOCK,SOLVER,METHOD)				\
+  if (BLOCK->cycle() >= DEBUG_TRACE_CYCLE) {				\
+    CkPrintf ("%s:%d %s %s TRACE_CHEBYSHEV %s\n",			\
+	      __FILE__,__LINE__,BLOCK->name().c_str(),			\
+	      (SOLVER?SOLVER->name().c_str():"Unknown"),METHOD);	\
+  }
+#else
+#  define TRACE_CHEBYSHEV(BLOCK,SOLVER,METHOD) /* empty */
+#endif
+
+//----------------------------------------------------------------------
+
+EnzoSolverChebyshev::EnzoSolverChebyshev
+( std::string name,
+  std::string field_x,
+  std::string field_b,
+  int monitor_iter,
+  int restart_cycle,
+  int solve_type,
+  int iter_max,
+  double eigen_ratio) throw()
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type),
+    A_ (NULL),
+    ir_ (-1),
+    id_ (-1),
+    ip_ (-1),
+    n_(iter_max),
+    eigen_ratio_(eigen_ratio),
+    i_iter_(-1),
+    i_lambda_max_(-1),
+    ir_smooth_(-1)
+{
+  ASSERT1 ("EnzoSolverChebyshev::EnzoSolverChebyshev()",
+	   "eigen_ratio = %g must be greater than 1",
+	   eigen_ratio,
+	   (eigen_ratio == 0.0 || eigen_ratio > 1.0));
+
+  // Default eigenvalue interval [lambda_max / (2*rank), lambda_max]
+  // covers the high-frequency modes of the Laplacian
+
+  if (eigen_ratio_ == 0.0) eigen_ratio_ = 2.0*cello::rank();
+
+  // Reserve temporary fields
+
+  id_ = cello::field_descr()->insert_temporary();
+  ir_ = cello::field_descr()->insert_temporary();
+  ip_ = cello::field_descr()->insert_temporary();
+
+  Refresh * refresh = cello::refresh(ir_post_);
+  cello::simulation()->new_refresh_set_name(ir_post_,name);
+
+  refresh->add_field (ix_);
+
+  i_iter_ = cello::scalar_descr_int()->new_value(name_ + ":iter");
+  i_lambda_max_ =
+    cello::scalar_descr_double()->new_value(name_ + ":lambda_max");
+
+  ir_smooth_ = add_new_refresh_();
+
+  Refresh * refresh_smooth = cello::refresh(ir_smooth_);
+  cello::simulation()->new_refresh_set_name(ir_smooth_,name+":smooth");
+
+  refresh_smooth->add_field (ix_);
+  refresh_smooth->set_solver_id(index());
+  refresh_smooth->set_callback
+    (CkIndex_EnzoBlock::p_solver_chebyshev_continue());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::apply
+( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  TRACE_CHEBYSHEV(block,this,"apply()");
+
+  begin_(block);
+
+  A_ = A;
+
+  Field field = block->data()->field();
+
+  allocate_temporary_(field,block);
+
+  (*piter_(block)) = 0;
+
+  // Refresh X
+
+  do_refresh_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_chebyshev_continue()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverChebyshev * solver =
+    static_cast<EnzoSolverChebyshev *> (this->solver());
+
+  TRACE_CHEBYSHEV(this,solver,"p_solver_chebyshev_continue()");
+
+  solver->compute(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::compute(Block * block)
+{
+  TRACE_CHEBYSHEV(block,this,"compute()");
+
+  if (*piter_(block) < n_) {
+
+    apply_(block);
+
+  } else {
+
+    Field field = block->data()->field();
+    deallocate_temporary_ (field,block);
+
+    Solver::end_(block);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::apply_(Block * block)
+{
+  TRACE_CHEBYSHEV(block,this,"apply_()");
+
+  const int iter = *piter_(block);
+
+  if (is_finest_(block)) {
+
+    Field field = block->data()->field();
+
+    int mx,my,mz;
+    field.dimensions(ix_,&mx,&my,&mz);
+
+    const int ng = A_->ghost_depth();
+    const int gx = (mx > 1) ? ng : 0;
+    const int gy = (my > 1) ? ng : 0;
+    const int gz = (mz > 1) ? ng : 0;
+
+    if (iter == 0) {
+      // The diagonal and eigenvalue estimate are fixed during the solve
+      A_->diagonal (id_, block, ng);
+      (*plambda_max_(block)) = lambda_max_(block,ng);
+    }
+
+    A_->residual (ir_, ib_, ix_, block, ng);
+
+    const double lambda_max = *plambda_max_(block);
+    const double lambda_min = lambda_max / eigen_ratio_;
+    const double theta = 0.5*(lambda_max + lambda_min);
+    const double delta = 0.5*(lambda_max - lambda_min);
+    const double sigma = theta / delta;
+
+    // rho_k depends only on the iteration, so it is recomputed here
+    // rather than stored on the Block
+
+    double rho_prev = 0.0;
+    double rho = 1.0 / sigma;
+    for (int k=1; k<=iter; k++) {
+      rho_prev = rho;
+      rho = 1.0 / (2.0*sigma - rho);
+    }
+
+    const enzo_float cp = (iter == 0) ? 0.0 : rho*rho_prev;
+    const enzo_float cr = (iter == 0) ? 1.0/theta : 2.0*rho/delta;
+
+    enzo_float * X = (enzo_float*) field.values(ix_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * D = (enzo_float*) field.values(id_);
+    enzo_float * P = (enzo_float*) field.values(ip_);
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+	for (int ix=gx; ix<mx-gx; ix++) {
+	  int i = ix + mx*(iy + my*iz);
+	  P[i] = cp*P[i] + cr*(R[i] / D[i]);
+	  X[i] += P[i];
+	}
+      }
+    }
+  }
+
+  // Next iteration
+
+  (*piter_(block))++;
+
+  // Refresh X
+
+  do_refresh_(block);
+}
+
+//----------------------------------------------------------------------
+
+double EnzoSolverChebyshev::lambda_max_(Block * block, int ng)
+{
+  // Estimate lambda_max(D^-1 A) from the checkerboard vector S, the
+  // highest-frequency mode of the Laplacian.  For stencils whose
+  // couplings alternate in sign with distance (including the second-
+  // and fourth-order Laplacians), max (A S)_i / (D_i S_i) is the
+  // Gershgorin bound on lambda_max, so it is computed with one local
+  // matvec instead of an iterative method that would need reductions.
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions(ix_,&mx,&my,&mz);
+
+  const int gx = (mx > 1) ? ng : 0;
+  const int gy = (my > 1) ? ng : 0;
+  const int gz = (mz > 1) ? ng : 0;
+
+  enzo_float * S = (enzo_float*) field.values(ip_);
+  enzo_float * Y = (enzo_float*) field.values(ir_);
+  enzo_float * D = (enzo_float*) field.values(id_);
+
+  for (int iz=0; iz<mz; iz++) {
+    for (int iy=0; iy<my; iy++) {
+      for (int ix=0; ix<mx; ix++) {
+	int i = ix + mx*(iy + my*iz);
+	S[i] = ((ix + iy + iz) % 2 == 0) ? 1.0 : -1.0;
+      }
+    }
+  }
+
+  A_->matvec (ir_, ip_, block, ng);
+
+  double lambda_max = 0.0;
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+	int i = ix + mx*(iy + my*iz);
+	lambda_max = std::max(lambda_max, double(Y[i] / (D[i] * S[i])));
+      }
+    }
+  }
+
+  ASSERT2 ("EnzoSolverChebyshev::lambda_max_()",
+	   "Block %s: lambda_max estimate %g must be positive",
+	   block->name().c_str(), lambda_max,
+	   (lambda_max > 0.0));
+
+  return lambda_max;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::do_refresh_(Block * block)
+{
+  TRACE_CHEBYSHEV(block,this,"do_refresh()");
+
+  Refresh * refresh = cello::refresh(ir_smooth_);
+
+  refresh->set_active(is_finest_(block));
+  refresh->add_field (ix_);
+
+  block->new_refresh_start
+    (ir_smooth_, CkIndex_EnzoBlock::p_solver_chebyshev_continue());
+}
+
+//----------------------------------------------------------------------
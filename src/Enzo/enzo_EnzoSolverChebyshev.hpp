@@ -0,0 +1,182 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverChebyshev.hpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverChebyshev class
+
+#ifndef ENZO_ENZO_SOLVER_CHEBYSHEV_HPP
+#define ENZO_ENZO_SOLVER_CHEBYSHEV_HPP
+
+class EnzoSolverChebyshev : public Solver {
+
+  /// @class    EnzoSolverChebyshev
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Diagonally-preconditioned Chebyshev
+  /// polynomial smoother
+  ///
+  /// Applies a Chebyshev polynomial of degree iter_max in D^-1 A,
+  /// chosen to damp the error components with eigenvalues in
+  /// [lambda_max / eigen_ratio, lambda_max].  lambda_max is estimated
+  /// once per solve on each Block with a single local matrix-vector
+  /// product, so unlike Krylov solvers no inner products (and hence
+  /// no global reductions) are needed.  Each iteration requires one
+  /// refresh of X, like EnzoSolverJacobi, but damps high-frequency
+  /// error more strongly, so fewer iterations are needed for the
+  /// same smoothing.
+
+public: // interface
+
+  /// Constructor
+  EnzoSolverChebyshev(std::string name,
+		      std::string field_x,
+		      std::string field_b,
+		      int monitor_iter,
+		      int restart_cycle,
+		      int solve_type,
+		      int iter_max = 2,
+		      double eigen_ratio = 0.0) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverChebyshev);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverChebyshev (CkMigrateMessage *m)
+    : Solver(m),
+      A_(NULL),
+      ir_(-1),
+      id_(-1),
+      ip_(-1),
+      n_(0),
+      eigen_ratio_(0.0),
+      i_iter_(-1),
+      i_lambda_max_(-1),
+      ir_smooth_(-1)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Solver::pup(p);
+
+    //    p | A_;
+    p | ir_;
+    p | id_;
+    p | ip_;
+    p | n_;
+    p | eigen_ratio_;
+    p | i_iter_;
+    p | i_lambda_max_;
+    p | ir_smooth_;
+  }
+
+public: // virtual methods
+
+  /// Solve the linear system Ax = b
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "chebyshev"; }
+
+protected: // virtual methods
+
+  /// Whether Block is active
+  virtual bool is_active_(Block * block) const
+  {
+    if (solve_type_ == solve_level) {
+      return true;
+    } else {
+      return Solver::is_active_(block);
+    }
+  }
+
+  /// Whether solution is defined on this Block
+  virtual bool is_finest_(Block * block) const
+  {
+    if (solve_type_ == solve_level) {
+      return true;
+    } else {
+      return Solver::is_finest_(block);
+    }
+  }
+
+public: // methods
+
+  /// Continue after refresh to perform the next Chebyshev update
+  void compute (Block * block);
+
+protected: // methods
+
+  /// Perform one Chebyshev update of X
+  void apply_(Block * block);
+
+  /// Return an estimate of the largest eigenvalue of D^-1 A on the
+  /// Block, assuming the diagonal field has been computed
+  double lambda_max_(Block * block, int ng);
+
+  /// Refresh after computing
+  void do_refresh_(Block * block);
+
+  /// Allocate temporary Fields
+  void allocate_temporary_(Field field, Block * block = NULL)
+  {
+    field.allocate_temporary(id_);
+    field.allocate_temporary(ir_);
+    field.allocate_temporary(ip_);
+  }
+
+  /// Dellocate temporary Fields
+  void deallocate_temporary_(Field field, Block * block = NULL)
+  {
+    field.deallocate_temporary(id_);
+    field.deallocate_temporary(ir_);
+    field.deallocate_temporary(ip_);
+  }
+
+  /// Return a pointer to the iteration counter on the block
+  int * piter_(Block * block) {
+    ScalarData<int> * scalar_data  = block->data()->scalar_data_int();
+    ScalarDescr *     scalar_descr = cello::scalar_descr_int();
+    return scalar_data->value(scalar_descr,i_iter_);
+  }
+
+  /// Return a pointer to the eigenvalue estimate on the block
+  double * plambda_max_(Block * block) {
+    ScalarData<double> * scalar_data  = block->data()->scalar_data_double();
+    ScalarDescr *        scalar_descr = cello::scalar_descr_double();
+    return scalar_data->value(scalar_descr,i_lambda_max_);
+  }
+
+protected: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Matrix A for smoothing A*X = B
+  std::shared_ptr<Matrix> A_;
+
+  /// Field index for residual R
+  int ir_;
+
+  /// Field index for matrix diagonal D
+  int id_;
+
+  /// Field index for update direction P
+  int ip_;
+
+  /// Degree of the Chebyshev polynomial (number of iterations)
+  int n_;
+
+  /// Ratio lambda_max / lambda_min of the damped eigenvalue interval
+  double eigen_ratio_;
+
+  /// Scalar index for current iteration on a Block
+  int i_iter_;
+
+  /// Scalar index for the estimate of lambda_max on a Block
+  int i_lambda_max_;
+
+  // Refresh after each smoothing
+  int ir_smooth_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_CHEBYSHEV_HPP */
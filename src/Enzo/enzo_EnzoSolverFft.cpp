@@ -0,0 +1,544 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Implements the EnzoSolverFft class
+///
+/// Control flow:
+///
+///     apply()          Blocks on max_level send B to the gathering Block
+///     gather_recv()    gathering Block collects B; when all have arrived:
+///     solve_()         solve on the whole level and send X to each Block
+///     scatter_recv()   copy X (including ghost zones) and end
+
+#include <complex>
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  typedef std::complex<double> complex_type;
+
+  /// Return whether n is a power of two
+  bool is_power_of_two_ (int n)
+  { return n > 0 && (n & (n-1)) == 0; }
+
+  /// In-place radix-2 FFT of length n = 2^k.  sign = -1 for the forward
+  /// transform and +1 for the (unnormalized) inverse
+  void fft_radix2_ (complex_type * a, int n, int sign)
+  {
+    // bit-reversal permutation
+    for (int i=1, j=0; i<n; i++) {
+      int bit = n >> 1;
+      for (; j & bit; bit >>= 1) j ^= bit;
+      j ^= bit;
+      if (i < j) std::swap(a[i],a[j]);
+    }
+    for (int len=2; len<=n; len <<= 1) {
+      const double angle = sign*2.0*cello::pi/len;
+      const complex_type w_len (cos(angle),sin(angle));
+      for (int i=0; i<n; i+=len) {
+	complex_type w (1.0,0.0);
+	for (int j=0; j<len/2; j++) {
+	  const complex_type u = a[i+j];
+	  const complex_type v = a[i+j+len/2]*w;
+	  a[i+j]       = u + v;
+	  a[i+j+len/2] = u - v;
+	  w *= w_len;
+	}
+      }
+    }
+  }
+
+  /// In-place FFT of arbitrary length n, using Bluestein's algorithm
+  /// when n is not a power of two
+  void fft_ (complex_type * a, int n, int sign)
+  {
+    if (n <= 1) return;
+
+    if (is_power_of_two_(n)) {
+      fft_radix2_(a,n,sign);
+      return;
+    }
+
+    int m = 1;
+    while (m < 2*n-1) m <<= 1;
+
+    // chirp w_k = exp(sign*i*pi*k^2/n), with k^2 reduced mod 2n
+    std::vector<complex_type> w(n);
+    for (int k=0; k<n; k++) {
+      const long long k2 = ((long long)(k)*k) % (2*n);
+      const double angle = sign*cello::pi*k2/n;
+      w[k] = complex_type(cos(angle),sin(angle));
+    }
+    std::vector<complex_type> u(m,0.0), v(m,0.0);
+    for (int k=0; k<n; k++) u[k] = a[k]*w[k];
+    v[0] = std::conj(w[0]);
+    for (int k=1; k<n; k++) v[k] = v[m-k] = std::conj(w[k]);
+
+    fft_radix2_(u.data(),m,-1);
+    fft_radix2_(v.data(),m,-1);
+    for (int i=0; i<m; i++) u[i] *= v[i];
+    fft_radix2_(u.data(),m,+1);
+
+    for (int k=0; k<n; k++) a[k] = w[k]*u[k] / double(m);
+  }
+
+  /// In-place 3D FFT of the n3[0]*n3[1]*n3[2] array a (x-axis
+  /// fastest).  The inverse transform (sign = +1) is normalized
+  void fft_3d_ (std::vector<complex_type> & a, const int n3[3], int sign)
+  {
+    const int stride3[3] = {1, n3[0], n3[0]*n3[1]};
+    std::vector<complex_type> line;
+    for (int axis=0; axis<3; axis++) {
+      const int n = n3[axis];
+      if (n <= 1) continue;
+      const int stride = stride3[axis];
+      const int a1 = (axis+1) % 3;
+      const int a2 = (axis+2) % 3;
+      line.resize(n);
+      for (int i2=0; i2<n3[a2]; i2++) {
+	for (int i1=0; i1<n3[a1]; i1++) {
+	  const int i0 = i1*stride3[a1] + i2*stride3[a2];
+	  for (int i=0; i<n; i++) line[i] = a[i0+i*stride];
+	  fft_(line.data(),n,sign);
+	  for (int i=0; i<n; i++) a[i0+i*stride] = line[i];
+	}
+      }
+    }
+    if (sign > 0) {
+      const double scale = 1.0 / a.size();
+      for (size_t i=0; i<a.size(); i++) a[i] *= scale;
+    }
+  }
+
+  /// Return the eigenvalue of the one-dimensional EnzoMatrixLaplace
+  /// stencil of the given order for the Fourier mode with phase theta
+  double laplace_symbol_ (int order, double theta, double h)
+  {
+    // stencil coefficients c[0] + c[j]*(X[i-j] + X[i+j]) and scaling
+    double c[4] = {0.0, 0.0, 0.0, 0.0};
+    double scale = 0.0;
+    if (order == 2) {
+      c[0] = -2.0;    c[1] = 1.0;
+      scale = 1.0;
+    } else if (order == 4) {
+      c[0] = -30.0;   c[1] = 16.0;   c[2] = -1.0;
+      scale = 12.0;
+    } else if (order == 6) {
+      c[0] = -2720.0; c[1] = 1455.0; c[2] = -96.0; c[3] = 1.0;
+      scale = 1080.0;
+    } else {
+      ERROR1 ("EnzoSolverFft::laplace_symbol_()",
+	      "Unsupported Laplacian order %d",order);
+    }
+    double value = c[0];
+    for (int j=1; j<4; j++) value += 2.0*c[j]*cos(j*theta);
+    return value / (scale*h*h);
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+EnzoSolverFft::EnzoSolverFft
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int min_level,
+ int max_level)
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+	   min_level,
+	   max_level),
+    A_(NULL),
+    i_sync_gather_(-1),
+    i_gather_(-1)
+{
+  ASSERT1 ("EnzoSolverFft::EnzoSolverFft()",
+	   "max_level = %d, but the FFT solver requires max_level <= 0 "
+	   "so that the level covers the whole domain",
+	   max_level, (max_level <= 0));
+
+  Refresh * refresh = cello::refresh(ir_post_);
+  cello::simulation()->new_refresh_set_name(ir_post_,name);
+
+  refresh->add_field (ix_);
+
+  ScalarDescr * scalar_descr_sync = cello::scalar_descr_sync();
+  i_sync_gather_ = scalar_descr_sync->new_value(name + ":gather");
+
+  ScalarDescr * scalar_descr_void = cello::scalar_descr_void();
+  i_gather_ = scalar_descr_void->new_value(name + ":gather");
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  A_ = A;
+
+  if (block->level() != max_level_) {
+    Solver::end_(block);
+    return;
+  }
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions (ib_,&mx,&my,&mz);
+  field.ghost_depth(ib_,&gx,&gy,&gz);
+
+  const int nx = mx - 2*gx;
+  const int ny = my - 2*gy;
+  const int nz = mz - 2*gz;
+
+  // Pack B values without ghost zones
+
+  enzo_float * B = (enzo_float*) field.values(ib_);
+
+  std::vector<double> b(nx*ny*nz);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	b[ix + nx*(iy + ny*iz)] = B[(ix+gx) + mx*((iy+gy) + my*(iz+gz))];
+      }
+    }
+  }
+
+  int ibx,iby,ibz;
+  block->index_global(&ibx,&iby,&ibz,NULL,NULL,NULL);
+
+  Index index_gather = index_gather_(block);
+
+  enzo::block_array()[index_gather].p_solver_fft_gather
+    (index(), block->index(), ibx, iby, ibz, b.size(), b.data());
+}
+
+//----------------------------------------------------------------------
+
+Index EnzoSolverFft::index_gather_ (Block * block) const
+{
+  // Block containing the lower corner of the domain on this level
+
+  const int level = block->level();
+
+  Index index (0,0,0);
+  if (level < 0) {
+    index = index.index_ancestor(level,min_level_);
+  } else {
+    int ic3[3] = {0,0,0};
+    for (int i=0; i<level; i++) {
+      index = index.index_child(ic3,min_level_);
+    }
+  }
+  return index;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_gather
+(int is, Index index, int ibx, int iby, int ibz, int n, double * b)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  // Use the solver index rather than this->solver(), since messages
+  // may arrive before this Block has started the solver
+
+  EnzoSolverFft * solver = static_cast<EnzoSolverFft*> (cello::solver(is));
+
+  int ib3[3] = {ibx, iby, ibz};
+  solver->gather_recv(this,index,ib3,n,b);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::gather_recv
+(EnzoBlock * enzo_block, Index index, int ib3[3], int n, double * b) throw()
+{
+  // Blocks on the level all have the same size, so the level size
+  // follows from this Block's size and its position on the level
+
+  Field field = enzo_block->data()->field();
+
+  int m3[3], g3[3], nb3[3];
+  field.dimensions (0,&m3[0],&m3[1],&m3[2]);
+  field.ghost_depth(0,&g3[0],&g3[1],&g3[2]);
+  enzo_block->index_global(NULL,NULL,NULL,&nb3[0],&nb3[1],&nb3[2]);
+
+  int n3[3], N3[3];
+  for (int axis=0; axis<3; axis++) {
+    n3[axis] = m3[axis] - 2*g3[axis];
+    N3[axis] = nb3[axis]*n3[axis];
+  }
+
+  ASSERT2 ("EnzoSolverFft::gather_recv()",
+	   "Received %d values but expected %d",
+	   n, n3[0]*n3[1]*n3[2],
+	   (n == n3[0]*n3[1]*n3[2]));
+
+  Gather * & gather = *pgather_(enzo_block);
+  if (gather == NULL) {
+    gather = new Gather;
+    gather->b.resize(N3[0]*N3[1]*N3[2]);
+  }
+
+  // Copy Block values into the level array
+
+  const int ox = ib3[0]*n3[0];
+  const int oy = ib3[1]*n3[1];
+  const int oz = ib3[2]*n3[2];
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      for (int ix=0; ix<n3[0]; ix++) {
+	const int i_level = (ox+ix) + N3[0]*((oy+iy) + N3[1]*(oz+iz));
+	gather->b[i_level] = b[ix + n3[0]*(iy + n3[1]*iz)];
+      }
+    }
+  }
+  gather->index.push_back(index);
+  for (int axis=0; axis<3; axis++) gather->ib3.push_back(ib3[axis]);
+
+  Sync * sync = psync_gather_(enzo_block);
+  sync->set_stop(nb3[0]*nb3[1]*nb3[2]);
+
+  if (sync->next()) {
+    solve_(enzo_block,gather);
+    delete gather;
+    gather = NULL;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::solve_ (EnzoBlock * enzo_block, Gather * gather) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int m3[3], g3[3], nb3[3];
+  field.dimensions (0,&m3[0],&m3[1],&m3[2]);
+  field.ghost_depth(0,&g3[0],&g3[1],&g3[2]);
+  enzo_block->index_global(NULL,NULL,NULL,&nb3[0],&nb3[1],&nb3[2]);
+
+  int n3[3], N3[3];
+  for (int axis=0; axis<3; axis++) {
+    n3[axis] = m3[axis] - 2*g3[axis];
+    N3[axis] = nb3[axis]*n3[axis];
+  }
+
+  double h3[3];
+  enzo_block->cell_width(&h3[0],&h3[1],&h3[2]);
+
+  bool p3[3];
+  enzo_block->periodicity(p3);
+
+  const int rank = cello::rank();
+  const bool is_periodic = p3[0];
+  for (int axis=1; axis<rank; axis++) {
+    ASSERT ("EnzoSolverFft::solve_()",
+	    "Boundaries must be either all periodic or all non-periodic",
+	    p3[axis] == is_periodic);
+  }
+
+  std::shared_ptr<EnzoMatrixLaplace> laplace =
+    std::dynamic_pointer_cast<EnzoMatrixLaplace>(A_);
+
+  ASSERT ("EnzoSolverFft::solve_()",
+	  "FFT solver requires an EnzoMatrixLaplace matrix",
+	  laplace != NULL);
+
+  const int order = laplace->order();
+
+  // Solve on the level, keeping the grid dimensions L3 of the
+  // solution so that ghost zone values can be wrapped into it
+
+  std::vector<double> & x = gather->b;
+
+  int L3[3] = {N3[0], N3[1], N3[2]};
+
+  if (is_periodic) {
+    solve_periodic(x,N3,h3,order);
+  } else {
+    ASSERT1 ("EnzoSolverFft::solve_()",
+	     "Isolated FFT solver requires a second-order Laplacian, "
+	     "not order %d",
+	     order, (order == 2));
+    solve_isolated(x,N3,g3,h3,rank,L3);
+  }
+
+  // Send each Block its values, including ghost zones
+
+  const int m = m3[0]*m3[1]*m3[2];
+  std::vector<double> x_block(m);
+
+  for (size_t k=0; k<gather->index.size(); k++) {
+    const int * ib3 = &gather->ib3[3*k];
+    for (int iz=0; iz<m3[2]; iz++) {
+      const int jz = (ib3[2]*n3[2] + iz - g3[2] + L3[2]) % L3[2];
+      for (int iy=0; iy<m3[1]; iy++) {
+	const int jy = (ib3[1]*n3[1] + iy - g3[1] + L3[1]) % L3[1];
+	for (int ix=0; ix<m3[0]; ix++) {
+	  const int jx = (ib3[0]*n3[0] + ix - g3[0] + L3[0]) % L3[0];
+	  x_block[ix + m3[0]*(iy + m3[1]*iz)] = x[jx + L3[0]*(jy + L3[1]*jz)];
+	}
+      }
+    }
+    enzo::block_array()[gather->index[k]].p_solver_fft_scatter
+      (m, x_block.data());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::solve_periodic
+(std::vector<double> & b, const int n3[3], const double h3[3], int order)
+{
+  // Eigenvalues of the discrete Laplacian along each axis
+
+  std::vector<double> lambda[3];
+  for (int axis=0; axis<3; axis++) {
+    lambda[axis].resize(n3[axis]);
+    for (int k=0; k<n3[axis]; k++) {
+      lambda[axis][k] = (n3[axis] > 1) ?
+	laplace_symbol_(order,2.0*cello::pi*k/n3[axis],h3[axis]) : 0.0;
+    }
+  }
+
+  std::vector<complex_type> a (b.begin(),b.end());
+
+  fft_3d_(a,n3,-1);
+
+  for (int kz=0; kz<n3[2]; kz++) {
+    for (int ky=0; ky<n3[1]; ky++) {
+      for (int kx=0; kx<n3[0]; kx++) {
+	const int i = kx + n3[0]*(ky + n3[1]*kz);
+	const double l = lambda[0][kx] + lambda[1][ky] + lambda[2][kz];
+	// The constant mode is in the null space: project it out
+	a[i] = (i == 0) ? 0.0 : a[i] / l;
+      }
+    }
+  }
+
+  fft_3d_(a,n3,+1);
+
+  for (size_t i=0; i<b.size(); i++) b[i] = a[i].real();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::solve_isolated
+(std::vector<double> & b, const int n3[3], const int g3[3],
+ const double h3[3], int rank, int m3[3])
+{
+  // Hockney's method: convolve B with the Green's function G of the
+  // Laplacian on a zero-padded grid, so that the periodic images do
+  // not interact.  Padding to 2*(n + g) keeps values in the ghost
+  // zones, which lie up to n + g - 1 cells from the sources, exact.
+  // G approximates the Green's function of the second-order stencil,
+  // so the solution is second-order accurate.
+
+  for (int axis=0; axis<3; axis++) {
+    m3[axis] = (n3[axis] > 1) ? 2*(n3[axis] + g3[axis]) : 1;
+  }
+  const int m = m3[0]*m3[1]*m3[2];
+
+  double volume = 1.0;
+  for (int axis=0; axis<rank; axis++) volume *= h3[axis];
+  const double h = std::pow(volume,1.0/rank);
+
+  // G(r) for the 2nd-order discrete Laplacian at r = 0, and its
+  // continuum limit elsewhere (exact for rank 1; the rank 2 constant
+  // matches the lattice Green's function at large r)
+  const double euler_gamma = 0.5772156649015329;
+  const double g0_3d = -0.2527310098586252 / h;
+  const double c_2d  = (2.0*euler_gamma + log(8.0)) / (4.0*cello::pi);
+
+  std::vector<complex_type> g(m), a(m,0.0);
+
+  for (int iz=0; iz<m3[2]; iz++) {
+    const double z = h3[2]*std::min(iz,m3[2]-iz);
+    for (int iy=0; iy<m3[1]; iy++) {
+      const double y = h3[1]*std::min(iy,m3[1]-iy);
+      for (int ix=0; ix<m3[0]; ix++) {
+	const double x = h3[0]*std::min(ix,m3[0]-ix);
+	const double r = sqrt(x*x + y*y + z*z);
+	double value = 0.0;
+	if (rank == 1) {
+	  value = 0.5*r;
+	} else if (rank == 2) {
+	  value = (r == 0.0) ? 0.0 : log(r/h)/(2.0*cello::pi) + c_2d;
+	} else {
+	  value = (r == 0.0) ? g0_3d : -1.0/(4.0*cello::pi*r);
+	}
+	g[ix + m3[0]*(iy + m3[1]*iz)] = value*volume;
+      }
+    }
+  }
+
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      for (int ix=0; ix<n3[0]; ix++) {
+	a[ix + m3[0]*(iy + m3[1]*iz)] = b[ix + n3[0]*(iy + n3[1]*iz)];
+      }
+    }
+  }
+
+  fft_3d_(g,m3,-1);
+  fft_3d_(a,m3,-1);
+  for (int i=0; i<m; i++) a[i] *= g[i];
+  fft_3d_(a,m3,+1);
+
+  b.resize(m);
+  for (int i=0; i<m; i++) b[i] = a[i].real();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_scatter(int n, double * x)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverFft * solver = static_cast<EnzoSolverFft*> (this->solver());
+
+  solver->scatter_recv(this,n,x);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::scatter_recv
+(EnzoBlock * enzo_block, int n, double * x) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (ix_,&mx,&my,&mz);
+
+  ASSERT2 ("EnzoSolverFft::scatter_recv()",
+	   "Received %d values but expected %d",
+	   n, mx*my*mz, (n == mx*my*mz));
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+
+  for (int i=0; i<n; i++) X[i] = x[i];
+
+  Solver::end_(enzo_block);
+}
+
+//----------------------------------------------------------------------
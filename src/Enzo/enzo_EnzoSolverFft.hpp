@@ -0,0 +1,154 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.hpp
+/// @date     Fri Oct 16 2026
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverFft class
+
+#ifndef ENZO_ENZO_SOLVER_FFT_HPP
+#define ENZO_ENZO_SOLVER_FFT_HPP
+
+class EnzoSolverFft : public Solver {
+
+  /// @class    EnzoSolverFft
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Direct FFT solver for the Poisson problem on
+  /// a single coarse level
+  ///
+  /// Intended as the coarse solver of EnzoSolverMg0 or EnzoSolverDd.
+  /// Blocks on level max_level send their B values to the Block at
+  /// the lower corner of the level, which solves the problem on the
+  /// whole level with FFT's and sends each Block its part of X,
+  /// including ghost zones.  This replaces the many global reductions
+  /// of an iterative coarse solver with one gather and one scatter.
+  ///
+  /// For periodic domains the discrete Laplacian (of any order
+  /// supported by EnzoMatrixLaplace) is inverted exactly.  For
+  /// non-periodic domains the isolated solution is computed by
+  /// zero-padded convolution with the free-space Green's function,
+  /// which is only consistent with the second-order Laplacian.
+  /// Blocks on other levels return immediately.
+  ///
+  /// The level must cover the whole domain, so max_level must be <= 0.
+
+public: // interface
+
+  /// Create a new EnzoSolverFft object
+  EnzoSolverFft
+  (std::string name,
+   std::string field_x,
+   std::string field_b,
+   int monitor_iter,
+   int restart_cycle,
+   int solve_type,
+   int min_level,
+   int max_level);
+
+  EnzoSolverFft() {};
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverFft);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverFft (CkMigrateMessage *m)
+    :  Solver(m),
+       A_(NULL),
+       i_sync_gather_(-1),
+       i_gather_(-1)
+  {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+
+    // NOTE: change this function whenever attributes change
+
+    TRACEPUP;
+
+    Solver::pup(p);
+
+    //    p | A_;
+    p | i_sync_gather_;
+    p | i_gather_;
+  }
+
+public: // virtual methods
+
+  /// Solve the linear system
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "fft"; }
+
+public: // methods
+
+  /// Receive B values from a Block on the gathering Block
+  void gather_recv (EnzoBlock * enzo_block, Index index, int ib3[3],
+		    int n, double * b) throw();
+
+  /// Receive X values (including ghost zones) from the gathering Block
+  void scatter_recv (EnzoBlock * enzo_block, int n, double * x) throw();
+
+public: // static methods
+
+  /// Solve with periodic boundary conditions on the n3 grid (x-axis
+  /// fastest) for the EnzoMatrixLaplace stencil of the given order,
+  /// overwriting b with x.  The constant mode of x is zero
+  static void solve_periodic
+  (std::vector<double> & b, const int n3[3], const double h3[3], int order);
+
+  /// Solve with isolated boundary conditions for the second-order
+  /// Laplacian.  The solution is returned in b on the zero-padded grid
+  /// of size m3 = 2*(n3 + g3) (along axes with n3 > 1), so that it also
+  /// defines values in the ghost zones outside the domain
+  static void solve_isolated
+  (std::vector<double> & b, const int n3[3], const int g3[3],
+   const double h3[3], int rank, int m3[3]);
+
+protected: // methods
+
+  /// B values gathered from all Blocks on the level, and where to
+  /// send the solution
+  struct Gather {
+    /// B values on the level, x-axis fastest
+    std::vector<double> b;
+    /// Indices of the Blocks that sent values
+    std::vector<Index> index;
+    /// Level coordinates of the Blocks that sent values
+    std::vector<int> ib3;
+  };
+
+  /// Return the Index of the Block that gathers the level
+  Index index_gather_ (Block * block) const;
+
+  /// Solve on the whole level and send the solution to each Block
+  void solve_ (EnzoBlock * enzo_block, Gather * gather) throw();
+
+  /// Return a pointer to the Sync counter for gathered messages
+  Sync * psync_gather_(Block * block)
+  {
+    ScalarData<Sync> * scalar_data = block->data()->scalar_data_sync();
+    ScalarDescr *      scalar_descr = cello::scalar_descr_sync();
+    return scalar_data->value(scalar_descr,i_sync_gather_);
+  }
+
+  /// Return a pointer to the gathered data on the gathering Block
+  Gather ** pgather_(Block * block)
+  {
+    ScalarData<void *> * scalar_data = block->data()->scalar_data_void();
+    ScalarDescr *        scalar_descr = cello::scalar_descr_void();
+    return (Gather **)scalar_data->value(scalar_descr,i_gather_);
+  }
+
+protected: // attributes
+
+  /// Matrix
+  std::shared_ptr<Matrix> A_;
+
+  /// Scalar index for counting gathered messages
+  int i_sync_gather_;
+
+  /// Scalar index for the gathered data
+  int i_gather_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_FFT_HPP */
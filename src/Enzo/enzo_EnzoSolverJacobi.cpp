@@ -8,7 +8,6 @@
 #include "cello.hpp"
 #include "enzo.hpp"
 
-// #define DEBUG_COPY
 // #define DEBUG_SOLVER
 // #define DEBUG_NEW_REFRESH
 // #define DEBUG_TRACE
@@ -65,7 +64,7 @@ EnzoSolverJacobi::EnzoSolverJacobi
   int monitor_iter,
   int restart_cycle,
   int solve_type,
-  double weight, int iter_max) throw()
+  double weight, int iter_max, int sweeps_per_refresh) throw()
   : Solver(name,
 	   field_x,
 	   field_b,
@@ -77,8 +76,15 @@ EnzoSolverJacobi::EnzoSolverJacobi
     id_ (-1),
     w_(weight),
     n_(iter_max),
-    ir_smooth_(-1)
+    sweeps_(sweeps_per_refresh),
+    ir_smooth_(-1),
+    ir_start_(-1)
 {
+  ASSERT1 ("EnzoSolverJacobi::EnzoSolverJacobi()",
+	   "sweeps_per_refresh = %d must be at least 1",
+	   sweeps_per_refresh,
+	   (sweeps_per_refresh >= 1));
+
   // Reserve temporary fields
 
   id_ = cello::field_descr()->insert_temporary();
@@ -113,6 +119,22 @@ EnzoSolverJacobi::EnzoSolverJacobi
 #endif  
   refresh_smooth->set_callback(CkIndex_EnzoBlock::p_solver_jacobi_continue());
 
+  if (sweeps_ > 1) {
+
+    // Sweeps in ghost zones also need B there
+
+    ir_start_ = add_new_refresh_();
+
+    Refresh * refresh_start = cello::refresh(ir_start_);
+    cello::simulation()->new_refresh_set_name(ir_start_,name+":start");
+
+    refresh_start->add_field (ix_);
+    refresh_start->add_field (ib_);
+    refresh_start->set_solver_id(index());
+    refresh_start->set_callback
+      (CkIndex_EnzoBlock::p_solver_jacobi_continue());
+  }
+
 }
 
 //----------------------------------------------------------------------
@@ -188,75 +210,33 @@ void EnzoSolverJacobi::apply_(Block * block)
   
   Field field = block->data()->field();
 
-  int mx,my,mz;
-  field.dimensions(ix_,&mx,&my,&mz);
-  // int gx,gy,gz;
-  // field.ghost_depth(ix_,&gx,&gy,&gz);
-
   const int ng = A_->ghost_depth();
-  const int gx = (mx > 1) ? ng : 0;
-  const int gy = (my > 1) ? ng : 0;
-  const int gz = (mz > 1) ? ng : 0;
+
+  // Sweeps until the next refresh
+
+  const int num_sweeps = std::min(sweeps_, n_ - *piter_(block));
 
   if (is_finest_(block)) {
 
-    A_->diagonal (id_, block,ng);
-    A_->residual (ir_, ib_, ix_, block,ng);
-
-#ifdef DEBUG_COPY
-    {
-      enzo_float * R = (enzo_float*) field.values(ir_);
-      enzo_float * R_J = (enzo_float*) field.values("R_J");
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * D_J = (enzo_float*) field.values("D_J");
-      enzo_float * X = (enzo_float*) field.values(ix_);
-      enzo_float * X_J = (enzo_float*) field.values("X_J");
-      enzo_float * B = (enzo_float*) field.values(ib_);
-      enzo_float * B_J = (enzo_float*) field.values("B_J");
-      double rsum=0.0;
-      double dsum=0.0;
-      double xsum=0.0;
-      double bsum=0.0;
-      for (int i=0; i<mx*my*mz; i++) {
-	R_J[i]=R[i];
-	D_J[i]=D[i];
-	X_J[i]=X[i];
-	B_J[i]=B[i];
-	rsum+=std::abs(R[i]);
-	dsum+=std::abs(D[i]);
-	xsum+=X[i];
-	bsum+=std::abs(B[i]);
-      }
-      CkPrintf ("DEBUG_COPY rsum dsum xsum bsum %g %g %g %g\n",rsum,dsum,xsum,bsum);
-    }
-#endif    
-    enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    enzo_float * D = (enzo_float*) field.values(id_);
-
-    if (w_ == 1.0) {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    X[i] += R[i] / D[i];
-	  }
-	}
-      }
-    } else {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    X[i] = w_*(R[i] / D[i]) + (1.0-w_)*X[i];
-	  }
-	}
-      }
+    int gx,gy,gz;
+    field.ghost_depth(ix_,&gx,&gy,&gz);
+
+    ASSERT3 ("EnzoSolverJacobi::apply_()",
+	     "Field ghost depth %d is less than %d sweeps times "
+	     "Matrix ghost depth %d",
+	     gx,num_sweeps,ng,
+	     (gx >= num_sweeps*ng));
+
+    // Each sweep leaves another ng layers of ghost zones out of date
+
+    for (int sweep=0; sweep<num_sweeps; sweep++) {
+      A_->jacobi (ix_, ib_, ir_, id_, w_, block, (sweep+1)*ng);
     }
   }
+
   // Next iteration
 
-  (*piter_(block))++;
+  (*piter_(block)) += num_sweeps;
   
   // Refresh X
 
@@ -272,16 +252,19 @@ void EnzoSolverJacobi::do_refresh_(Block * block)
 #ifdef DEBUG_NEW_REFRESH  
   CkPrintf ("DEBUG_NEW_REFRESH %s:%d ir_smooth=%d\n",__FILE__,__LINE__,ir_smooth_);
 #endif  
-  Refresh * refresh = cello::refresh(ir_smooth_);
+  const int ir = (ir_start_ >= 0 && *piter_(block) == 0) ?
+    ir_start_ : ir_smooth_;
+
+  Refresh * refresh = cello::refresh(ir);
 
   refresh->set_active(is_finest_(block));
   refresh->add_field (ix_);
   
 #ifdef DEBUG_NEW_REFRESH  
-  CkPrintf ("DEBUG_NEW_REFRESH %s:%d ir_smooth=%d\n",__FILE__,__LINE__,ir_smooth_);
+  CkPrintf ("DEBUG_NEW_REFRESH %s:%d ir=%d\n",__FILE__,__LINE__,ir);
 #endif  
   block->new_refresh_start
-    (ir_smooth_, CkIndex_EnzoBlock::p_solver_jacobi_continue());
+    (ir, CkIndex_EnzoBlock::p_solver_jacobi_continue());
 }
 
 //----------------------------------------------------------------------
@@ -12,7 +12,14 @@ class EnzoSolverJacobi : public Solver {
 
   /// @class    EnzoSolverJacobi
   /// @ingroup  Enzo
-  /// @brief    [\ref Enzo] 
+  /// @brief    [\ref Enzo] Weighted Jacobi smoother
+  ///
+  /// Each sweep is performed by Matrix::jacobi(), which for
+  /// EnzoMatrixLaplace is a single fused pass over X and B.  If
+  /// sweeps_per_refresh > 1, that many sweeps are taken between ghost
+  /// zone refreshes, each on a region one stencil width smaller, which
+  /// requires the Field ghost depth to be at least sweeps_per_refresh
+  /// times the Matrix ghost depth.
 
 public: // interface
 
@@ -24,7 +31,8 @@ public: // interface
 		   int restart_cycle,
 		   int solve_type,
 		   double weight=1.0,
-		   int iter_max = 1) throw();
+		   int iter_max = 1,
+		   int sweeps_per_refresh = 1) throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoSolverJacobi);
@@ -38,7 +46,9 @@ public: // interface
       w_(0),
       i_iter_(-1),
       n_(0),
-      ir_smooth_(-1)
+      sweeps_(1),
+      ir_smooth_(-1),
+      ir_start_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -53,7 +63,9 @@ public: // interface
     p | w_;
     p | i_iter_;
     p | n_;
+    p | sweeps_;
     p | ir_smooth_;
+    p | ir_start_;
   }
 
 public: // virtual methods
@@ -144,8 +156,14 @@ protected: // attributes
   /// Number of iterations
   int n_;
 
+  /// Number of sweeps between refreshes
+  int sweeps_;
+
   // Refresh after each smoothing
   int ir_smooth_;
+
+  // Refresh of X and B before the first smoothing when sweeps_ > 1
+  int ir_start_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_JACOBI_HPP */
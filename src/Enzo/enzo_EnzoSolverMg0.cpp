@@ -138,7 +138,8 @@ EnzoSolverMg0::EnzoSolverMg0
  int index_smooth_last,
  Restrict * restrict,
  Prolong * prolong,
- int coarse_level) 
+ int coarse_level,
+ bool mixed_precision) 
   : Solver(name,
 	   field_x,
 	   field_b,
@@ -161,7 +162,8 @@ EnzoSolverMg0::EnzoSolverMg0
     ic_(-1), ir_(-1),
     mx_(0),my_(0),mz_(0),
     gx_(0),gy_(0),gz_(0),
-    coarse_level_(coarse_level)
+    coarse_level_(coarse_level),
+    mixed_precision_(mixed_precision)
 {
   // Initialize temporary fields
 
@@ -617,21 +619,10 @@ void EnzoSolverMg0::compute_residual_(EnzoBlock * enzo_block) throw()
 {
   SOLVER_CONTROL(enzo_block,"coarse+1","fine", "14 compute_residual_1");
 
-  Field field = enzo_block->data()->field();
-
-  A_->residual(ir_, ib_, ix_, enzo_block);
+  // Accumulate the residual norm on leaf Blocks in the same pass
 
-  if ( is_finest_(enzo_block) ) {
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    for (int iz=gz_; iz<mz_-gz_; iz++) {
-      for (int iy=gy_; iy<my_-gy_; iy++) {
-	for (int ix=gx_; ix<mx_-gx_; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  rr_local_ += R[i]*R[i];
-	}
-      }
-    }
-  }
+  A_->residual(ir_, ib_, ix_, enzo_block, 1,
+	       is_finest_(enzo_block) ? &rr_local_ : NULL);
 }
 
 //----------------------------------------------------------------------
@@ -958,17 +949,14 @@ FieldMsg * EnzoSolverMg0::pack_residual_(EnzoBlock * enzo_block) throw()
 
   delete field_face;
 
-  // Create a FieldMsg for sending data to parent
-  // (note: charm messages not deleted on send; are deleted on receive)
+  // Create a FieldMsg for sending data to parent, converting to
+  // single precision in mixed-precision mode
 
-  FieldMsg * msg  = new (narray) FieldMsg;
- 
   /// WARNING: double copy
 
-  // Copy FieldFace data to msg
-
-  msg->n = narray;
-  memcpy (msg->a, array, narray);
+  const precision_type precision = field.precision(ir_);
+  FieldMsg * msg = FieldMsg::create
+    (narray, array, precision, msg_precision_(precision));
   delete [] array;
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
@@ -998,8 +986,9 @@ void EnzoSolverMg0::unpack_residual_
   field_face->set_restrict(restrict_);
 
   Field field = enzo_block->data()->field();
-  
-  char * a = msg->a;
+
+  std::vector<char> buffer;
+  char * a = msg->values(field.precision(ib_), buffer);
   field_face->array_to_face(a, field);
   delete field_face;
 
@@ -1035,17 +1024,14 @@ FieldMsg * EnzoSolverMg0::pack_correction_
 
   delete field_face;
 
-  // Create a FieldMsg for sending data to parent
-  // (note: charm messages not deleted on send; are deleted on receive)
-    
-  FieldMsg * msg  = new (narray) FieldMsg;
+  // Create a FieldMsg for sending data to child, converting to
+  // single precision in mixed-precision mode
 
   /// WARNING: double copy
 
-  // Copy FieldFace data to msg
-
-  msg->n = narray;
-  memcpy (msg->a, array, narray);
+  const precision_type precision = field.precision(ix_);
+  FieldMsg * msg = FieldMsg::create
+    (narray, array, precision, msg_precision_(precision));
   delete [] array;
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
@@ -1074,8 +1060,10 @@ void EnzoSolverMg0::unpack_correction_
   field_face->set_prolong(prolong_);
 
   Field field = enzo_block->data()->field();
-  
-  field_face->array_to_face (msg->a, field);
+
+  std::vector<char> buffer;
+  char * a = msg->values(field.precision(ic_), buffer);
+  field_face->array_to_face (a, field);
 
   delete field_face;
   delete msg;
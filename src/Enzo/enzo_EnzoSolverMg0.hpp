@@ -39,7 +39,8 @@ public: // interface
    int index_smooth_last,
    Restrict * restrict,
    Prolong * prolong,
-   int coarse_level);
+   int coarse_level,
+   bool mixed_precision = false);
 
   EnzoSolverMg0() {};
 
@@ -66,7 +67,8 @@ public: // interface
        ic_(-1), ir_(-1),
        mx_(0),my_(0),mz_(0),
        gx_(0),gy_(0),gz_(0),
-       coarse_level_(0)
+       coarse_level_(0),
+       mixed_precision_(false)
   {}
 
   /// Destructor
@@ -117,6 +119,7 @@ public: // interface
     p | gz_;
 
     p | coarse_level_;
+    p | mixed_precision_;
 
   }
 
@@ -260,6 +263,10 @@ protected: // methods
 
   /// Shift RHS if needed for singular problems
   void do_shift_(EnzoBlock *, CkReductionMsg *) throw();
+
+  /// Precision of field data in restrict and prolong messages
+  precision_type msg_precision_(precision_type precision) const
+  { return mixed_precision_ ? precision_single : precision; }
   
   /// Allocate temporary Fields
   void allocate_temporary_(Block * block)
@@ -334,6 +341,10 @@ protected: // attributes
 
   /// The level of the coarse grid solve
   int coarse_level_;
+
+  /// Whether restricted residuals and prolonged corrections are sent
+  /// in single precision
+  bool mixed_precision_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_GRAVITY_MG0_HPP */
@@ -10,7 +10,6 @@
 #include <stdio.h>
 
 // #define IE_ERROR_FIELD
-// #define DEBUG_PPM
 //----------------------------------------------------------------------
 
 int EnzoBlock::SolveHydroEquations
@@ -22,115 +21,64 @@ int EnzoBlock::SolveHydroEquations
 {
   /* initialize */
 
-  int dim, size;
-
   Field field = data()->field();
   int gx,gy,gz;
   int mx,my,mz;
   field.ghost_depth(0,&gx,&gy,&gz);
   field.dimensions(0,&mx,&my,&mz);
 
-#ifdef IE_ERROR_FIELD
-  int num_ie_error = 0;
-  int *ie_error_x = new int [mx*my*mz];
-  int *ie_error_y = new int [mx*my*mz];
-  int *ie_error_z = new int [mx*my*mz];
-#else
-  int num_ie_error = -1;
-  int *ie_error_x = nullptr;
-  int *ie_error_y = nullptr;
-  int *ie_error_z = nullptr;
-#endif
+  const int rank = cello::rank();
 
+  // The solver's parameters are read from the configuration rather than
+  // from EnzoBlock's per-node static copies
+  const EnzoConfig * enzo_config = enzo::config();
 
-  //------------------------------
-  // Prepare color field parameters
-  //------------------------------
+  EnzoFieldArrayFactory array_factory(this);
 
-  // ncolor: number of color fields
+  EnzoPpmSolver::Fields fields;
+  fields.density      = array_factory.from_name("density");
+  fields.total_energy = array_factory.from_name("total_energy");
+  if (field.is_field("internal_energy")) {
+    fields.internal_energy = array_factory.from_name("internal_energy");
+  }
 
-  int    ncolor  = field.groups()->size("color");
+  /* velocity_x must exist, but if y & z aren't present, then create blank
+     arrays for them (since the solver needs to advect something). */
+
+  const char * velocity_names[3] = {"velocity_x","velocity_y","velocity_z"};
+  const char * acceleration_names[3] =
+    {"acceleration_x","acceleration_y","acceleration_z"};
+  for (int dim = 0; dim < 3; dim++) {
+    fields.velocity[dim] = (dim < rank) ?
+      array_factory.from_name(velocity_names[dim]) : EFlt3DArray(mz,my,mx);
+    if (dim < rank && field.is_field(acceleration_names[dim])) {
+      fields.acceleration[dim] = array_factory.from_name(acceleration_names[dim]);
+    }
+  }
 
-  // colorpt: the color 'array' (contains all color fields)
-  enzo_float * colorpt = (enzo_float *) field.permanent();
+  //------------------------------
+  // Prepare color fields
+  //------------------------------
 
-  // coloff: offsets into the color array (for each color field)
-  int * coloff   = (ncolor > 0) ? (new int [ncolor]) : NULL;
-  int index_color = 0;
   for (int index_field = 0;
        index_field < field.field_count();
        index_field++) {
     std::string name = field.field_name(index_field);
     if (field.groups()->is_in(name,"color")) {
-      coloff[index_color++]
-	= (enzo_float *)(field.values(index_field)) - colorpt;
+      fields.colors.push_back(array_factory.from_name(name));
     }
-
-  }
-
-  // No subgrids, so colindex is NULL
-  int *colindex         = NULL;
-
-  /* Compute size (in enzo_floats) of the current grid. */
-
-  int rank = cello::rank();
-
-  size = 1;
-  for (dim = 0; dim < rank; dim++)
-    size *= GridDimension[dim];
-
-  enzo_float * density         = (enzo_float *) field.values("density");
-  enzo_float * total_energy    = (enzo_float *) field.values("total_energy");
-  enzo_float * internal_energy = (enzo_float *) field.values("internal_energy");
-
-  /* velocity_x must exist, but if y & z aren't present, then create blank
-     buffers for them (since the solver needs to advect something). */
-
-  enzo_float * velocity_x = NULL;
-  enzo_float * velocity_y = NULL;
-  enzo_float * velocity_z = NULL;
-
-  velocity_x = (enzo_float *) field.values("velocity_x");
-
-  if (rank >= 2) {
-    velocity_y = (enzo_float *) field.values("velocity_y");
-  } else {
-    velocity_y = new enzo_float[size];
-    for (int i=0; i<size; i++) velocity_y[i] = 0.0;
-  }
-
-    if (rank >= 3) {
-    velocity_z = (enzo_float *) field.values("velocity_z");
-  } else {
-    velocity_z = new enzo_float[size];
-    for (int i=0; i<size; i++) velocity_z[i] = 0.0;
   }
 
-  enzo_float * acceleration_x  = field.is_field("acceleration_x") ?
-    (enzo_float *) field.values("acceleration_x") : NULL;
-  enzo_float * acceleration_y  = field.is_field("acceleration_y") ?
-    (enzo_float *)field.values("acceleration_y") : NULL;
-  enzo_float * acceleration_z  = field.is_field("acceleration_z") ?
-    (enzo_float *)field.values("acceleration_z") : NULL;
-
-
-  /* Determine if Gamma should be a scalar or a field. */
-
-  const int in = cello::index_static();
-
   /* Set minimum support. */
 
   enzo_float MinimumSupportEnergyCoefficient = 0;
-  if (UseMinimumPressureSupport[in] == TRUE) {
+  if (enzo_config->ppm_use_minimum_pressure_support) {
     if (SetMinimumSupport(MinimumSupportEnergyCoefficient,
 			  comoving_coordinates) == ENZO_FAIL) {
       ERROR("EnzoBlock::SolveHydroEquations()",
 	    "Grid::SetMinimumSupport() returned ENZO_FAIL");
     }
   }
-  /* allocate space for fluxes */
-
-  int NumberOfSubgrids = 1;
 
   /* fix grid quantities so they are defined to at least 3 dims */
 
@@ -141,86 +89,47 @@ int EnzoBlock::SolveHydroEquations
     //      GridGlobalStart[i] = 0;
   }
 
-  /* allocate temporary space for solver (enough to fit 31 of the largest
-     possible 2d slices plus 4*ncolor). */
-
-  int tempsize = MAX(MAX(GridDimension[0]*GridDimension[1],
-			 GridDimension[1]*GridDimension[2]),
-		     GridDimension[2]*GridDimension[0]);
-
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolor*4)];
-
-  /* create and fill in arrays which are easier for the solver to
-     understand. */
-
-  size = NumberOfSubgrids*3*(18+2*ncolor) + 1;
-  int * array = new int[size];
-  for (int i=0; i<size; i++) array[i] = 0;
-
-  int * p = array;
-  int *leftface  = p; p+=3;
-  int *rightface = p; p+=3;
-  int *istart    = p; p+=3;
-  int *jstart    = p; p+=3;
-  int *iend      = p; p+=3;
-  int *jend      = p; p+=3;
-  int *dindex    = p; p+=3*2; // 3 axes 2 faces
-  int *Eindex    = p; p+=3*2;
-  int *uindex    = p; p+=3*2;
-  int *vindex    = p; p+=3*2;
-  int *windex    = p; p+=3*2;
-  int *geindex   = p; p+=3*2;
-
-  // Offsets computed from the "standard" pointer to the start of each
-  // flux data
+  /* Describe where the solver saves the fluxes through the block faces
+     (used for flux correction). Color fluxes are not saved. */
 
   FluxData * flux_data = data()->flux_data();
 
-  const int nx = mx - 2*gx;
-  const int ny = my - 2*gy;
-  const int nz = mz - 2*gz;
-
-  enzo_float * standard = temp;
+  EnzoPpmSolver::FluxStore flux_store[3][2][EnzoPpmSolver::num_flux_quantities];
 
-  // int l3[3] = {gx,gy,gz};
-  // int u3[3] = {mx-gx,my-gy,mz-gz};
-  int l3[3] = {gx,gy,gz};
-  int u3[3] = {mx-gx-1,my-gy-1,mz-gz-1};
   const int nf = flux_data->num_fields();
   for (int i_f=0; i_f <nf; i_f++) {
-    int * flux_index = 0;
     const int index_field = flux_data->index_field(i_f);
     const std::string field_name = field.field_name(index_field);
 
-    if (field_name == "density")         flux_index = dindex;
-    if (field_name == "velocity_x")      flux_index = uindex;
-    if (field_name == "velocity_y")      flux_index = vindex;
-    if (field_name == "velocity_z")      flux_index = windex;
-    if (field_name == "total_energy")    flux_index = Eindex;
-    if (field_name == "internal_energy") flux_index = geindex;
+    int quantity = -1;
+    if (field_name == "density")
+      quantity = EnzoPpmSolver::flux_density;
+    if (field_name == "velocity_x")
+      quantity = EnzoPpmSolver::flux_velocity_x;
+    if (field_name == "velocity_y")
+      quantity = EnzoPpmSolver::flux_velocity_y;
+    if (field_name == "velocity_z")
+      quantity = EnzoPpmSolver::flux_velocity_z;
+    if (field_name == "total_energy")
+      quantity = EnzoPpmSolver::flux_total_energy;
+    if (field_name == "internal_energy")
+      quantity = EnzoPpmSolver::flux_internal_energy;
+    if (quantity < 0) continue;
 
     for (int axis=0; axis<rank; axis++) {
-      leftface[axis] = l3[axis];
-      rightface[axis] = u3[axis];
-
-      const int axis_i = (axis == 0) ? 1 : 0;
-      const int axis_j = (axis == 2) ? 1 : 2;
-      istart[axis] = l3[axis_i];
-      jstart[axis] = l3[axis_j];
-      iend[axis] = u3[axis_i];
-      jend[axis] = u3[axis_j];
       for (int face=0; face<2; face++) {
         FaceFluxes * ff_b = flux_data->block_fluxes(axis,face,i_f);
         int dx,dy,dz;
-        flux_index[axis*2+face] =
-          ((enzo_float *)ff_b->flux_array(&dx,&dy,&dz).data()) - standard;
+        EnzoPpmSolver::FluxStore & store = flux_store[axis][face][quantity];
+        store.values =
+          (enzo_float *)ff_b->flux_array(&dx,&dy,&dz).data();
+        store.stride[0] = dx;
+        store.stride[1] = dy;
+        store.stride[2] = dz;
       }
     }
   }
 
-  //==================================================
-  //    enzo_float *standard = SubgridFluxes[0]->LeftFluxes[0][0];
-
   /* If using comoving coordinates, multiply dx by a(n+1/2).
      In one fell swoop, this recasts the equations solved by solver
      in comoving form (except for the expansion terms which are taken
@@ -238,65 +147,42 @@ int EnzoBlock::SolveHydroEquations
 	  "comoving_coordinates enabled but missing EnzoPhysicsCosmology",
 	  ! (comoving_coordinates && (cosmology == NULL)) );
 
-  /* Create a cell width array to pass (and convert to absolute coords). */
-
-  enzo_float * CellWidthTemp[MAX_DIMENSION];
-  for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    CellWidthTemp[dim] = new enzo_float [GridDimension[dim]];
-    if (dim < rank) {
-      for (int i=0; i<GridDimension[dim]; i++)
-	CellWidthTemp[dim][i] = (cosmo_a*CellWidth[dim]);
-    } else {
-      for (int i=0; i<GridDimension[dim]; i++)
-	CellWidthTemp[dim][i] = 1.0;
-    }
-  }
+  /* Compute the cell widths (converted to absolute coords). */
 
-  /* call a Fortran routine to actually compute the hydro equations
-     on this grid.
-     Notice that it is hard-wired for three dimensions, but it does
-     the right thing for < 3 dimensions. */
-  /* note: Start/EndIndex are zero based */
-
-  int gravity_on = (acceleration_x != NULL) ? 1 : 0;
-
-  int iconsrec = 0;
-  int iposrec = 0;
-
-  int error = 0;
-
-  FORTRAN_NAME(ppm_de)
-    (
-     density, total_energy, velocity_x, velocity_y, velocity_z,
-     internal_energy,
-     &gravity_on,
-     acceleration_x,
-     acceleration_y,
-     acceleration_z,
-     &Gamma[in], &dt, &cycle_,
-     CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
-     &rank, &GridDimension[0], &GridDimension[1],
-     &GridDimension[2], GridStartIndex, GridEndIndex,
-     &PPMFlatteningParameter[in],
-     &PressureFree[in],
-     &iconsrec, &iposrec,
-     &PPMDiffusionParameter[in], &PPMSteepeningParameter[in],
-     &DualEnergyFormalism[in], &DualEnergyFormalismEta1[in],
-     &DualEnergyFormalismEta2[in],
-     &NumberOfSubgrids, leftface, rightface,
-     istart, iend, jstart, jend,
-     standard, dindex, Eindex, uindex, vindex, windex,
-     geindex, temp,
-     &ncolor, colorpt, coloff, colindex,
-     &error, ie_error_x,ie_error_y,ie_error_z,&num_ie_error
-     );
-
-  if (error != 0) {
-    char buffer[256];
-    snprintf (buffer,255,"Error %d in call to ppm_de block %s",error,name().c_str());
+  enzo_float cell_width[3];
+  for (int dim = 0; dim < 3; dim++) {
+    cell_width[dim] = (dim < rank) ? cosmo_a*CellWidth[dim] : 1.0;
   }
 
+  /* Solve the hydro equations on this grid. The solver is hard-wired
+     for three dimensions, but it does the right thing for < 3
+     dimensions. */
+
+  EnzoPpmSolver::Parameters parameters;
+  parameters.gamma             = enzo_config->field_gamma;
+  parameters.flattening        = enzo_config->ppm_flattening;
+  parameters.per_pencil_flattening
+    = enzo_config->ppm_flattening_per_pencil;
+  parameters.diffusion         = enzo_config->ppm_diffusion;
+  parameters.steepening        = enzo_config->ppm_steepening;
+  parameters.pressure_free     = enzo_config->ppm_pressure_free;
+  parameters.dual_energy       = enzo_config->ppm_dual_energy;
+  parameters.dual_energy_eta_1 = enzo_config->ppm_dual_energy_eta_1;
+  parameters.dual_energy_eta_2 = enzo_config->ppm_dual_energy_eta_2;
+
+  const int ghost_depth[3] = {gx, (rank >= 2) ? gy : 0, (rank >= 3) ? gz : 0};
+
+  EnzoPpmSolver solver (parameters, rank, ghost_depth);
+
 #ifdef IE_ERROR_FIELD
+  std::vector< std::array<int,3> > ie_error;
+  solver.record_negative_cells (&ie_error);
+#endif
+
+  solver.solve (fields, dt, cell_width, cycle_, flux_store);
+
+#ifdef IE_ERROR_FIELD
+  const int num_ie_error = ie_error.size();
   if (num_ie_error > 0) {
     CkPrintf ("DEBUG_IE_ERROR num_ie_error = %d\n",num_ie_error);
 
@@ -305,33 +191,14 @@ int EnzoBlock::SolveHydroEquations
       error_ie[i] = 0.0;
     }
     for (int k=0; k<num_ie_error; k++) {
-      int i = ie_error_x[k] + mx*(ie_error_y[k] + my*ie_error_z[k]);
+      int i = ie_error[k][0] + mx*(ie_error[k][1] + my*ie_error[k][2]);
       CkPrintf ("DEBUG_IE_ERROR setting error_ie[%d (%d %d %d)]\n",
-                i,ie_error_x[k],ie_error_y[k],ie_error_z[k]);
+                i,ie_error[k][0],ie_error[k][1],ie_error[k][2]);
       error_ie[i] = 1.0;
     }
   }
 #endif
 
-  for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    delete [] CellWidthTemp[dim];
-  }
-
-  /* deallocate temporary space for solver */
-
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
-
-  delete [] array;
-
-  delete [] coloff;
-#ifdef IE_ERROR_FIELD
-  delete [] ie_error_x;
-  delete [] ie_error_y;
-  delete [] ie_error_z;
-#endif
-
   return ENZO_SUCCESS;
 
 }
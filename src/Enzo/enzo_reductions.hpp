@@ -1,5 +0,0 @@
-extern CkReduction::reducerType r_method_turbulence_type;
-extern CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs);
-extern void register_method_turbulence(void);
-
-
@@ -0,0 +1,162 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoEFltArrayMap.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Test program for the EnzoEFltArrayMap class
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// checks that every key maps to an index that maps back to the key (and
+/// vice versa)
+bool round_trips(const EnzoEFltArrayMap &map,
+                 const std::vector<std::string> &keys)
+{
+  if (map.size() != keys.size()) { return false; }
+  for (std::size_t i = 0; i < keys.size(); i++){
+    if (!map.contains(keys[i]))            { return false; }
+    if (map.index(keys[i]) != i)           { return false; }
+    if (map.key(i) != keys[i])             { return false; }
+    if (map.index(map.key(i)) != i)        { return false; }
+    if (map.key(map.index(keys[i])) != keys[i]) { return false; }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoEFltArrayMap");
+
+  // the keys are deliberately not in alphabetical order
+  std::vector<std::string> keys = {"velocity_x", "density", "pressure",
+                                   "bfield_z", "velocity_y", "bfield_x"};
+
+  // frozen map constructed from a list of keys and a shape
+
+  EnzoEFltArrayMap frozen("frozen", keys, std::array<int,3>{{2,3,4}});
+
+  unit_func ("index()");
+  unit_assert (round_trips(frozen, keys));
+
+  unit_func ("contains()");
+  unit_assert (frozen.contains("pressure"));
+  unit_assert (!frozen.contains("velocity_z"));
+  unit_assert (!frozen.contains(""));
+
+  unit_func ("is_frozen()");
+  unit_assert (frozen.is_frozen());
+
+  unit_func ("backing_array()");
+  unit_assert (frozen.has_backing_array());
+  {
+    // the copy is a view that shares data with the backing array
+    CelloArray<enzo_float,4> backing = frozen.backing_array();
+    unit_assert (backing.shape(0) == (int)keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++){
+      EFlt3DArray arr = frozen.at(i);
+      arr(1,2,3) = (enzo_float)(i + 1);
+    }
+    bool aliased = true;
+    for (std::size_t i = 0; i < keys.size(); i++){
+      aliased &= (backing((int)i,1,2,3) == (enzo_float)(i + 1));
+      aliased &= (frozen.at(keys[i])(1,2,3) == (enzo_float)(i + 1));
+    }
+    unit_assert (aliased);
+  }
+
+  unit_func ("subarray_map()");
+  {
+    EnzoEFltArrayMap sub = frozen.subarray_map(CSlice(1, 2), CSlice(1, 3),
+                                               CSlice(2, 4));
+    unit_assert (round_trips(sub, keys));
+    unit_assert (sub.is_frozen());
+    unit_assert (sub.has_backing_array());
+    CelloArray<enzo_float,4> sub_backing = sub.backing_array();
+    bool same_data = true;
+    for (std::size_t i = 0; i < keys.size(); i++){
+      same_data &= (sub.at(i).shape(0) == 1);
+      same_data &= (sub.at(i).shape(1) == 2);
+      same_data &= (sub.at(i).shape(2) == 2);
+      same_data &= (sub.at(i)(0,1,1) == (enzo_float)(i + 1));
+      same_data &= (sub_backing((int)i,0,1,1) == (enzo_float)(i + 1));
+    }
+    unit_assert (same_data);
+  }
+
+  // copies share data and preserve the indices
+
+  unit_func ("EnzoEFltArrayMap(const EnzoEFltArrayMap&)");
+  {
+    EnzoEFltArrayMap copy(frozen);
+    unit_assert (round_trips(copy, keys));
+    unit_assert (copy.at(copy.index("bfield_z"))(1,2,3) ==
+                 frozen.at("bfield_z")(1,2,3));
+  }
+
+  // ordinary map with keys inserted one at a time
+
+  EnzoEFltArrayMap ordinary("ordinary");
+  for (std::size_t i = 0; i < keys.size(); i++){
+    ordinary[keys[i]] = EFlt3DArray(2,2,2);
+    ordinary[keys[i]](0,0,0) = (enzo_float)(10 * i);
+  }
+
+  unit_func ("operator[]");
+  unit_assert (round_trips(ordinary, keys));
+  unit_assert (!ordinary.is_frozen());
+  unit_assert (!ordinary.has_backing_array());
+
+  {
+    // accessing an existing key doesn't insert a new entry
+    EFlt3DArray &arr = ordinary["density"];
+    unit_assert (ordinary.size() == keys.size());
+    unit_assert (arr(0,0,0) == ordinary.at(ordinary.index("density"))(0,0,0));
+  }
+
+  unit_func ("get()");
+  {
+    bool match = true;
+    for (std::size_t i = 0; i < keys.size(); i++){
+      match &= (ordinary.get(i)(0,0,0) == (enzo_float)(10 * i));
+      match &= (ordinary.get(keys[i])(0,0,0) == (enzo_float)(10 * i));
+    }
+    unit_assert (match);
+  }
+
+  // frozen map wrapping existing arrays
+
+  unit_func ("EnzoEFltArrayMap(name, keys, arrays)");
+  {
+    std::vector<EFlt3DArray> arrays;
+    for (std::size_t i = 0; i < keys.size(); i++){
+      arrays.push_back(ordinary.at(i));
+    }
+    EnzoEFltArrayMap wrapped("wrapped", keys, arrays);
+    unit_assert (round_trips(wrapped, keys));
+    unit_assert (wrapped.is_frozen());
+    unit_assert (!wrapped.has_backing_array());
+    unit_assert (wrapped.at("pressure")(0,0,0) ==
+                 ordinary.at("pressure")(0,0,0));
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+#include "enzo.def.h"
@@ -0,0 +1,189 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoMatrixLaplace.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Test program for the EnzoMatrixLaplace class
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// Initialize an array of m values with a deterministic non-smooth
+/// pattern
+std::vector<enzo_float> pattern (int m, double a, double b)
+{
+  std::vector<enzo_float> x(m);
+  for (int i=0; i<m; i++) x[i] = sin(a*i) + cos(b*i*i);
+  return x;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoMatrixLaplace");
+
+  // matvec(): the stencils are exact for polynomials of degree 3
+  // (order 2) or 5 (orders 4 and 6; the sixth moment of the order 6
+  // stencil does not vanish)
+
+  unit_func ("matvec()");
+  {
+    const int g = 3;
+    bool ok = true;
+    for (int order=2; order<=6; order+=2) {
+      for (int rank=1; rank<=3; rank++) {
+        const int n3[3] = {10, (rank >= 2) ? 8 : 1, (rank >= 3) ? 6 : 1};
+        const int m3[3] = {n3[0]+2*g,
+                           (rank >= 2) ? n3[1]+2*g : 1,
+                           (rank >= 3) ? n3[2]+2*g : 1};
+        const double h3[3] = {1.0/n3[0], 1.0/n3[1], 1.0/n3[2]};
+        const int m = m3[0]*m3[1]*m3[2];
+        const int ng = order/2;
+        const int d = (order == 2) ? 3 : 5;
+
+        EnzoMatrixLaplace A(order);
+        A.set_dimensions (m3[0],m3[1],m3[2]);
+        A.set_cell_width (h3[0],h3[1],h3[2]);
+
+        // x^d + 2 y^d + 3 z^d, with a different polynomial along
+        // each axis so that each axis is checked separately
+
+        std::vector<enzo_float> x(m), y(m,0.0), y_ref(m,0.0);
+        for (int iz=0; iz<m3[2]; iz++) {
+          for (int iy=0; iy<m3[1]; iy++) {
+            for (int ix=0; ix<m3[0]; ix++) {
+              const int i = ix + m3[0]*(iy + m3[1]*iz);
+              const double p3[3] = {(ix-g+0.5)*h3[0],
+                                    (iy-g+0.5)*h3[1],
+                                    (iz-g+0.5)*h3[2]};
+              x[i] = 0.0;
+              for (int axis=0; axis<rank; axis++) {
+                x[i]     += (axis+1)*pow(p3[axis],d);
+                y_ref[i] += (axis+1)*d*(d-1)*pow(p3[axis],d-2);
+              }
+            }
+          }
+        }
+        A.matvec (default_precision,y.data(),x.data(),ng);
+
+        double error = 0.0;
+        double norm = 0.0;
+        for (int iz=0; iz<m3[2]; iz++) {
+          for (int iy=0; iy<m3[1]; iy++) {
+            for (int ix=0; ix<m3[0]; ix++) {
+              const int i = ix + m3[0]*(iy + m3[1]*iz);
+              const bool computed =
+                (ng <= ix && ix < m3[0]-ng) &&
+                (rank < 2 || (ng <= iy && iy < m3[1]-ng)) &&
+                (rank < 3 || (ng <= iz && iz < m3[2]-ng));
+              if (computed) {
+                error = std::max(error,fabs(y[i] - y_ref[i]));
+                norm  = std::max(norm,fabs(y_ref[i]));
+              }
+            }
+          }
+        }
+        ok = ok && (error <= 1e-8*norm);
+      }
+    }
+    unit_assert (ok);
+  }
+
+  // Weighted Jacobi: X <-- X + w*D^-1*(B - A*X).  The reference values
+  // are computed with matvec() and the diagonal (A applied to a unit
+  // vector), with all updated values using the old X.  For w != 1
+  // this differs from w*D^-1*(B - A*X) + (1-w)*X, which Jacobi used
+  // before; in particular the exact solution is no longer a fixed
+  // point of that update.
+
+  unit_func ("jacobi()");
+  {
+    const int g = 3;
+    bool ok_sweep = true;
+    bool ok_fixed = true;
+    for (int order=2; order<=6; order+=2) {
+      for (int rank=1; rank<=3; rank++) {
+        const int n3[3] = {10, (rank >= 2) ? 8 : 1, (rank >= 3) ? 6 : 1};
+        const int m3[3] = {n3[0]+2*g,
+                           (rank >= 2) ? n3[1]+2*g : 1,
+                           (rank >= 3) ? n3[2]+2*g : 1};
+        const int gi3[3] = {g, (rank >= 2) ? g : 0, (rank >= 3) ? g : 0};
+        const int m = m3[0]*m3[1]*m3[2];
+        const int ng = order/2;
+
+        EnzoMatrixLaplace A(order);
+        A.set_dimensions (m3[0],m3[1],m3[2]);
+        A.set_cell_width (1.0/n3[0],1.0/n3[1],1.0/n3[2]);
+
+        // diagonal from A applied to a unit vector at the center
+
+        const int ic = m3[0]/2 + m3[0]*(m3[1]/2 + m3[1]*(m3[2]/2));
+        std::vector<enzo_float> e(m,0.0), ae(m,0.0);
+        e[ic] = 1.0;
+        A.matvec (default_precision,ae.data(),e.data(),ng);
+        const double d = ae[ic];
+
+        for (double w : {1.0, 0.8}) {
+
+          std::vector<enzo_float> x = pattern(m,0.7,1.3);
+          std::vector<enzo_float> b = pattern(m,0.3,0.9);
+          std::vector<enzo_float> ax(m,0.0);
+          A.matvec (default_precision,ax.data(),x.data(),ng);
+
+          std::vector<enzo_float> x_new (x);
+          A.jacobi (x_new.data(),b.data(),w,ng,gi3);
+
+          double error = 0.0;
+          double norm = 0.0;
+          for (int iz=0; iz<m3[2]; iz++) {
+            for (int iy=0; iy<m3[1]; iy++) {
+              for (int ix=0; ix<m3[0]; ix++) {
+                const int i = ix + m3[0]*(iy + m3[1]*iz);
+                const bool updated =
+                  (ng <= ix && ix < m3[0]-ng) &&
+                  (rank < 2 || (ng <= iy && iy < m3[1]-ng)) &&
+                  (rank < 3 || (ng <= iz && iz < m3[2]-ng));
+                const double x_ref = updated ?
+                  x[i] + w*(b[i] - ax[i])/d : x[i];
+                error = std::max(error,fabs(x_new[i] - x_ref));
+                norm  = std::max(norm,fabs(x_ref));
+              }
+            }
+          }
+          ok_sweep = ok_sweep && (error <= 1e-12*norm);
+
+          // the exact solution of A*X = B is unchanged by the sweep
+
+          std::vector<enzo_float> x_fixed (x);
+          A.jacobi (x_fixed.data(),ax.data(),w,ng,gi3);
+          error = 0.0;
+          for (int i=0; i<m; i++) {
+            error = std::max(error,fabs(x_fixed[i] - x[i]));
+          }
+          ok_fixed = ok_fixed && (error <= 1e-12*norm);
+        }
+      }
+    }
+    unit_assert (ok_sweep);
+    unit_assert (ok_fixed);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+#include "enzo.def.h"
@@ -0,0 +1,135 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoMethodGravity.cpp
+/// @date     Sat Oct 17 2026
+/// @brief    Test program for the initial guess of the EnzoMethodGravity class
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// Potential of a Block with m cells at the given time, linear in time
+/// (and with values exact in binary) so that extrapolation is exact
+std::vector<enzo_float> potential (int m, double time)
+{
+  std::vector<enzo_float> x(m);
+  for (int i=0; i<m; i++) x[i] = (1.0 + i) + 0.5*(i % 3)*time;
+  return x;
+}
+
+/// Prolong the first half of the parent array x into a child array
+/// twice as long by injection
+std::vector<enzo_float> prolong (const std::vector<enzo_float> & x)
+{
+  std::vector<enzo_float> y(x.size());
+  for (size_t i=0; i<y.size(); i++) y[i] = x[i/2];
+  return y;
+}
+
+//----------------------------------------------------------------------
+
+/// The potentials and Block scalars used by the initial guess
+struct History {
+  History (int m)
+    : X(m,0.0), X1(m,0.0), X2(m,0.0),
+      num_saved(0), time_1(0.0), time_2(0.0)
+  { }
+  std::vector<enzo_float> X, X1, X2;
+  int num_saved;
+  long double time_1, time_2;
+
+  void initial_guess (double time)
+  {
+    EnzoMethodGravity::initial_guess
+      (X.data(), X1.data(), X2.data(), X.size(), 2,
+       num_saved, time, time_1, time_2);
+  }
+  void save_history (double time)
+  {
+    EnzoMethodGravity::save_history
+      (X.data(), X1.data(), X2.data(), X.size(), 2,
+       num_saved, time, time_1, time_2);
+  }
+};
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoMethodGravity");
+
+  const int m = 8;
+
+  // Two solves on a parent Block, then a refinement: the child's
+  // fields are prolonged but its scalars start from zero
+
+  History parent(m);
+  for (int cycle=0; cycle<2; cycle++) {
+    parent.initial_guess(cycle);
+    parent.X = potential(m,cycle);
+    parent.save_history(cycle);
+  }
+
+  History child(m);
+  child.X  = prolong(parent.X);
+  child.X1 = prolong(parent.X1);
+  child.X2 = prolong(parent.X2);
+
+  unit_func ("initial_guess()");
+
+  // a child without saved potentials starts from its prolonged
+  // potential, not from zero
+
+  child.initial_guess(2);
+  unit_assert (child.X == prolong(potential(m,1)));
+  child.X = prolong(potential(m,2));
+  child.save_history(2);
+
+  // then from its previous potential
+
+  child.initial_guess(3);
+  unit_assert (child.X == prolong(potential(m,2)));
+  child.X = prolong(potential(m,3));
+  child.save_history(3);
+
+  // then extrapolates from its own two previous potentials
+
+  child.initial_guess(4);
+  unit_assert (child.X == prolong(potential(m,4)));
+
+  // Non-leaf Blocks also solve, so a parent keeps its own history
+  // current while refined and can extrapolate after coarsening
+
+  for (int cycle=2; cycle<5; cycle++) {
+    parent.initial_guess(cycle);
+    parent.X = potential(m,cycle);
+    parent.save_history(cycle);
+  }
+  parent.initial_guess(5);
+  unit_assert (parent.X == potential(m,5));
+
+  unit_func ("save_history()");
+
+  unit_assert (child.num_saved == 2);
+  unit_assert (child.time_1 == 3.0 && child.time_2 == 2.0);
+  unit_assert (child.X1 == prolong(potential(m,3)));
+  unit_assert (child.X2 == prolong(potential(m,2)));
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+#include "enzo.def.h"
@@ -0,0 +1,141 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoPpmSolver.cpp
+/// @date     Sat Oct 17 2026
+/// @brief    Test program for the plane chunks of the EnzoPpmSolver class
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// Initialize the fields of an m3 block with smooth, non-symmetric
+/// profiles, plus a converging flow across an oblique pressure jump (so
+/// that flattening is active in the reference pencils of every sweep)
+EnzoPpmSolver::Fields initial_fields (const int m3[3])
+{
+  EnzoPpmSolver::Fields fields;
+  fields.density      = EFlt3DArray(m3[2],m3[1],m3[0]);
+  fields.total_energy = EFlt3DArray(m3[2],m3[1],m3[0]);
+  for (int axis=0; axis<3; axis++) {
+    fields.velocity[axis] = EFlt3DArray(m3[2],m3[1],m3[0]);
+  }
+  fields.colors.push_back(EFlt3DArray(m3[2],m3[1],m3[0]));
+
+  for (int iz=0; iz<m3[2]; iz++) {
+    for (int iy=0; iy<m3[1]; iy++) {
+      for (int ix=0; ix<m3[0]; ix++) {
+        const double x = (ix + 0.5)/m3[0];
+        const double y = (iy + 0.5)/m3[1];
+        const double z = (iz + 0.5)/m3[2];
+        const double p = (x + y + z < 1.4 + 0.1*sin(5.0*x)) ? 10.0 : 1.0;
+        const double d = 1.0 + 0.3*sin(6.0*x + 2.0*y) + 0.2*cos(5.0*z);
+        const double u = 0.2*sin(4.0*y + z) - (x - 0.5);
+        const double v = 0.1*cos(3.0*x - 2.0*z) - (y - 0.5);
+        const double w = 0.15*sin(2.0*x + 5.0*y) - (z - 0.5);
+        fields.density(iz,iy,ix)     = d;
+        fields.velocity[0](iz,iy,ix) = u;
+        fields.velocity[1](iz,iy,ix) = v;
+        fields.velocity[2](iz,iy,ix) = w;
+        fields.total_energy(iz,iy,ix) =
+          p/(0.4*d) + 0.5*(u*u + v*v + w*w);
+        fields.colors[0](iz,iy,ix) = d*x;
+      }
+    }
+  }
+  return fields;
+}
+
+//----------------------------------------------------------------------
+
+/// Return the maximum absolute difference between the fields
+double difference (EnzoPpmSolver::Fields & a, EnzoPpmSolver::Fields & b)
+{
+  std::vector<EFlt3DArray *> fa = {&a.density, &a.total_energy,
+                                   &a.velocity[0], &a.velocity[1],
+                                   &a.velocity[2], &a.colors[0]};
+  std::vector<EFlt3DArray *> fb = {&b.density, &b.total_energy,
+                                   &b.velocity[0], &b.velocity[1],
+                                   &b.velocity[2], &b.colors[0]};
+  double error = 0.0;
+  for (size_t n=0; n<fa.size(); n++) {
+    EFlt3DArray & x = *fa[n];
+    EFlt3DArray & y = *fb[n];
+    for (int iz=0; iz<x.shape(0); iz++) {
+      for (int iy=0; iy<x.shape(1); iy++) {
+        for (int ix=0; ix<x.shape(2); ix++) {
+          error = std::max(error,(double)fabs(x(iz,iy,ix) - y(iz,iy,ix)));
+        }
+      }
+    }
+  }
+  return error;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoPpmSolver");
+
+  // Dividing the planes of each sweep into chunks gives the same
+  // results as updating them serially, with and without diffusion, and
+  // including when the reference flattening coefficients are saved by
+  // the first plane (the y sweep without diffusion)
+
+  unit_func ("set_num_chunks()");
+  {
+    const int m3[3] = {14,12,10};
+    const int g3[3] = {3,3,3};
+    const enzo_float h3[3] = {1.0/8, 1.0/6, 1.0/4};
+
+    bool ok = true;
+    for (int diffusion=0; diffusion<=1; diffusion++) {
+      for (int flattening : {0, 1, 3}) {
+
+        EnzoPpmSolver::Parameters parameters;
+        parameters.gamma = 1.4;
+        parameters.flattening = flattening;
+        parameters.per_pencil_flattening = false;
+        parameters.diffusion = diffusion;
+        parameters.steepening = true;
+        parameters.pressure_free = false;
+        parameters.dual_energy = false;
+        parameters.dual_energy_eta_1 = 0.001;
+        parameters.dual_energy_eta_2 = 0.1;
+
+        EnzoPpmSolver serial (parameters,3,g3);
+        serial.set_num_chunks(1);
+        EnzoPpmSolver chunked (parameters,3,g3);
+        chunked.set_num_chunks(3);
+
+        EnzoPpmSolver::Fields fields_serial  = initial_fields(m3);
+        EnzoPpmSolver::Fields fields_chunked = initial_fields(m3);
+
+        for (int cycle=0; cycle<3; cycle++) {
+          serial.solve  (fields_serial, 0.002,h3,cycle);
+          chunked.solve (fields_chunked,0.002,h3,cycle);
+        }
+        ok = ok && (difference(fields_serial,fields_chunked) == 0.0);
+      }
+    }
+    unit_assert (ok);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+#include "enzo.def.h"
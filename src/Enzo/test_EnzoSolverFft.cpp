@@ -0,0 +1,163 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoSolverFft.cpp
+/// @date     Fri Oct 16 2026
+/// @brief    Test program for the direct solves of the EnzoSolverFft class
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#define CK_TEMPLATES_ONLY
+#include "enzo.def.h"
+#undef CK_TEMPLATES_ONLY
+
+//----------------------------------------------------------------------
+
+/// Apply the EnzoMatrixLaplace stencil of the given order to the
+/// periodic n3 grid x
+std::vector<double> apply_laplace (const std::vector<double> & x,
+                                   const int n3[3], const double h3[3],
+                                   int order)
+{
+  double c[4] = {0.0, 0.0, 0.0, 0.0};
+  double scale = 1.0;
+  if (order == 2) {
+    c[0] = -2.0;    c[1] = 1.0;
+  } else if (order == 4) {
+    c[0] = -30.0;   c[1] = 16.0;   c[2] = -1.0;
+    scale = 12.0;
+  } else {
+    c[0] = -2720.0; c[1] = 1455.0; c[2] = -96.0; c[3] = 1.0;
+    scale = 1080.0;
+  }
+  std::vector<double> y(x.size(),0.0);
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      for (int ix=0; ix<n3[0]; ix++) {
+        const int i3[3] = {ix,iy,iz};
+        const int i = ix + n3[0]*(iy + n3[1]*iz);
+        for (int axis=0; axis<3; axis++) {
+          if (n3[axis] == 1) continue;
+          double value = c[0]*x[i];
+          for (int j=1; j<4; j++) {
+            int ip3[3] = {ix,iy,iz};
+            int im3[3] = {ix,iy,iz};
+            ip3[axis] = (i3[axis] + j) % n3[axis];
+            im3[axis] = (i3[axis] - j + 4*n3[axis]) % n3[axis];
+            value += c[j]*(x[ip3[0] + n3[0]*(ip3[1] + n3[1]*ip3[2])] +
+                           x[im3[0] + n3[0]*(im3[1] + n3[1]*im3[2])]);
+          }
+          y[i] += value / (scale*h3[axis]*h3[axis]);
+        }
+      }
+    }
+  }
+  return y;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoSolverFft");
+
+  // Periodic: the solution of the discrete problem is exact. The grid
+  // sizes include one that isn't a power of two.
+
+  unit_func ("solve_periodic()");
+  {
+    const int n3[3] = {8,12,4};
+    const double h3[3] = {1.0/8, 1.0/12, 1.0/4};
+    bool ok = true;
+    for (int order=2; order<=6; order+=2) {
+      // zero-mean solution
+      const int n = n3[0]*n3[1]*n3[2];
+      std::vector<double> x(n);
+      double mean = 0.0;
+      for (int i=0; i<n; i++) {
+        x[i] = sin(0.7*i) + cos(1.3*i*i);
+        mean += x[i];
+      }
+      mean /= n;
+      for (int i=0; i<n; i++) x[i] -= mean;
+
+      std::vector<double> b = apply_laplace(x,n3,h3,order);
+      EnzoSolverFft::solve_periodic(b,n3,h3,order);
+
+      double error = 0.0;
+      for (int i=0; i<n; i++) error = std::max(error,fabs(b[i] - x[i]));
+      ok = ok && (error < 1e-10);
+    }
+    unit_assert (ok);
+  }
+
+  // Isolated: the potential of a Gaussian, phi = -erf(r/(sqrt(2) s)) /
+  // (4 pi r) for unit mass, is reproduced to second order
+
+  unit_func ("solve_isolated()");
+  {
+    const int rank = 3;
+    const int n = 32;
+    const int n3[3] = {n,n,n};
+    const int g3[3] = {3,3,3};
+    const double h = 1.0/n;
+    const double h3[3] = {h,h,h};
+    const double s = 0.1;
+    std::vector<double> b(n*n*n);
+    double mass = 0.0;
+    for (int iz=0; iz<n; iz++) {
+      for (int iy=0; iy<n; iy++) {
+        for (int ix=0; ix<n; ix++) {
+          const double x = (ix+0.5)*h - 0.5;
+          const double y = (iy+0.5)*h - 0.5;
+          const double z = (iz+0.5)*h - 0.5;
+          const double r2 = x*x + y*y + z*z;
+          b[ix + n*(iy + n*iz)] = exp(-0.5*r2/(s*s));
+          mass += b[ix + n*(iy + n*iz)]*h*h*h;
+        }
+      }
+    }
+    for (size_t i=0; i<b.size(); i++) b[i] /= mass;
+
+    int m3[3];
+    EnzoSolverFft::solve_isolated(b,n3,g3,h3,rank,m3);
+
+    unit_assert (m3[0] == 2*(n+3) && m3[1] == 2*(n+3) && m3[2] == 2*(n+3));
+
+    // compare inside the domain and in the ghost zones (which wrap
+    // around to the end of the padded grid)
+    double error = 0.0;
+    double norm = 0.0;
+    for (int iz=-g3[2]; iz<n+g3[2]; iz++) {
+      for (int iy=-g3[1]; iy<n+g3[1]; iy++) {
+        for (int ix=-g3[0]; ix<n+g3[0]; ix++) {
+          const double x = (ix+0.5)*h - 0.5;
+          const double y = (iy+0.5)*h - 0.5;
+          const double z = (iz+0.5)*h - 0.5;
+          const double r = sqrt(x*x + y*y + z*z);
+          const double phi = -erf(r/(sqrt(2.0)*s)) / (4.0*cello::pi*r);
+          const int jx = (ix + m3[0]) % m3[0];
+          const int jy = (iy + m3[1]) % m3[1];
+          const int jz = (iz + m3[2]) % m3[2];
+          const double value = b[jx + m3[0]*(jy + m3[1]*jz)];
+          error = std::max(error,fabs(value - phi));
+          norm  = std::max(norm,fabs(phi));
+        }
+      }
+    }
+    unit_assert (error < 1e-2*norm);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+#include "enzo.def.h"